@@ -13,6 +13,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/Swap.h"
+#include "Common/TimelineTrace.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/System.h"
@@ -165,6 +166,8 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   if (!samples)
     return 0;
 
+  TIMELINE_TRACE_SCOPE("Audio mix");
+
   memset(samples, 0, num_samples * 2 * sizeof(s16));
 
   m_dma_mixer.Mix(samples, num_samples);
@@ -0,0 +1,295 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Hash multimap with open addressing and linear probing, for lookups that are hot enough that
+// the pointer chasing of std::unordered_multimap shows up. Every slot has a byte of metadata with
+// 7 bits of the hash, so probing only has to compare the keys of likely matches.
+//
+// STL-look-a-like interface for the parts that are needed. Erasing leaves a tombstone, so it
+// doesn't invalidate iterators or references to other elements. Inserting can rehash and
+// invalidates all of them. The order of elements with the same key is unspecified.
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+class FlatHashMultiMap
+{
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+
+private:
+  enum : u8
+  {
+    SLOT_EMPTY = 0,
+    SLOT_DELETED = 1,
+    SLOT_FULL = 0x80,
+  };
+
+  struct Slot
+  {
+    Slot() {}
+    ~Slot() {}
+
+    union
+    {
+      value_type value;
+    };
+  };
+
+  // Iterates over all elements, or with KeyOnly, over the elements with a given key.
+  template <bool IsConst, bool KeyOnly>
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = FlatHashMultiMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+    using Map = std::conditional_t<IsConst, const FlatHashMultiMap, FlatHashMultiMap>;
+
+    Iterator() = default;
+    Iterator(Map* map, size_type index, u8 tag = 0) : m_map(map), m_index(index), m_tag(tag) {}
+
+    operator Iterator<true, KeyOnly>() const
+      requires(!IsConst)
+    {
+      return {m_map, m_index, m_tag};
+    }
+    // Points to the same element, but continues with the elements with other keys.
+    explicit operator Iterator<IsConst, false>() const
+      requires(KeyOnly)
+    {
+      return {m_map, m_index};
+    }
+
+    reference operator*() const { return m_map->m_slots[m_index].value; }
+    pointer operator->() const { return &m_map->m_slots[m_index].value; }
+
+    Iterator& operator++()
+    {
+      if constexpr (KeyOnly)
+        m_index = m_map->FindNext(m_index + 1, m_tag, m_map->m_slots[m_index].value.first);
+      else
+        m_index = m_map->FindNextFull(m_index + 1);
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+
+  private:
+    friend class FlatHashMultiMap;
+
+    Map* m_map = nullptr;
+    size_type m_index = 0;
+    u8 m_tag = 0;
+  };
+
+public:
+  using iterator = Iterator<false, false>;
+  using const_iterator = Iterator<true, false>;
+  using key_iterator = Iterator<false, true>;
+  using const_key_iterator = Iterator<true, true>;
+
+  FlatHashMultiMap() = default;
+  FlatHashMultiMap(const FlatHashMultiMap&) = delete;
+  FlatHashMultiMap& operator=(const FlatHashMultiMap&) = delete;
+  FlatHashMultiMap(FlatHashMultiMap&& other) noexcept { Swap(other); }
+  FlatHashMultiMap& operator=(FlatHashMultiMap&& other) noexcept
+  {
+    FlatHashMultiMap moved(std::move(other));
+    Swap(moved);
+    return *this;
+  }
+  ~FlatHashMultiMap() { clear(); }
+
+  size_type size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  iterator begin() { return {this, FindNextFull(0)}; }
+  iterator end() { return {this, m_capacity}; }
+  const_iterator begin() const { return {this, FindNextFull(0)}; }
+  const_iterator end() const { return {this, m_capacity}; }
+
+  template <typename... Args>
+  iterator emplace(const Key& key, Args&&... args)
+  {
+    // Keep at least 1/8 of the slots empty, so that probing for a missing key ends quickly.
+    if ((m_size + m_deleted + 1) * 8 > m_capacity * 7)
+      Rehash(m_size + 1);
+
+    const u64 hash = HashKey(key);
+    size_type index = GetIndex(hash);
+    while (m_control[index] & SLOT_FULL)
+      index = (index + 1) & (m_capacity - 1);
+
+    if (m_control[index] == SLOT_DELETED)
+      m_deleted--;
+    m_control[index] = SLOT_FULL | GetTag(hash);
+    new (&m_slots[index].value) value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                                           std::forward_as_tuple(std::forward<Args>(args)...));
+    m_size++;
+    return {this, index};
+  }
+
+  // Returns the range of elements with the given key. Unlike the STL containers, the iterators
+  // only visit those elements, and can't be compared with begin()/end().
+  std::pair<key_iterator, key_iterator> equal_range(const Key& key)
+  {
+    const u64 hash = HashKey(key);
+    const u8 tag = GetTag(hash);
+    return {{this, FindNext(GetIndex(hash), tag, key), tag}, {this, m_capacity, tag}};
+  }
+  std::pair<const_key_iterator, const_key_iterator> equal_range(const Key& key) const
+  {
+    const u64 hash = HashKey(key);
+    const u8 tag = GetTag(hash);
+    return {{this, FindNext(GetIndex(hash), tag, key), tag}, {this, m_capacity, tag}};
+  }
+
+  iterator find(const Key& key) { return {this, equal_range(key).first.m_index}; }
+  const_iterator find(const Key& key) const { return {this, equal_range(key).first.m_index}; }
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  // Returns the iterator to the next element in the same way as ++.
+  iterator erase(iterator it)
+  {
+    EraseAt(it.m_index);
+    return {this, FindNextFull(it.m_index + 1)};
+  }
+  key_iterator erase(key_iterator it)
+  {
+    key_iterator next = it;
+    ++next;
+    EraseAt(it.m_index);
+    return next;
+  }
+
+  void clear()
+  {
+    for (size_type i = 0; i < m_capacity; i++)
+    {
+      if (m_control[i] & SLOT_FULL)
+        m_slots[i].value.~value_type();
+    }
+    m_control.reset();
+    m_slots.reset();
+    m_capacity = 0;
+    m_shift = 64;
+    m_size = 0;
+    m_deleted = 0;
+  }
+
+private:
+  static u64 HashKey(const Key& key)
+  {
+    // Fibonacci hashing. Many std::hash specializations are the identity, e.g. for addresses where
+    // the low bits are always zero, which would make linear probing degenerate.
+    return static_cast<u64>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+  }
+
+  size_type GetIndex(u64 hash) const
+  {
+    return m_capacity != 0 ? static_cast<size_type>(hash >> m_shift) : 0;
+  }
+  u8 GetTag(u64 hash) const { return static_cast<u8>(hash >> (m_shift - 7)) & 0x7F; }
+
+  size_type FindNextFull(size_type index) const
+  {
+    while (index < m_capacity && !(m_control[index] & SLOT_FULL))
+      index++;
+    return index;
+  }
+
+  // Continues probing for key at index. Returns m_capacity if there are no more elements with key.
+  size_type FindNext(size_type index, u8 tag, const Key& key) const
+  {
+    if (m_capacity == 0)
+      return 0;
+
+    // Wrapping around the table is fine, as it always has an empty slot that ends the probing.
+    index &= m_capacity - 1;
+    while (m_control[index] != SLOT_EMPTY)
+    {
+      if (m_control[index] == (SLOT_FULL | tag) && m_slots[index].value.first == key)
+        return index;
+      index = (index + 1) & (m_capacity - 1);
+    }
+    return m_capacity;
+  }
+
+  void EraseAt(size_type index)
+  {
+    m_slots[index].value.~value_type();
+    m_control[index] = SLOT_DELETED;
+    m_size--;
+    m_deleted++;
+  }
+
+  void Rehash(size_type min_size)
+  {
+    size_type new_capacity = 16;
+    while (min_size * 8 > new_capacity * 7 / 2)
+      new_capacity *= 2;
+
+    auto old_control = std::move(m_control);
+    auto old_slots = std::move(m_slots);
+    const size_type old_capacity = m_capacity;
+
+    m_control = std::make_unique<u8[]>(new_capacity);
+    m_slots = std::make_unique<Slot[]>(new_capacity);
+    m_capacity = new_capacity;
+    m_shift = 64 - std::countr_zero(new_capacity);
+    m_size = 0;
+    m_deleted = 0;
+
+    for (size_type i = 0; i < old_capacity; i++)
+    {
+      if (!(old_control[i] & SLOT_FULL))
+        continue;
+
+      value_type& value = old_slots[i].value;
+      emplace(value.first, std::move(value.second));
+      value.~value_type();
+    }
+  }
+
+  void Swap(FlatHashMultiMap& other)
+  {
+    std::swap(m_control, other.m_control);
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_shift, other.m_shift);
+    std::swap(m_size, other.m_size);
+    std::swap(m_deleted, other.m_deleted);
+  }
+
+  std::unique_ptr<u8[]> m_control;
+  std::unique_ptr<Slot[]> m_slots;
+  size_type m_capacity = 0;
+  int m_shift = 64;
+  size_type m_size = 0;
+  size_type m_deleted = 0;
+};
+}  // namespace Common
@@ -0,0 +1,174 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef ANDROID
+#include "jni/AndroidCommon/AndroidCommon.h"
+#endif
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+
+namespace File
+{
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::string& filename)
+{
+  Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+  Swap(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+  Swap(other);
+  return *this;
+}
+
+void MappedFile::Swap(MappedFile& other) noexcept
+{
+  std::swap(m_data, other.m_data);
+  std::swap(m_size, other.m_size);
+#ifdef _WIN32
+  std::swap(m_file_handle, other.m_file_handle);
+  std::swap(m_mapping_handle, other.m_mapping_handle);
+#endif
+}
+
+std::span<const u8> MappedFile::GetRange(u64 offset, u64 size) const
+{
+  if (offset > m_size || size > m_size - offset)
+    return {};
+
+  return {m_data + offset, static_cast<size_t>(size)};
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const HANDLE file = CreateFileW(UTF8ToWString(filename).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to create file mapping for {}: {}", filename,
+                  Common::GetLastErrorString());
+    CloseHandle(file);
+    return false;
+  }
+
+  void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::GetLastErrorString());
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  m_file_handle = file;
+  m_mapping_handle = mapping;
+  m_data = static_cast<const u8*>(view);
+  m_size = static_cast<u64>(size.QuadPart);
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping_handle)
+    CloseHandle(m_mapping_handle);
+  if (m_file_handle)
+    CloseHandle(m_file_handle);
+
+  m_data = nullptr;
+  m_size = 0;
+  m_mapping_handle = nullptr;
+  m_file_handle = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+#ifdef ANDROID
+  const int fd = IsPathAndroidContent(filename) ? OpenAndroidContent(filename, "r") :
+                                                  open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+#else
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  void* const view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping keeps its own reference to the file.
+  close(fd);
+
+  if (view == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::LastStrerrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(view);
+  m_size = static_cast<u64>(st.st_size);
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    munmap(const_cast<u8*>(m_data), static_cast<size_t>(m_size));
+
+  m_data = nullptr;
+  m_size = 0;
+}
+
+#endif
+}  // namespace File
@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/TimelineTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+
+namespace Common::TimelineTrace
+{
+namespace detail
+{
+std::atomic<bool> s_enabled = false;
+}
+
+namespace
+{
+// The fields are atomic because the exporter may read them while the thread records new events.
+struct Event
+{
+  std::atomic<const char*> name;
+  std::atomic<u64> start_ns;
+  std::atomic<u64> end_ns;
+};
+
+struct ThreadBuffer
+{
+  u32 id = 0;
+  // Guarded by s_mutex.
+  std::string name;
+  bool in_use = true;
+
+  std::unique_ptr<Event[]> events = std::make_unique<Event[]>(EVENTS_PER_THREAD);
+  // Total number of events the thread recorded. Only written by the thread.
+  std::atomic<u64> write_index = 0;
+  // write_index when the current trace was started.
+  std::atomic<u64> start_index = 0;
+};
+
+// Releases the buffer of a thread when it exits, so the threads that are created for every game
+// don't keep adding buffers.
+struct ThreadBufferOwner
+{
+  ~ThreadBufferOwner();
+
+  ThreadBuffer* buffer = nullptr;
+  std::string name;
+};
+
+std::mutex s_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+u64 s_start_ns = 0;
+
+thread_local ThreadBufferOwner t_owner;
+
+ThreadBufferOwner::~ThreadBufferOwner()
+{
+  if (!buffer)
+    return;
+
+  std::lock_guard lk(s_mutex);
+  buffer->in_use = false;
+}
+
+ThreadBuffer* GetThreadBuffer()
+{
+  if (t_owner.buffer) [[likely]]
+    return t_owner.buffer;
+
+  std::lock_guard lk(s_mutex);
+
+  // Reuse the buffer of a thread that exited, unless its events are part of the current trace.
+  const auto it = std::ranges::find_if(s_buffers, [](const auto& buffer) {
+    return !buffer->in_use && (!IsEnabled() || buffer->write_index.load(std::memory_order_relaxed) ==
+                                                   buffer->start_index.load());
+  });
+  ThreadBuffer* buffer;
+  if (it != s_buffers.end())
+  {
+    buffer = it->get();
+    buffer->in_use = true;
+  }
+  else
+  {
+    buffer = s_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+    buffer->id = static_cast<u32>(s_buffers.size());
+  }
+
+  buffer->start_index.store(buffer->write_index.load(std::memory_order_relaxed));
+  buffer->name = t_owner.name.empty() ? fmt::format("Thread {}", buffer->id) : t_owner.name;
+  t_owner.buffer = buffer;
+  return buffer;
+}
+
+void AppendEscapedString(std::string* out, std::string_view str)
+{
+  out->push_back('"');
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out->push_back('\\');
+      out->push_back(c);
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      fmt::format_to(std::back_inserter(*out), "\\u{:04x}", c);
+    }
+    else
+    {
+      out->push_back(c);
+    }
+  }
+  out->push_back('"');
+}
+}  // namespace
+
+void Start()
+{
+  std::lock_guard lk(s_mutex);
+  for (const auto& buffer : s_buffers)
+    buffer->start_index.store(buffer->write_index.load(std::memory_order_acquire));
+  s_start_ns = GetTimestampNs();
+  detail::s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Stop()
+{
+  detail::s_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool WriteChromeTrace(const std::string& path)
+{
+  File::IOFile file(path, "wb");
+  if (!file)
+    return false;
+
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  json += R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"Dolphin"}})";
+
+  std::lock_guard lk(s_mutex);
+  for (const auto& buffer : s_buffers)
+  {
+    const u64 start_index = buffer->start_index.load();
+    const u64 end_index = buffer->write_index.load(std::memory_order_acquire);
+    if (start_index == end_index)
+      continue;
+
+    json += fmt::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                        "\"args\":{{\"name\":",
+                        buffer->id);
+    AppendEscapedString(&json, buffer->name);
+    json += "}}";
+
+    const u64 first_index =
+        std::max(start_index, end_index - std::min<u64>(end_index, EVENTS_PER_THREAD - 1));
+    for (u64 i = first_index; i < end_index; i++)
+    {
+      const Event& event = buffer->events[i % EVENTS_PER_THREAD];
+      const char* name = event.name.load(std::memory_order_relaxed);
+      const u64 start_ns = event.start_ns.load(std::memory_order_relaxed);
+      const u64 end_ns = event.end_ns.load(std::memory_order_relaxed);
+
+      // Skip the event if the thread started overwriting it while it was read. The slot is reused
+      // by event i + EVENTS_PER_THREAD, which is written while write_index is equal to its index.
+      // Paired with the fence in AddEvent, seeing any of its fields means seeing that index.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const u64 write_index = buffer->write_index.load(std::memory_order_relaxed);
+      if (i + EVENTS_PER_THREAD <= write_index)
+        continue;
+
+      json += ",\n{\"name\":";
+      AppendEscapedString(&json, name);
+      fmt::format_to(std::back_inserter(json),
+                     ",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                     buffer->id, (static_cast<s64>(start_ns - s_start_ns)) / 1000.0,
+                     (end_ns - start_ns) / 1000.0);
+
+      if (json.size() >= 1024 * 1024)
+      {
+        if (!file.WriteString(json))
+          return false;
+        json.clear();
+      }
+    }
+  }
+
+  json += "\n]}\n";
+  return file.WriteString(json);
+}
+
+void SetCurrentThreadName(const char* name)
+{
+  t_owner.name = name;
+  if (!t_owner.buffer)
+    return;
+
+  std::lock_guard lk(s_mutex);
+  t_owner.buffer->name = name;
+}
+
+u64 GetTimestampNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void AddEvent(const char* name, u64 start_ns, u64 end_ns)
+{
+  if (!IsEnabled())
+    return;
+
+  ThreadBuffer* const buffer = GetThreadBuffer();
+  const u64 index = buffer->write_index.load(std::memory_order_relaxed);
+  Event& event = buffer->events[index % EVENTS_PER_THREAD];
+  // Makes the exporter see the current index if it reads any of the fields that are written next.
+  std::atomic_thread_fence(std::memory_order_release);
+  event.name.store(name, std::memory_order_relaxed);
+  event.start_ns.store(start_ns, std::memory_order_relaxed);
+  event.end_ns.store(end_ns, std::memory_order_relaxed);
+  buffer->write_index.store(index + 1, std::memory_order_release);
+}
+}  // namespace Common::TimelineTrace
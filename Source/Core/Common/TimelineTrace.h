@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Timeline tracing of what the emulator's threads are doing, for finding stalls between them.
+//
+// Every thread records its events into its own ring buffer, so recording is lock-free and costs a
+// single relaxed load while tracing is stopped. The recorded events can be written in the Chrome
+// trace event format, which chrome://tracing and Perfetto can display.
+namespace Common::TimelineTrace
+{
+namespace detail
+{
+extern std::atomic<bool> s_enabled;
+}
+
+// Size of the ring buffer of each thread. Older events are overwritten. The oldest slot may be in
+// the middle of being overwritten, so only the newest EVENTS_PER_THREAD - 1 events are exported.
+constexpr u32 EVENTS_PER_THREAD = 1 << 16;
+
+inline bool IsEnabled()
+{
+  return detail::s_enabled.load(std::memory_order_relaxed);
+}
+
+// Discards the events of the last trace and starts recording.
+void Start();
+// Stops recording. The events are kept until the next Start.
+void Stop();
+
+// Writes the recorded events as a Chrome trace JSON file. Should be called after Stop, events that
+// are recorded while writing may be missing from the file.
+bool WriteChromeTrace(const std::string& path);
+
+// Sets the name of the calling thread in the traces. Called by Common::SetCurrentThreadName.
+void SetCurrentThreadName(const char* name);
+
+u64 GetTimestampNs();
+
+// The name must outlive the trace, so it should be a string literal.
+void AddEvent(const char* name, u64 start_ns, u64 end_ns);
+
+class ScopedEvent
+{
+public:
+  explicit ScopedEvent(const char* name)
+  {
+    if (IsEnabled())
+    {
+      m_name = name;
+      m_start_ns = GetTimestampNs();
+    }
+  }
+
+  ~ScopedEvent()
+  {
+    if (m_name)
+      AddEvent(m_name, m_start_ns, GetTimestampNs());
+  }
+
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+private:
+  const char* m_name = nullptr;
+  u64 m_start_ns = 0;
+};
+}  // namespace Common::TimelineTrace
+
+#define TIMELINE_TRACE_CONCAT_INNER(a, b) a##b
+#define TIMELINE_TRACE_CONCAT(a, b) TIMELINE_TRACE_CONCAT_INNER(a, b)
+
+// Records the time until the end of the current scope as an event on the timeline.
+#define TIMELINE_TRACE_SCOPE(name)                                                                 \
+  const Common::TimelineTrace::ScopedEvent TIMELINE_TRACE_CONCAT(timeline_trace_scope_,           \
+                                                                 __LINE__)(name)
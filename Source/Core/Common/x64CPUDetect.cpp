@@ -185,10 +185,12 @@ void CPUInfo::Detect()
     //  - Is the AVX bit set in CPUID?
     //  - Is the XSAVE bit set in CPUID?
     //  - XGETBV result has the XCR bit set.
+    u64 xcr0 = 0;
     if (((info.ecx >> 28) & 1) && ((info.ecx >> 27) & 1))
     {
       // Check that XSAVE can be used for SSE and AVX
-      if ((xgetbv(XCR_XFEATURE_ENABLED_MASK) & 0b110) == 0b110)
+      xcr0 = xgetbv(XCR_XFEATURE_ENABLED_MASK);
+      if ((xcr0 & 0b110) == 0b110)
       {
         bAVX = true;
         if ((info.ecx >> 12) & 1)
@@ -199,6 +201,11 @@ void CPUInfo::Detect()
     if (func_id_max >= 7)
     {
       info = cpuid(7);
+      if (bAVX && ((info.ebx >> 5) & 1))
+        bAVX2 = true;
+      // AVX-512 additionally needs the OS to save the opmask and upper ZMM registers.
+      if (bAVX2 && bFMA && ((info.ebx >> 16) & 1) && (xcr0 & 0b11100110) == 0b11100110)
+        bAVX512F = true;
       if ((info.ebx >> 3) & 1)
         bBMI1 = true;
       if ((info.ebx >> 8) & 1)
@@ -259,6 +266,10 @@ std::string CPUInfo::Summarize()
     sum.push_back("HTT");
   if (bAVX)
     sum.push_back("AVX");
+  if (bAVX2)
+    sum.push_back("AVX2");
+  if (bAVX512F)
+    sum.push_back("AVX512F");
   if (bBMI1)
     sum.push_back("BMI1");
   if (bBMI2)
@@ -1882,6 +1882,19 @@ void XEmitter::WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, co
   WriteVEXOp4(opPrefix, op, regOp1, regOp2, arg, regOp3, W);
 }
 
+static void CheckAVX2Support()
+{
+  if (!cpu_info.bAVX2)
+    PanicAlertFmt("Trying to use AVX2 on a system that doesn't support it. Bad programmer.");
+}
+
+void XEmitter::WriteAVX2Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
+                           int W, int extrabytes)
+{
+  CheckAVX2Support();
+  WriteVEXOp(opPrefix, op, regOp1, regOp2, arg, W, extrabytes);
+}
+
 void XEmitter::WriteFMA3Op(u8 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W)
 {
   if (!cpu_info.bFMA)
@@ -3043,6 +3056,70 @@ void XEmitter::VMOVAPS(const OpArg& arg, X64Reg regOp)
   WriteAVXOp(0x00, 0x29, regOp, X64Reg::INVALID_REG, arg);
 }
 
+void XEmitter::VMOVUPS(const OpArg& arg, X64Reg regOp)
+{
+  WriteAVXOp(0x00, 0x11, regOp, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VMOVD_xmm(X64Reg dest, const OpArg& arg)
+{
+  WriteAVXOp(0x66, 0x6E, dest, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VMOVQ_xmm(X64Reg dest, const OpArg& arg)
+{
+  WriteAVXOp(0xF3, 0x7E, dest, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VMOVDQU(X64Reg dest, const OpArg& arg)
+{
+  WriteAVXOp(0xF3, 0x6F, dest, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VCVTDQ2PS(X64Reg regOp1, const OpArg& arg)
+{
+  WriteAVXOp(0x00, 0x5B, regOp1, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VPSHUFB(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
+{
+  WriteAVX2Op(0x66, 0x3800, regOp1, regOp2, arg);
+}
+
+void XEmitter::VPSRAD(X64Reg dest, X64Reg reg, u8 shift)
+{
+  WriteAVX2Op(0x66, 0x72, (X64Reg)4, dest, R(reg), 0, 1);
+  Write8(shift);
+}
+
+void XEmitter::VPBROADCASTD(X64Reg dest, const OpArg& arg)
+{
+  WriteAVX2Op(0x66, 0x3858, dest, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VPBROADCASTQ(X64Reg dest, const OpArg& arg)
+{
+  WriteAVX2Op(0x66, 0x3859, dest, X64Reg::INVALID_REG, arg);
+}
+
+void XEmitter::VPBLENDD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 blend)
+{
+  WriteAVX2Op(0x66, 0x3A02, regOp1, regOp2, arg, 0, 1);
+  Write8(blend);
+}
+
+void XEmitter::VINSERTI128(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 subreg)
+{
+  WriteAVX2Op(0x66, 0x3A38, regOp1, regOp2, arg, 0, 1);
+  Write8(subreg);
+}
+
+void XEmitter::VEXTRACTI128(const OpArg& arg, X64Reg regOp, u8 subreg)
+{
+  WriteAVX2Op(0x66, 0x3A39, regOp, X64Reg::INVALID_REG, arg, 0, 1);
+  Write8(subreg);
+}
+
 void XEmitter::VZEROUPPER()
 {
   CheckAVXSupport();
@@ -363,6 +363,8 @@ private:
                   int extrabytes = 0);
   void WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
                    X64Reg regOp3, int W = 0);
+  void WriteAVX2Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0,
+                   int extrabytes = 0);
   void WriteFMA3Op(u8 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
   void WriteFMA4Op(u8 op, X64Reg dest, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
   void WriteBMIOp(int size, u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
@@ -879,6 +881,20 @@ public:
   void VPXOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
 
   void VMOVAPS(const OpArg& arg, X64Reg regOp);
+  void VMOVUPS(const OpArg& arg, X64Reg regOp);
+  void VMOVD_xmm(X64Reg dest, const OpArg& arg);
+  void VMOVQ_xmm(X64Reg dest, const OpArg& arg);
+  void VMOVDQU(X64Reg dest, const OpArg& arg);
+  void VCVTDQ2PS(X64Reg regOp1, const OpArg& arg);
+
+  // AVX2. These are mostly the 256-bit forms of the SSE integer instructions.
+  void VPSHUFB(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+  void VPSRAD(X64Reg dest, X64Reg reg, u8 shift);
+  void VPBROADCASTD(X64Reg dest, const OpArg& arg);
+  void VPBROADCASTQ(X64Reg dest, const OpArg& arg);
+  void VPBLENDD(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 blend);
+  void VINSERTI128(X64Reg regOp1, X64Reg regOp2, const OpArg& arg, u8 subreg);
+  void VEXTRACTI128(const OpArg& arg, X64Reg regOp, u8 subreg);
 
   void VZEROUPPER();
 
@@ -58,6 +58,7 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -354,6 +355,9 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   if (exception_handler)
     EMM::InstallExceptionHandler();
 
+  // Write tracking relies on the exception handler to unprotect pages on write.
+  system.GetMemory().GetWriteTracker().SetEnabled(exception_handler);
+
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher = std::make_unique<MemoryWatcher>();
 #endif
@@ -401,6 +405,7 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   s_memory_watcher.reset();
 #endif
 
+  system.GetMemory().GetWriteTracker().SetEnabled(false);
   if (exception_handler)
     EMM::UninstallExceptionHandler();
 
@@ -867,6 +872,7 @@ void RunOnCPUThread(Core::System& system, Common::MoveOnlyFunction<void()> funct
 void Callback_FramePresented(const PresentInfo& present_info)
 {
   g_perf_metrics.CountFrame();
+  g_perf_metrics.UpdateStats();
 
   if (present_info.reason == PresentInfo::PresentReason::VideoInterfaceDuplicate)
     return;
@@ -15,6 +15,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/SPSCQueue.h"
+#include "Common/TimelineTrace.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -333,6 +334,8 @@ void CoreTimingManager::MoveEvents()
 
 void CoreTimingManager::Advance()
 {
+  TIMELINE_TRACE_SCOPE("CoreTiming::Advance");
+
   CPUThreadConfigCallback::CheckForConfigChanges();
 
   MoveEvents();
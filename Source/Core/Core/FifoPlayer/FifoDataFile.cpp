@@ -7,20 +7,33 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <xxhash.h>
+#include <zstd.h>
+
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
-constexpr u32 MIN_LOADER_VERSION = 1;
-// This value is only used if the DFF file was created with overridden RAM sizes.
-// If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
-constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 VERSION_NUMBER = 6;
+// Version 6 stores frames compressed, which older loaders can't read.
+constexpr u32 MIN_LOADER_VERSION = 6;
+// First version with zstd-compressed frames and deduplicated memory updates.
+constexpr u32 FIRST_COMPRESSED_VERSION = 6;
+
+constexpr int COMPRESSION_LEVEL = 3;
+
+// Upper bound for the decoded frames that are kept around after use. Looping over a short log
+// doesn't need to decode it again, while long logs only keep a few frames in memory.
+constexpr size_t FRAME_CACHE_SIZE = 256 * 1024 * 1024;
 
 #pragma pack(push, 1)
 
@@ -46,7 +59,10 @@ struct FileHeader
   // will crash and burn with mismatched settings.  See PR #8722.
   u32 mem1_size;
   u32 mem2_size;
-  u8 reserved[32];
+  // Only used since version 6
+  u64 blobListOffset;
+  u32 blobCount;
+  u8 reserved[20];
 };
 static_assert(sizeof(FileHeader) == 128, "FileHeader should be 128 bytes");
 
@@ -73,8 +89,99 @@ struct FileMemoryUpdate
 };
 static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 bytes");
 
+// Version 6 and later: Each frame is a single zstd frame containing the FIFO data, followed by
+// one FileMemoryUpdateRef per memory update. The list of frames doubles as an index, so any frame
+// can be read without touching the others.
+struct FileCompressedFrameInfo
+{
+  u64 chunkOffset;
+  u32 chunkSize;
+  u32 fifoDataSize;
+  u32 fifoStart;
+  u32 fifoEnd;
+  u32 numMemoryUpdates;
+  u8 reserved[36];
+};
+static_assert(sizeof(FileCompressedFrameInfo) == 64, "FileCompressedFrameInfo should be 64 bytes");
+
+struct FileMemoryUpdateRef
+{
+  u32 fifoPosition;
+  u32 address;
+  u32 blobIndex;
+  u8 type;
+  u8 reserved[3];
+};
+static_assert(sizeof(FileMemoryUpdateRef) == 16, "FileMemoryUpdateRef should be 16 bytes");
+
+// The contents of memory updates are stored once per unique content and compressed separately,
+// as games upload the same textures and vertex arrays over and over again.
+struct FileBlob
+{
+  u64 dataOffset;
+  u32 compressedSize;
+  u32 dataSize;
+  u64 hashLow;
+  u64 hashHigh;
+};
+static_assert(sizeof(FileBlob) == 32, "FileBlob should be 32 bytes");
+
 #pragma pack(pop)
 
+namespace
+{
+struct ZstdCCtxDeleter
+{
+  void operator()(ZSTD_CCtx* ctx) const { ZSTD_freeCCtx(ctx); }
+};
+
+struct ZstdDCtxDeleter
+{
+  void operator()(ZSTD_DCtx* ctx) const { ZSTD_freeDCtx(ctx); }
+};
+
+template <typename T>
+bool ReadStruct(std::span<const u8> range, T* out)
+{
+  if (range.size() != sizeof(T))
+    return false;
+
+  std::memcpy(out, range.data(), sizeof(T));
+  return true;
+}
+
+// Checks that the zstd frame decompresses to the given size before a buffer is allocated for it,
+// so corrupt sizes in the file fail the load instead of causing huge allocations.
+bool HasDecompressedSize(std::span<const u8> src, u64 size)
+{
+  // Every block has a 3 byte header and decompresses to at most ZSTD_BLOCKSIZE_MAX bytes.
+  if (size > (src.size() / 3 + 1) * ZSTD_BLOCKSIZE_MAX)
+    return false;
+
+  return ZSTD_getFrameContentSize(src.data(), src.size()) == size;
+}
+
+bool Decompress(std::span<const u8> src, u8* dst, size_t dst_size)
+{
+  // Decompression contexts are cheap to keep, but the GPU-facing CPU thread and the UI can both
+  // read frames.
+  thread_local std::unique_ptr<ZSTD_DCtx, ZstdDCtxDeleter> dctx{ZSTD_createDCtx()};
+  if (!dctx)
+    return false;
+
+  const size_t result = ZSTD_decompressDCtx(dctx.get(), dst, dst_size, src.data(), src.size());
+  return !ZSTD_isError(result) && result == dst_size;
+}
+
+size_t GetFrameMemorySize(const FifoFrameInfo& frame)
+{
+  size_t size = frame.fifoData.size();
+  for (const MemoryUpdate& update : frame.memoryUpdates)
+    size += update.data.size();
+  return size;
+}
+}  // namespace
+
 FifoDataFile::FifoDataFile() = default;
 
 FifoDataFile::~FifoDataFile() = default;
@@ -99,9 +206,227 @@ bool FifoDataFile::GetIsWii() const
   return GetFlag(FLAG_IS_WII);
 }
 
-void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
+void FifoDataFile::AddFrame(FifoFrameInfo frameInfo)
+{
+  m_Frames.push_back(std::make_shared<const FifoFrameInfo>(std::move(frameInfo)));
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  if (m_mapped_file)
+    return m_frame_count;
+
+  return static_cast<u32>(m_Frames.size());
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  if (!m_mapped_file)
+    return m_Frames[frame];
+
+  // The lock is held while the frame is read, so that concurrent calls for the same frame can't
+  // both miss and insert it twice.
+  std::lock_guard lk(m_frame_cache_mutex);
+  const auto it = std::ranges::find(m_frame_cache, frame,
+                                    &std::pair<u32, std::shared_ptr<const FifoFrameInfo>>::first);
+  if (it != m_frame_cache.end())
+  {
+    m_frame_cache.splice(m_frame_cache.begin(), m_frame_cache, it);
+    return it->second;
+  }
+
+  std::shared_ptr<const FifoFrameInfo> frame_info = ReadFrame(frame);
+  m_frame_cache.emplace_front(frame, frame_info);
+  m_frame_cache_size += GetFrameMemorySize(*frame_info);
+  while (m_frame_cache.size() > 1 && m_frame_cache_size > FRAME_CACHE_SIZE)
+  {
+    m_frame_cache_size -= GetFrameMemorySize(*m_frame_cache.back().second);
+    m_frame_cache.pop_back();
+  }
+
+  return frame_info;
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::ReadFrame(u32 frame) const
+{
+  auto frame_info = std::make_shared<FifoFrameInfo>();
+
+  const bool success = m_Version >= FIRST_COMPRESSED_VERSION ?
+                           ReadCompressedFrame(frame, frame_info.get()) :
+                           ReadUncompressedFrame(frame, frame_info.get());
+  if (!success)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read frame {} of the DFF file", frame);
+    CriticalAlertFmtT("Failed to read DFF file.");
+    *frame_info = {};
+  }
+
+  return frame_info;
+}
+
+bool FifoDataFile::ReadCompressedFrame(u32 frame, FifoFrameInfo* out) const
+{
+  FileCompressedFrameInfo src_frame;
+  if (!ReadStruct(GetMappedRange(m_frame_list_offset + frame * sizeof(FileCompressedFrameInfo),
+                                 sizeof(FileCompressedFrameInfo)),
+                  &src_frame))
+  {
+    return false;
+  }
+
+  out->fifoStart = src_frame.fifoStart;
+  out->fifoEnd = src_frame.fifoEnd;
+
+  // Decompress the FIFO data and the memory update list in one go, then split them up.
+  const u64 updates_size = u64(src_frame.numMemoryUpdates) * sizeof(FileMemoryUpdateRef);
+  const u64 chunk_size = src_frame.fifoDataSize + updates_size;
+  const std::span<const u8> chunk = GetMappedRange(src_frame.chunkOffset, src_frame.chunkSize);
+  if (chunk.size() != src_frame.chunkSize || !HasDecompressedSize(chunk, chunk_size))
+    return false;
+
+  out->fifoData.resize(chunk_size);
+  if (!Decompress(chunk, out->fifoData.data(), chunk_size))
+    return false;
+
+  out->memoryUpdates.resize(src_frame.numMemoryUpdates);
+  for (u32 i = 0; i < src_frame.numMemoryUpdates; ++i)
+  {
+    FileMemoryUpdateRef src_update;
+    std::memcpy(&src_update,
+                out->fifoData.data() + src_frame.fifoDataSize + i * sizeof(FileMemoryUpdateRef),
+                sizeof(FileMemoryUpdateRef));
+
+    FileBlob blob;
+    if (src_update.blobIndex >= m_blob_count ||
+        !ReadStruct(GetMappedRange(m_blob_list_offset + src_update.blobIndex * sizeof(FileBlob),
+                                   sizeof(FileBlob)),
+                    &blob))
+    {
+      return false;
+    }
+
+    const std::span<const u8> blob_data = GetMappedRange(blob.dataOffset, blob.compressedSize);
+    if (blob_data.size() != blob.compressedSize || !HasDecompressedSize(blob_data, blob.dataSize))
+      return false;
+
+    MemoryUpdate& dst_update = out->memoryUpdates[i];
+    dst_update.fifoPosition = src_update.fifoPosition;
+    dst_update.address = src_update.address;
+    dst_update.type = static_cast<MemoryUpdate::Type>(src_update.type);
+    dst_update.data.resize(blob.dataSize);
+    if (!Decompress(blob_data, dst_update.data.data(), blob.dataSize))
+      return false;
+  }
+
+  out->fifoData.resize(src_frame.fifoDataSize);
+  return true;
+}
+
+bool FifoDataFile::ReadUncompressedFrame(u32 frame, FifoFrameInfo* out) const
+{
+  FileFrameInfo src_frame;
+  if (!ReadStruct(GetMappedRange(m_frame_list_offset + frame * sizeof(FileFrameInfo),
+                                 sizeof(FileFrameInfo)),
+                  &src_frame))
+  {
+    return false;
+  }
+
+  out->fifoStart = src_frame.fifoStart;
+  out->fifoEnd = src_frame.fifoEnd;
+
+  const std::span<const u8> fifo_data =
+      GetMappedRange(src_frame.fifoDataOffset, src_frame.fifoDataSize);
+  if (fifo_data.size() != src_frame.fifoDataSize)
+    return false;
+  out->fifoData.assign(fifo_data.begin(), fifo_data.end());
+
+  const u64 updates_size = u64(src_frame.numMemoryUpdates) * sizeof(FileMemoryUpdate);
+  if (GetMappedRange(src_frame.memoryUpdatesOffset, updates_size).size() != updates_size)
+    return false;
+
+  out->memoryUpdates.resize(src_frame.numMemoryUpdates);
+  for (u32 i = 0; i < src_frame.numMemoryUpdates; ++i)
+  {
+    FileMemoryUpdate src_update;
+    if (!ReadStruct(GetMappedRange(src_frame.memoryUpdatesOffset + i * sizeof(FileMemoryUpdate),
+                                   sizeof(FileMemoryUpdate)),
+                    &src_update))
+    {
+      return false;
+    }
+
+    const std::span<const u8> data = GetMappedRange(src_update.dataOffset, src_update.dataSize);
+    if (data.size() != src_update.dataSize)
+      return false;
+
+    MemoryUpdate& dst_update = out->memoryUpdates[i];
+    dst_update.address = src_update.address;
+    dst_update.fifoPosition = src_update.fifoPosition;
+    dst_update.data.assign(data.begin(), data.end());
+    dst_update.type = static_cast<MemoryUpdate::Type>(src_update.type);
+  }
+
+  return true;
+}
+
+std::span<const u8> FifoDataFile::GetMappedRange(u64 offset, u64 size) const
 {
-  m_Frames.push_back(frameInfo);
+  return m_mapped_file.GetRange(offset, size);
+}
+
+bool FifoDataFile::ValidateFrameIndex() const
+{
+  if (m_Version >= FIRST_COMPRESSED_VERSION)
+  {
+    if (GetMappedRange(m_blob_list_offset, u64(m_blob_count) * sizeof(FileBlob)).size() !=
+        u64(m_blob_count) * sizeof(FileBlob))
+    {
+      return false;
+    }
+
+    for (u32 i = 0; i < m_blob_count; ++i)
+    {
+      FileBlob blob;
+      if (!ReadStruct(GetMappedRange(m_blob_list_offset + i * sizeof(FileBlob), sizeof(FileBlob)),
+                      &blob) ||
+          GetMappedRange(blob.dataOffset, blob.compressedSize).size() != blob.compressedSize)
+      {
+        return false;
+      }
+    }
+
+    for (u32 i = 0; i < m_frame_count; ++i)
+    {
+      FileCompressedFrameInfo frame;
+      if (!ReadStruct(GetMappedRange(m_frame_list_offset + i * sizeof(FileCompressedFrameInfo),
+                                     sizeof(FileCompressedFrameInfo)),
+                      &frame) ||
+          GetMappedRange(frame.chunkOffset, frame.chunkSize).size() != frame.chunkSize)
+      {
+        return false;
+      }
+    }
+  }
+  else
+  {
+    for (u32 i = 0; i < m_frame_count; ++i)
+    {
+      FileFrameInfo frame;
+      if (!ReadStruct(GetMappedRange(m_frame_list_offset + i * sizeof(FileFrameInfo),
+                                     sizeof(FileFrameInfo)),
+                      &frame) ||
+          GetMappedRange(frame.fifoDataOffset, frame.fifoDataSize).size() != frame.fifoDataSize ||
+          GetMappedRange(frame.memoryUpdatesOffset,
+                         u64(frame.numMemoryUpdates) * sizeof(FileMemoryUpdate))
+                  .size() != u64(frame.numMemoryUpdates) * sizeof(FileMemoryUpdate))
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
@@ -110,13 +435,13 @@ bool FifoDataFile::Save(const std::string& filename)
   if (!file.Open(filename, "wb"))
     return false;
 
+  const std::unique_ptr<ZSTD_CCtx, ZstdCCtxDeleter> cctx{ZSTD_createCCtx()};
+  if (!cctx)
+    return false;
+
   // Add space for header
   PadFile(sizeof(FileHeader), file);
 
-  // Add space for frame list
-  u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
-
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
 
@@ -132,15 +457,94 @@ bool FifoDataFile::Save(const std::string& filename)
   u64 texMemOffset = file.Tell();
   file.WriteArray(m_TexMem);
 
+  std::vector<u8> compressed;
+  const auto write_compressed = [&](const u8* data, size_t size, u64* offset, u32* written) {
+    compressed.resize(ZSTD_compressBound(size));
+    const size_t result = ZSTD_compressCCtx(cctx.get(), compressed.data(), compressed.size(), data,
+                                            size, COMPRESSION_LEVEL);
+    if (ZSTD_isError(result))
+      return false;
+
+    *offset = file.Tell();
+    *written = static_cast<u32>(result);
+    return file.WriteBytes(compressed.data(), result);
+  };
+
+  // Blobs are looked up by a 128-bit hash of their contents and their size.
+  std::vector<FileBlob> blobs;
+  std::unordered_map<u64, std::vector<u32>> blobs_by_hash;
+
+  const u32 frame_count = GetFrameCount();
+  std::vector<FileCompressedFrameInfo> frame_list(frame_count);
+  std::vector<u8> chunk;
+  for (u32 i = 0; i < frame_count; ++i)
+  {
+    const std::shared_ptr<const FifoFrameInfo> src_frame = GetFrame(i);
+
+    chunk.assign(src_frame->fifoData.begin(), src_frame->fifoData.end());
+    for (const MemoryUpdate& src_update : src_frame->memoryUpdates)
+    {
+      const XXH128_hash_t hash = XXH3_128bits(src_update.data.data(), src_update.data.size());
+      const u32 size = static_cast<u32>(src_update.data.size());
+
+      std::vector<u32>& candidates = blobs_by_hash[hash.low64];
+      const auto it = std::ranges::find_if(candidates, [&](u32 index) {
+        return blobs[index].hashHigh == hash.high64 && blobs[index].dataSize == size;
+      });
+
+      u32 blob_index;
+      if (it != candidates.end())
+      {
+        blob_index = *it;
+      }
+      else
+      {
+        FileBlob blob{};
+        blob.dataSize = size;
+        blob.hashLow = hash.low64;
+        blob.hashHigh = hash.high64;
+        if (!write_compressed(src_update.data.data(), size, &blob.dataOffset,
+                              &blob.compressedSize))
+        {
+          return false;
+        }
+
+        blob_index = static_cast<u32>(blobs.size());
+        blobs.push_back(blob);
+        candidates.push_back(blob_index);
+      }
+
+      FileMemoryUpdateRef dst_update{};
+      dst_update.fifoPosition = src_update.fifoPosition;
+      dst_update.address = src_update.address;
+      dst_update.blobIndex = blob_index;
+      dst_update.type = static_cast<u8>(src_update.type);
+
+      const auto* ref_bytes = reinterpret_cast<const u8*>(&dst_update);
+      chunk.insert(chunk.end(), ref_bytes, ref_bytes + sizeof(dst_update));
+    }
+
+    FileCompressedFrameInfo& dst_frame = frame_list[i];
+    dst_frame = {};
+    dst_frame.fifoDataSize = static_cast<u32>(src_frame->fifoData.size());
+    dst_frame.fifoStart = src_frame->fifoStart;
+    dst_frame.fifoEnd = src_frame->fifoEnd;
+    dst_frame.numMemoryUpdates = static_cast<u32>(src_frame->memoryUpdates.size());
+    if (!write_compressed(chunk.data(), chunk.size(), &dst_frame.chunkOffset, &dst_frame.chunkSize))
+      return false;
+  }
+
+  const u64 frameListOffset = file.Tell();
+  file.WriteArray(frame_list.data(), frame_list.size());
+
+  const u64 blobListOffset = file.Tell();
+  file.WriteArray(blobs.data(), blobs.size());
+
   // Write header
-  FileHeader header;
+  FileHeader header{};
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
-    header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
-  else
-    header.min_loader_version = MIN_LOADER_VERSION;
+  header.min_loader_version = MIN_LOADER_VERSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -158,7 +562,10 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = frame_count;
+
+  header.blobListOffset = blobListOffset;
+  header.blobCount = static_cast<u32>(blobs.size());
 
   header.flags = m_Flags;
 
@@ -170,32 +577,6 @@ bool FifoDataFile::Save(const std::string& filename)
   file.Seek(0, File::SeekOrigin::Begin);
   file.WriteBytes(&header, sizeof(FileHeader));
 
-  // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
-  {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
-
-    // Write FIFO data
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
-
-    // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
-  }
-
   if (!file.Close())
     return false;
 
@@ -204,24 +585,21 @@ bool FifoDataFile::Save(const std::string& filename)
 
 std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly)
 {
-  File::IOFile file;
-  file.Open(filename, "rb");
-  if (!file)
+  File::MappedFile file;
+  if (!file.Open(filename))
+  {
+    if (File::IOFile(filename, "rb").GetSize() == 0)
+      CriticalAlertFmtT("DFF file size is 0; corrupt/incomplete file?");
     return nullptr;
+  }
 
   auto panic_failed_to_read = [] {
     CriticalAlertFmtT("Failed to read DFF file.");
     return nullptr;
   };
 
-  if (file.GetSize() == 0)
-  {
-    CriticalAlertFmtT("DFF file size is 0; corrupt/incomplete file?");
-    return nullptr;
-  }
-
   FileHeader header;
-  if (!file.ReadBytes(&header, sizeof(header)))
+  if (!ReadStruct(file.GetRange(0, sizeof(header)), &header))
     return panic_failed_to_read();
 
   if (header.fileId != FILE_ID)
@@ -284,64 +662,49 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     return nullptr;
   }
 
-  u32 size = std::min<u32>(BP_MEM_SIZE, header.bpMemSize);
-  file.Seek(header.bpMemOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_BPMem.data(), size);
-
-  size = std::min<u32>(CP_MEM_SIZE, header.cpMemSize);
-  file.Seek(header.cpMemOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_CPMem.data(), size);
-
-  size = std::min<u32>(XF_MEM_SIZE, header.xfMemSize);
-  file.Seek(header.xfMemOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_XFMem.data(), size);
+  const auto read_array = [&file](u64 offset, u32 count, auto& array) {
+    using T = typename std::remove_reference_t<decltype(array)>::value_type;
+    const u32 size = std::min<u32>(static_cast<u32>(array.size()), count);
+    const std::span<const u8> range = file.GetRange(offset, size * sizeof(T));
+    if (range.size() != size * sizeof(T))
+      return false;
+    std::memcpy(array.data(), range.data(), range.size());
+    return true;
+  };
 
-  size = std::min<u32>(XF_REGS_SIZE, header.xfRegsSize);
-  file.Seek(header.xfRegsOffset, File::SeekOrigin::Begin);
-  file.ReadArray(dataFile->m_XFRegs.data(), size);
+  if (!read_array(header.bpMemOffset, header.bpMemSize, dataFile->m_BPMem) ||
+      !read_array(header.cpMemOffset, header.cpMemSize, dataFile->m_CPMem) ||
+      !read_array(header.xfMemOffset, header.xfMemSize, dataFile->m_XFMem) ||
+      !read_array(header.xfRegsOffset, header.xfRegsSize, dataFile->m_XFRegs))
+  {
+    return panic_failed_to_read();
+  }
 
   // Texture memory saving was added in version 4.
   dataFile->m_TexMem.fill(0);
-  if (dataFile->m_Version >= 4)
+  if (dataFile->m_Version >= 4 &&
+      !read_array(header.texMemOffset, header.texMemSize, dataFile->m_TexMem))
   {
-    size = std::min<u32>(TEX_MEM_SIZE, header.texMemSize);
-    file.Seek(header.texMemOffset, File::SeekOrigin::Begin);
-    file.ReadArray(&dataFile->m_TexMem);
-  }
-
-  if (!file.IsGood())
     return panic_failed_to_read();
+  }
 
   // idk what else these could be used for, but it'd be a shame to not make them available.
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
+  // Frames are only read when they're played back or inspected.
+  dataFile->m_mapped_file = std::move(file);
+  dataFile->m_frame_list_offset = header.frameListOffset;
+  dataFile->m_frame_count = header.frameCount;
+  if (dataFile->m_Version >= FIRST_COMPRESSED_VERSION)
   {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    FileFrameInfo srcFrame;
-    if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
-      return panic_failed_to_read();
-
-    FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-
-    file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
-
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
-
-    if (!file.IsGood())
-      return panic_failed_to_read();
-
-    dataFile->AddFrame(dstFrame);
+    dataFile->m_blob_list_offset = header.blobListOffset;
+    dataFile->m_blob_count = header.blobCount;
   }
 
+  if (!dataFile->ValidateFrameIndex())
+    return panic_failed_to_read();
+
   return dataFile;
 }
 
@@ -363,57 +726,3 @@ bool FifoDataFile::GetFlag(u32 flag) const
 {
   return !!(m_Flags & flag);
 }
-
-u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
-{
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
-
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
-  {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
-
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
-
-    FileMemoryUpdate dstUpdate;
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.type = static_cast<u8>(srcUpdate.type);
-
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
-  }
-
-  return updateListOffset;
-}
-
-void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
-{
-  memUpdates.resize(numUpdates);
-
-  for (u32 i = 0; i < numUpdates; ++i)
-  {
-    u64 updateOffset = fileOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    FileMemoryUpdate srcUpdate;
-    file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate));
-
-    MemoryUpdate& dstUpdate = memUpdates[i];
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.data.resize(srcUpdate.dataSize);
-    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
-
-    file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
-  }
-}
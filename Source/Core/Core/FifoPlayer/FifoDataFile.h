@@ -4,11 +4,15 @@
 #pragma once
 
 #include <array>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/MappedFile.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace File
@@ -72,9 +76,11 @@ public:
   u32 GetRamSizeReal() { return m_ram_size_real; }
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
-  void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  void AddFrame(FifoFrameInfo frameInfo);
+  // Frames of loaded files are read from disk on demand, so the returned pointer should only be
+  // kept for as long as the frame is needed.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const;
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
@@ -90,9 +96,12 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
-  static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  bool ValidateFrameIndex() const;
+  std::shared_ptr<const FifoFrameInfo> ReadFrame(u32 frame) const;
+  bool ReadCompressedFrame(u32 frame, FifoFrameInfo* out) const;
+  bool ReadUncompressedFrame(u32 frame, FifoFrameInfo* out) const;
+
+  std::span<const u8> GetMappedRange(u64 offset, u64 size) const;
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
@@ -105,5 +114,18 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  // Frames of a file that is being recorded.
+  std::vector<std::shared_ptr<const FifoFrameInfo>> m_Frames;
+
+  // Frames of a loaded file stay on disk and are decoded when they are needed.
+  File::MappedFile m_mapped_file;
+  u64 m_frame_list_offset = 0;
+  u32 m_frame_count = 0;
+  u64 m_blob_list_offset = 0;
+  u32 m_blob_count = 0;
+
+  // Recently used frames, most recently used first.
+  mutable std::mutex m_frame_cache_mutex;
+  mutable std::list<std::pair<u32, std::shared_ptr<const FifoFrameInfo>>> m_frame_cache;
+  mutable size_t m_frame_cache_size = 0;
 };
@@ -5,6 +5,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
+
+#include <xxhash.h>
 
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -21,6 +24,12 @@
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStructs.h"
 
+namespace
+{
+// Granularity at which overlapping memory updates are tracked
+constexpr u32 PAGE_SHIFT = 12;
+}  // namespace
+
 class FifoRecorder::FifoRecordAnalyzer : public OpcodeDecoder::Callback
 {
 public:
@@ -215,6 +224,10 @@ FifoRecorder::~FifoRecorder() = default;
 
 void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 {
+  // Let a previous recording finish before its state is reset. This must not hold m_mutex, as the
+  // worker thread needs it to store frames.
+  m_worker.Shutdown();
+
   std::lock_guard lk(m_mutex);
 
   m_File = std::make_unique<FifoDataFile>();
@@ -238,6 +251,15 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
   std::ranges::fill(m_Ram, 0);
   std::ranges::fill(m_ExRam, 0);
 
+  m_memory_ranges.clear();
+  m_page_generations.assign(((memory.GetRamSize() + memory.GetExRamSize()) >> PAGE_SHIFT) + 1, 0);
+  m_memory_generation = 0;
+  m_PendingMemoryUpdates.clear();
+  m_frames_in_flight = 0;
+
+  m_worker.Reset("FIFO Recorder",
+                 [this](PendingFrame pending_frame) { ProcessFrame(std::move(pending_frame)); });
+
   m_File->SetIsWii(m_system.IsWii());
 
   if (!m_IsRecording)
@@ -297,7 +319,7 @@ void FifoRecorder::StopRecording()
 
 bool FifoRecorder::IsRecordingDone() const
 {
-  return m_WasRecording && m_File != nullptr;
+  return m_WasRecording && m_File != nullptr && m_frames_in_flight.load() == 0;
 }
 
 FifoDataFile* FifoRecorder::GetRecordedFile() const
@@ -328,20 +350,22 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
 
   if (m_FrameEnded && !m_FifoData.empty())
   {
-    m_CurrentFrame.fifoData = m_FifoData;
+    PendingFrame pending_frame;
+    pending_frame.frame.fifoData = m_FifoData;
+    pending_frame.frame.fifoStart = m_CurrentFrame.fifoStart;
+    pending_frame.frame.fifoEnd = m_CurrentFrame.fifoEnd;
+    pending_frame.memory_updates = std::move(m_PendingMemoryUpdates);
 
     {
       std::lock_guard lk(m_mutex);
-
-      // Copy frame to file
-      // The file will be responsible for freeing the memory allocated for each frame's fifoData
-      m_File->AddFrame(m_CurrentFrame);
-
-      if (m_FinishedCb && m_RequestedRecordingEnd)
-        m_FinishedCb();
+      pending_frame.recording_finished = m_RequestedRecordingEnd;
     }
 
-    m_CurrentFrame.memoryUpdates.clear();
+    // The worker thread stores the frame in the file and calls the finished callback
+    ++m_frames_in_flight;
+    m_worker.Push(std::move(pending_frame));
+
+    m_PendingMemoryUpdates.clear();
     m_FifoData.clear();
     m_FrameEnded = false;
   }
@@ -351,40 +375,119 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
 
 void FifoRecorder::UseMemory(u32 address, u32 size, MemoryUpdate::Type type, bool dynamicUpdate)
 {
+  if (size == 0)
+    return;
+
   auto& memory = m_system.GetMemory();
 
-  u8* curData;
-  u8* newData;
+  const u8* newData;
   if (address & 0x10000000)
-  {
-    curData = &m_ExRam[address & memory.GetExRamMask()];
     newData = &memory.GetEXRAM()[address & memory.GetExRamMask()];
-  }
   else
-  {
-    curData = &m_Ram[address & memory.GetRamMask()];
     newData = &memory.GetRAM()[address & memory.GetRamMask()];
+
+  // Most ranges are referenced again every frame without being modified. Hashing them is much
+  // cheaper than copying them, so only ranges that changed are passed on to the worker thread.
+  const u64 hash = XXH3_64bits(newData, size);
+  if (!dynamicUpdate && !HasRangeChanged(address, size, hash))
+    return;
+
+  MarkRangeWritten(address, size, hash);
+
+  PendingMemoryUpdate& pending_update = m_PendingMemoryUpdates.emplace_back();
+  pending_update.dynamic_update = dynamicUpdate;
+
+  MemoryUpdate& memUpdate = pending_update.update;
+  memUpdate.address = address;
+  memUpdate.fifoPosition = (u32)(m_FifoData.size());
+  memUpdate.type = type;
+  memUpdate.data.assign(newData, newData + size);
+}
+
+u8* FifoRecorder::GetShadowMemory(u32 address)
+{
+  auto& memory = m_system.GetMemory();
+
+  if (address & 0x10000000)
+    return &m_ExRam[address & memory.GetExRamMask()];
+  else
+    return &m_Ram[address & memory.GetRamMask()];
+}
+
+u32 FifoRecorder::GetPageIndex(u32 address) const
+{
+  auto& memory = m_system.GetMemory();
+
+  if (address & 0x10000000)
+    return ((address & memory.GetExRamMask()) + memory.GetRamSize()) >> PAGE_SHIFT;
+  else
+    return (address & memory.GetRamMask()) >> PAGE_SHIFT;
+}
+
+bool FifoRecorder::HasRangeChanged(u32 address, u32 size, u64 hash) const
+{
+  const auto it = m_memory_ranges.find(u64(address) << 32 | size);
+  if (it == m_memory_ranges.end() || it->second.hash != hash)
+    return true;
+
+  // If an overlapping range was written since this range was last seen, the player's copy of this
+  // range may differ from what it was back then, even though the hash matches.
+  const u32 first_page = GetPageIndex(address);
+  const u32 last_page = GetPageIndex(address + size - 1);
+  for (u32 page = first_page; page <= last_page; ++page)
+  {
+    if (m_page_generations[page] > it->second.generation)
+      return true;
   }
 
-  if (!dynamicUpdate && memcmp(curData, newData, size) != 0)
+  return false;
+}
+
+void FifoRecorder::MarkRangeWritten(u32 address, u32 size, u64 hash)
+{
+  ++m_memory_generation;
+
+  const u32 first_page = GetPageIndex(address);
+  const u32 last_page = GetPageIndex(address + size - 1);
+  for (u32 page = first_page; page <= last_page; ++page)
+    m_page_generations[page] = m_memory_generation;
+
+  m_memory_ranges[u64(address) << 32 | size] = {hash, m_memory_generation};
+}
+
+void FifoRecorder::ProcessFrame(PendingFrame pending_frame)
+{
+  FifoFrameInfo& frame = pending_frame.frame;
+
+  for (PendingMemoryUpdate& pending_update : pending_frame.memory_updates)
   {
-    // Update current memory
-    memcpy(curData, newData, size);
-
-    // Record memory update
-    MemoryUpdate memUpdate;
-    memUpdate.address = address;
-    memUpdate.fifoPosition = (u32)(m_FifoData.size());
-    memUpdate.type = type;
-    memUpdate.data.resize(size);
-    std::copy_n(newData, size, memUpdate.data.begin());
-
-    m_CurrentFrame.memoryUpdates.push_back(std::move(memUpdate));
+    MemoryUpdate& memUpdate = pending_update.update;
+    u8* curData = GetShadowMemory(memUpdate.address);
+    const size_t size = memUpdate.data.size();
+
+    if (pending_update.dynamic_update)
+    {
+      // Shadow the data so it won't be recorded as changed by a future UseMemory
+      memcpy(curData, memUpdate.data.data(), size);
+    }
+    else if (memcmp(curData, memUpdate.data.data(), size) != 0)
+    {
+      // Update current memory
+      memcpy(curData, memUpdate.data.data(), size);
+
+      // Record memory update
+      frame.memoryUpdates.push_back(std::move(memUpdate));
+    }
   }
-  else if (dynamicUpdate)
+
   {
-    // Shadow the data so it won't be recorded as changed by a future UseMemory
-    memcpy(curData, newData, size);
+    std::lock_guard lk(m_mutex);
+
+    m_File->AddFrame(std::move(frame));
+    --m_frames_in_flight;
+
+    if (m_FinishedCb && pending_frame.recording_finished)
+      m_FinishedCb();
   }
 }
 
@@ -3,13 +3,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/HookableEvent.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 
 namespace Core
@@ -60,8 +63,37 @@ public:
 private:
   class FifoRecordAnalyzer;
 
+  // A memory range that was referenced and copied by the video thread. Whether it actually changed
+  // is decided by the worker thread.
+  struct PendingMemoryUpdate
+  {
+    MemoryUpdate update;
+    bool dynamic_update = false;
+  };
+
+  struct PendingFrame
+  {
+    FifoFrameInfo frame;
+    std::vector<PendingMemoryUpdate> memory_updates;
+    bool recording_finished = false;
+  };
+
+  // The contents of a memory range the last time it was referenced.
+  struct MemoryRangeState
+  {
+    u64 hash = 0;
+    u32 generation = 0;
+  };
+
   void RecordInitialVideoMemory();
 
+  u8* GetShadowMemory(u32 address);
+  u32 GetPageIndex(u32 address) const;
+  bool HasRangeChanged(u32 address, u32 size, u64 hash) const;
+  void MarkRangeWritten(u32 address, u32 size, u64 hash);
+
+  void ProcessFrame(PendingFrame pending_frame);
+
   // Accessed from both GUI and video threads
 
   std::recursive_mutex m_mutex;
@@ -73,6 +105,8 @@ private:
   s32 m_RecordFramesRemaining = 0;
   CallbackFunc m_FinishedCb;
   std::unique_ptr<FifoDataFile> m_File;
+  // Frames that were handed to the worker thread but aren't in m_File yet
+  std::atomic<u32> m_frames_in_flight = 0;
 
   // Accessed only from video thread
 
@@ -80,12 +114,26 @@ private:
   bool m_SkipFutureData = true;
   bool m_FrameEnded = false;
   FifoFrameInfo m_CurrentFrame;
+  std::vector<PendingMemoryUpdate> m_PendingMemoryUpdates;
   std::unique_ptr<FifoRecordAnalyzer> m_record_analyzer;
   std::vector<u8> m_FifoData;
+  // Keyed by address and size of the range
+  std::unordered_map<u64, MemoryRangeState> m_memory_ranges;
+  // Generation of the last memory update that touched each page of RAM and EXRAM
+  std::vector<u32> m_page_generations;
+  u32 m_memory_generation = 0;
+
+  // Accessed only from the worker thread
+
+  // Copy of emulated memory as it will be when the recorded updates are played back
   std::vector<u8> m_Ram;
   std::vector<u8> m_ExRam;
 
   Common::EventHook m_end_of_frame_event;
 
   Core::System& m_system;
+
+  // Compares memory updates against the shadow memory and stores the finished frames, so the video
+  // thread only has to hash referenced memory. Declared last so it is stopped first.
+  Common::WorkQueueThread<PendingFrame> m_worker;
 };
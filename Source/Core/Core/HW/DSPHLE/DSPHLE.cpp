@@ -6,6 +6,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Common/TimelineTrace.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -50,7 +51,10 @@ void DSPHLE::Shutdown()
 void DSPHLE::DSP_Update(int cycles)
 {
   if (m_ucode != nullptr)
+  {
+    TIMELINE_TRACE_SCOPE("DSP HLE");
     m_ucode->Update();
+  }
 }
 
 u32 DSPHLE::DSP_UpdateRate()
@@ -15,6 +15,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/Thread.h"
+#include "Common/TimelineTrace.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -66,6 +67,7 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
       std::unique_lock dsp_thread_lock(dsp_lle->m_dsp_thread_mutex, std::try_to_lock);
       if (dsp_thread_lock)
       {
+        TIMELINE_TRACE_SCOPE("DSP LLE");
         if (dsp_lle->m_dsp_core.IsJITCreated())
         {
           dsp_lle->m_dsp_core.RunCycles(cycles);
@@ -271,12 +273,16 @@ void DSPLLE::DSP_Update(int cycles)
   if (!m_is_dsp_on_thread)
   {
     // ~1/6th as many cycles as the period PPC-side.
+    TIMELINE_TRACE_SCOPE("DSP LLE");
     m_dsp_core.RunCycles(dsp_cycles);
   }
   else
   {
     // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
+    {
+      TIMELINE_TRACE_SCOPE("DSP wait");
+      m_ppc_event.Wait();
+    }
     m_cycle_count.fetch_add(dsp_cycles);
     m_dsp_event.Set();
   }
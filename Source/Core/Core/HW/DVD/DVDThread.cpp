@@ -14,6 +14,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
+#include "Common/TimelineTrace.h"
 #include "Common/Timer.h"
 
 #include "Core/ConfigManager.h"
@@ -295,6 +296,7 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
 
 void DVDThread::ProcessReadRequest(ReadRequest&& request)
 {
+  TIMELINE_TRACE_SCOPE("DVD read");
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
   std::vector<u8> buffer(request.length);
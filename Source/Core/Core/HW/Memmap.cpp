@@ -155,6 +155,9 @@ void MemoryManager::Init()
 
   Clear();
 
+  m_write_tracker.Init(GetRamSize(), m_exram ? GetExRamSize() : 0);
+  UpdateWriteTrackerViews();
+
   INFO_LOG_FMT(MEMMAP, "Memory system initialized. RAM at {}", fmt::ptr(m_ram));
   m_is_initialized = true;
 }
@@ -230,11 +233,15 @@ bool MemoryManager::InitFastmemArena()
 
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
+  UpdateWriteTrackerViews();
   return true;
 }
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // Stop tracking writes until the new views are in place.
+  m_write_tracker.SetViews({});
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -294,7 +301,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -303,6 +310,42 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
       }
     }
   }
+
+  UpdateWriteTrackerViews();
+}
+
+void MemoryManager::UpdateWriteTrackerViews()
+{
+  // Only MEM1 and MEM2 are tracked, but through every view the CPU and the emulated hardware might
+  // write to them.
+  const auto is_tracked = [this](u32 physical_address) {
+    return (m_ram && physical_address < GetRamSize()) ||
+           (m_exram && physical_address >= 0x10000000 &&
+            physical_address - 0x10000000 < GetExRamSize());
+  };
+
+  std::vector<WriteTracker::View> views;
+  for (const PhysicalMemoryRegion& region : m_physical_regions)
+  {
+    if (!region.active || !is_tracked(region.physical_address))
+      continue;
+
+    views.push_back({*region.out_pointer, region.physical_address, region.size});
+    if (m_is_fastmem_arena_initialized)
+      views.push_back({m_physical_base + region.physical_address, region.physical_address,
+                       region.size});
+  }
+
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    if (is_tracked(entry.physical_address))
+    {
+      views.push_back(
+          {static_cast<u8*>(entry.mapped_pointer), entry.physical_address, entry.mapped_size});
+    }
+  }
+
+  m_write_tracker.SetViews(std::move(views));
 }
 
 void MemoryManager::DoState(PointerWrap& p)
@@ -343,6 +386,9 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
+  if (p.IsReadMode())
+    m_write_tracker.Reset();
+
   p.DoArray(m_ram, current_ram_size);
   p.DoArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
@@ -357,6 +403,7 @@ void MemoryManager::DoState(PointerWrap& p)
 void MemoryManager::Shutdown()
 {
   ShutdownFastmemArena();
+  m_write_tracker.Shutdown();
 
   m_is_initialized = false;
   for (const PhysicalMemoryRegion& region : m_physical_regions)
@@ -377,6 +424,8 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  m_write_tracker.SetViews({});
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -400,6 +449,7 @@ void MemoryManager::ShutdownFastmemArena()
   m_logical_base = nullptr;
 
   m_is_fastmem_arena_initialized = false;
+  UpdateWriteTrackerViews();
 }
 
 void MemoryManager::Clear()
@@ -435,6 +485,12 @@ u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
   return span.data();
 }
 
+u8* MemoryManager::GetPointerForSyscallWrite(u32 address, size_t size)
+{
+  m_write_tracker.MarkWritten(address, static_cast<u32>(size));
+  return GetPointerForRange(address, size);
+}
+
 void MemoryManager::CopyFromEmu(void* data, u32 address, size_t size) const
 {
   if (size == 0)
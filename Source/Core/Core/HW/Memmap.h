@@ -13,6 +13,7 @@
 #include "Common/MathUtil.h"
 #include "Common/MemArena.h"
 #include "Common/Swap.h"
+#include "Core/HW/WriteTracker.h"
 #include "Core/PowerPC/MMU.h"
 
 // Global declarations
@@ -54,6 +55,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -91,6 +93,8 @@ public:
 
   MMIO::Mapping* GetMMIOMapping() const { return m_mmio_mapping.get(); }
 
+  WriteTracker& GetWriteTracker() { return m_write_tracker; }
+
   // Init and Shutdown
   bool IsInitialized() const { return m_is_initialized; }
   void Init();
@@ -116,6 +120,10 @@ public:
   // of the corresponding range in host memory. Otherwise, returns nullptr.
   u8* GetPointerForRange(u32 address, size_t size) const;
 
+  // Like GetPointerForRange, for when the range is written by a system call (e.g. reading a file
+  // into guest memory). Such writes can't be seen by the write tracker and must be announced.
+  u8* GetPointerForSyscallWrite(u32 address, size_t size);
+
   void CopyFromEmu(void* data, u32 address, size_t size) const;
   void CopyToEmu(u32 address, const void* data, size_t size);
   void Memset(u32 address, u8 value, size_t size);
@@ -252,8 +260,11 @@ private:
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  WriteTracker m_write_tracker;
+
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  void UpdateWriteTrackerViews();
 };
 }  // namespace Memory
@@ -889,6 +889,7 @@ void VideoInterfaceManager::EndField(FieldType field, u64 ticks)
   // If the user actually wants the data, we'll Throttle to make the numbers nice.
   const bool is_vblank_data_wanted = g_ActiveConfig.bShowVPS || g_ActiveConfig.bShowVTimes ||
                                      g_ActiveConfig.bLogRenderTimeToFile ||
+                                     g_ActiveConfig.bLogPerformanceMetricsToFile ||
                                      g_ActiveConfig.bShowGraphs;
   if (is_vblank_data_wanted)
     m_system.GetCoreTiming().Throttle(ticks);
@@ -0,0 +1,402 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/WriteTracker.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <utility>
+
+#include "Common/CommonFuncs.h"
+#include "Common/MsgHandler.h"
+#include "Core/MemTools.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Memory
+{
+namespace
+{
+constexpr u32 EXRAM_PHYSICAL_ADDRESS = 0x10000000;
+
+std::size_t GetHostPageSize()
+{
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwPageSize;
+#else
+  return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Unlike Common::WriteProtectMemory, this doesn't show an alert on failure, which would block
+// while the lock is held, and isn't safe in the exception handler at all.
+bool SetWriteProtection(u8* pointer, std::size_t size, bool protect)
+{
+#ifdef _WIN32
+  DWORD old_protect;
+  return VirtualProtect(pointer, size, protect ? PAGE_READONLY : PAGE_READWRITE, &old_protect) != 0;
+#else
+  return mprotect(pointer, size, protect ? PROT_READ : PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+u32 GetLastErrorCode()
+{
+#ifdef _WIN32
+  return GetLastError();
+#else
+  return static_cast<u32>(errno);
+#endif
+}
+}  // namespace
+
+// The exception handler can't allocate memory or take a regular mutex, so everything is guarded by
+// a spinlock. It's never held for long, and there is little contention.
+WriteTracker::ScopedLock::ScopedLock(std::atomic_flag& lock) : m_lock(lock)
+{
+  while (m_lock.test_and_set(std::memory_order_acquire))
+  {
+  }
+}
+
+WriteTracker::ScopedLock::~ScopedLock()
+{
+  m_lock.clear(std::memory_order_release);
+}
+
+WriteTracker::WriteTracker() = default;
+
+WriteTracker::~WriteTracker() = default;
+
+bool WriteTracker::IsSupported()
+{
+#ifdef __APPLE__
+  // The Mach exception handler only catches faults on the CPU thread, and macOS on ARM doesn't let
+  // us change the protection of guest memory.
+  return false;
+#else
+  return EMM::IsExceptionHandlerSupported();
+#endif
+}
+
+void WriteTracker::Init(u32 ram_size, u32 exram_size)
+{
+  m_page_size = std::max<std::size_t>(GetHostPageSize(), 0x1000);
+  m_ram_size = ram_size;
+  m_exram_size = exram_size;
+  m_num_ram_pages = static_cast<u32>(ram_size / m_page_size);
+  m_num_pages = static_cast<u32>(m_num_ram_pages + exram_size / m_page_size);
+
+  m_sequence = 0;
+  m_last_write = std::make_unique<u64[]>(m_num_pages);
+  m_protected = std::make_unique<bool[]>(m_num_pages);
+}
+
+void WriteTracker::Shutdown()
+{
+  SetEnabled(false);
+  SetViews({});
+
+  m_last_write.reset();
+  m_protected.reset();
+  m_num_pages = 0;
+}
+
+void WriteTracker::SetEnabled(bool enabled)
+{
+  std::optional<ProtectionError> error;
+  {
+    ScopedLock lock(m_lock);
+    if (!enabled)
+      ResetLocked();
+    m_enabled.store(enabled && IsSupported(), std::memory_order_relaxed);
+    error = std::exchange(m_protection_error, std::nullopt);
+  }
+  ReportProtectionError(error);
+}
+
+void WriteTracker::SetViews(std::vector<View> views)
+{
+  std::optional<ProtectionError> error;
+  {
+    ScopedLock lock(m_lock);
+    ResetLocked();
+    m_views = std::move(views);
+    error = std::exchange(m_protection_error, std::nullopt);
+  }
+  ReportProtectionError(error);
+}
+
+std::optional<u64> WriteTracker::Watch(u32 address, u32 size)
+{
+  if (!IsEnabled())
+    return std::nullopt;
+
+  const std::optional<PageRange> range = GetPageRange(address, size);
+  if (!range)
+    return std::nullopt;
+
+  std::optional<u64> sequence;
+  std::optional<ProtectionError> error;
+  {
+    ScopedLock lock(m_lock);
+    sequence = WatchLocked(*range);
+    error = std::exchange(m_protection_error, std::nullopt);
+  }
+  ReportProtectionError(error);
+  return sequence;
+}
+
+std::optional<u64> WriteTracker::WatchLocked(PageRange range)
+{
+  if (!IsEnabled() || m_views.empty())
+    return std::nullopt;
+
+  const u64 sequence = m_sequence;
+  for (u32 page = range.first; page < range.end;)
+  {
+    if (m_protected[page])
+    {
+      page++;
+      continue;
+    }
+
+    PageRange run{page, page + 1};
+    while (run.end < range.end && !m_protected[run.end])
+      run.end++;
+
+    if (!ProtectPages(run, true))
+    {
+      ProtectPages(run, false);
+      return std::nullopt;
+    }
+    std::fill(&m_protected[run.first], &m_protected[run.end], true);
+    page = run.end;
+  }
+
+  return sequence;
+}
+
+bool WriteTracker::WasWritten(u32 address, u32 size, u64 sequence)
+{
+  const std::optional<PageRange> range = GetPageRange(address, size);
+  if (!range)
+    return true;
+
+  ScopedLock lock(m_lock);
+  for (u32 page = range->first; page < range->end; page++)
+  {
+    if (!m_protected[page] || m_last_write[page] > sequence)
+      return true;
+  }
+  return false;
+}
+
+void WriteTracker::MarkWritten(u32 address, u32 size)
+{
+  if (!IsEnabled())
+    return;
+
+  const std::optional<PageRange> range = GetPageRange(address, size);
+  if (!range)
+    return;
+
+  std::optional<ProtectionError> error;
+  {
+    ScopedLock lock(m_lock);
+    const u64 sequence = ++m_sequence;
+    for (u32 page = range->first; page < range->end; page++)
+    {
+      if (!m_protected[page])
+        continue;
+
+      ProtectPages({page, page + 1}, false);
+      m_protected[page] = false;
+      m_last_write[page] = sequence;
+    }
+    error = std::exchange(m_protection_error, std::nullopt);
+  }
+  ReportProtectionError(error);
+}
+
+void WriteTracker::Reset()
+{
+  std::optional<ProtectionError> error;
+  {
+    ScopedLock lock(m_lock);
+    ResetLocked();
+    error = std::exchange(m_protection_error, std::nullopt);
+  }
+  ReportProtectionError(error);
+}
+
+bool WriteTracker::HandleFault(uintptr_t fault_address)
+{
+  ScopedLock lock(m_lock);
+  for (const View& view : m_views)
+  {
+    const uintptr_t base = reinterpret_cast<uintptr_t>(view.base);
+    if (fault_address < base || fault_address - base >= view.size)
+      continue;
+
+    const u32 physical_address = view.physical_address + static_cast<u32>(fault_address - base);
+    const u32 offset = physical_address < EXRAM_PHYSICAL_ADDRESS ?
+                           physical_address :
+                           m_ram_size + (physical_address - EXRAM_PHYSICAL_ADDRESS);
+    const u32 page = static_cast<u32>(offset / m_page_size);
+
+    // If the page isn't protected anymore, another thread faulted on it at the same time and has
+    // already handled it. Unprotecting it again is harmless. If it can't be unprotected, the fault
+    // is left to the regular crash handling, as retrying would fault forever.
+    if (!UnprotectPagesInHandler({page, page + 1}))
+      return false;
+    m_protected[page] = false;
+    m_last_write[page] = ++m_sequence;
+    return true;
+  }
+
+  return false;
+}
+
+std::optional<WriteTracker::PageRange> WriteTracker::GetPageRange(u32 address, u32 size) const
+{
+  if (size == 0 || m_num_pages == 0)
+    return std::nullopt;
+
+  // Same address decoding as MemoryManager::GetSpanForAddress.
+  address &= 0x3FFFFFFF;
+  u32 offset;
+  u32 region_end;
+  if (address < m_ram_size)
+  {
+    offset = address;
+    region_end = m_ram_size;
+  }
+  else if ((address >> 28) == 0x1 && (address & 0x0FFFFFFF) < m_exram_size)
+  {
+    offset = m_ram_size + (address & 0x0FFFFFFF);
+    region_end = m_ram_size + m_exram_size;
+  }
+  else
+  {
+    return std::nullopt;
+  }
+
+  if (size > region_end - offset)
+    return std::nullopt;
+
+  return PageRange{static_cast<u32>(offset / m_page_size),
+                   static_cast<u32>((u64{offset} + size + m_page_size - 1) / m_page_size)};
+}
+
+u32 WriteTracker::GetPhysicalAddress(u32 page) const
+{
+  const u32 offset = static_cast<u32>(page * m_page_size);
+  if (offset < m_ram_size)
+    return offset;
+  return EXRAM_PHYSICAL_ADDRESS + (offset - m_ram_size);
+}
+
+template <typename Func>
+bool WriteTracker::ForEachMapping(PageRange range, Func func) const
+{
+  // MEM1 and MEM2 aren't contiguous in physical memory.
+  if (range.first < m_num_ram_pages && range.end > m_num_ram_pages)
+  {
+    const bool ram_result = ForEachMapping({range.first, m_num_ram_pages}, func);
+    return ForEachMapping({m_num_ram_pages, range.end}, func) && ram_result;
+  }
+
+  const u32 start = GetPhysicalAddress(range.first);
+  const u32 end = static_cast<u32>(start + (range.end - range.first) * m_page_size);
+  bool result = true;
+  for (const View& view : m_views)
+  {
+    const u32 intersection_start = std::max(start, view.physical_address);
+    const u32 intersection_end = std::min(end, view.physical_address + view.size);
+    if (intersection_start >= intersection_end)
+      continue;
+
+    result &= func(view.base + (intersection_start - view.physical_address),
+                   std::size_t{intersection_end - intersection_start});
+  }
+  return result;
+}
+
+bool WriteTracker::ProtectPages(PageRange range, bool protect)
+{
+  return ForEachMapping(range, [this, range, protect](u8* pointer, std::size_t size) {
+    if (SetWriteProtection(pointer, size, protect))
+      return true;
+
+    // Only the first failure is kept until it's reported.
+    if (!m_protection_error)
+    {
+      m_protection_error = ProtectionError{
+          .physical_address = GetPhysicalAddress(range.first),
+          .size = static_cast<u32>((range.end - range.first) * m_page_size),
+          .protect = protect,
+          .error_code = GetLastErrorCode(),
+      };
+    }
+    return false;
+  });
+}
+
+bool WriteTracker::UnprotectPagesInHandler(PageRange range)
+{
+  return ForEachMapping(range, [](u8* pointer, std::size_t size) {
+    return SetWriteProtection(pointer, size, false);
+  });
+}
+
+void WriteTracker::ReportProtectionError(const std::optional<ProtectionError>& error)
+{
+  if (!error)
+    return;
+
+#ifdef _WIN32
+  const std::string error_string = Common::GetWin32ErrorString(error->error_code);
+#else
+  const std::string error_string = Common::StrerrorString(static_cast<int>(error->error_code));
+#endif
+  PanicAlertFmt("Failed to {} guest memory at {:08x} ({} bytes): {}",
+                error->protect ? "write-protect" : "unprotect", error->physical_address,
+                error->size, error_string);
+}
+
+void WriteTracker::ResetLocked()
+{
+  if (m_num_pages == 0)
+    return;
+
+  // Writes to unprotected pages can't be seen, so they have to be considered written even if the
+  // page gets protected again later.
+  const u64 sequence = ++m_sequence;
+  for (u32 page = 0; page < m_num_pages;)
+  {
+    if (!m_protected[page])
+    {
+      page++;
+      continue;
+    }
+
+    PageRange run{page, page + 1};
+    while (run.end < m_num_pages && m_protected[run.end])
+      run.end++;
+
+    ProtectPages(run, false);
+    std::fill(&m_protected[run.first], &m_protected[run.end], false);
+    std::fill(&m_last_write[run.first], &m_last_write[run.end], sequence);
+    page = run.end;
+  }
+}
+}  // namespace Memory
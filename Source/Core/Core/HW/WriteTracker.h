@@ -0,0 +1,131 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Memory
+{
+// Tracks which pages of MEM1 and MEM2 have been written to, so that users like the texture cache
+// can tell that memory is unchanged without reading it again.
+//
+// Watching a range write-protects its pages in every host view of the guest memory. The first
+// write to such a page faults, gets recorded by HandleFault and unprotects the page again, so only
+// the first write after every Watch is slow.
+//
+// Writes done by the host OS (e.g. reading a file into guest memory) don't fault but fail instead,
+// so they must be announced with MarkWritten beforehand.
+class WriteTracker
+{
+public:
+  // A host mapping of physical guest memory.
+  struct View
+  {
+    u8* base;
+    u32 physical_address;
+    u32 size;
+  };
+
+  WriteTracker();
+  WriteTracker(const WriteTracker&) = delete;
+  WriteTracker(WriteTracker&&) = delete;
+  WriteTracker& operator=(const WriteTracker&) = delete;
+  WriteTracker& operator=(WriteTracker&&) = delete;
+  ~WriteTracker();
+
+  // Whether faults on all threads can be caught on this platform.
+  static bool IsSupported();
+
+  void Init(u32 ram_size, u32 exram_size);
+  void Shutdown();
+
+  // Must only be enabled while the exception handler is installed.
+  void SetEnabled(bool enabled);
+  bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  // Replaces the views to protect. All pages are considered written afterwards.
+  void SetViews(std::vector<View> views);
+
+  // Starts tracking writes to the given range of guest memory, and returns a sequence number to
+  // pass to WasWritten. The memory must be read after calling this. Returns std::nullopt if the
+  // range can't be tracked.
+  std::optional<u64> Watch(u32 address, u32 size);
+  // Returns whether the range might have been written since the call to Watch that returned
+  // sequence.
+  bool WasWritten(u32 address, u32 size, u64 sequence);
+
+  // Unprotects the range and records it as written.
+  void MarkWritten(u32 address, u32 size);
+  // Unprotects all memory and records it as written.
+  void Reset();
+
+  // Called by the exception handler. Returns true if the fault was caused by a protected page, in
+  // which case the faulting instruction can be retried.
+  bool HandleFault(uintptr_t fault_address);
+
+private:
+  struct PageRange
+  {
+    u32 first;
+    u32 end;
+  };
+
+  // A failure to change the protection of guest memory. It's recorded while the lock is held and
+  // reported after releasing it, since the alert blocks until it's dismissed, and the faulting
+  // threads would wait for the lock in the meantime.
+  struct ProtectionError
+  {
+    u32 physical_address;
+    u32 size;
+    bool protect;
+    u32 error_code;
+  };
+
+  class ScopedLock
+  {
+  public:
+    explicit ScopedLock(std::atomic_flag& lock);
+    ~ScopedLock();
+
+  private:
+    std::atomic_flag& m_lock;
+  };
+
+  std::optional<PageRange> GetPageRange(u32 address, u32 size) const;
+  u32 GetPhysicalAddress(u32 page) const;
+
+  std::optional<u64> WatchLocked(PageRange range);
+
+  // Calls func(pointer, size) for every part of every view that maps the pages.
+  template <typename Func>
+  bool ForEachMapping(PageRange range, Func func) const;
+  bool ProtectPages(PageRange range, bool protect);
+  // Same as ProtectPages(range, false), but safe to call from the exception handler.
+  bool UnprotectPagesInHandler(PageRange range);
+  void ResetLocked();
+  static void ReportProtectionError(const std::optional<ProtectionError>& error);
+
+  std::atomic_flag m_lock;
+  std::atomic<bool> m_enabled = false;
+
+  std::size_t m_page_size = 0;
+  u32 m_ram_size = 0;
+  u32 m_exram_size = 0;
+  u32 m_num_ram_pages = 0;
+
+  u64 m_sequence = 0;
+  std::unique_ptr<u64[]> m_last_write;
+  std::unique_ptr<bool[]> m_protected;
+  u32 m_num_pages = 0;
+
+  std::vector<View> m_views;
+  std::optional<ProtectionError> m_protection_error;
+};
+}  // namespace Memory
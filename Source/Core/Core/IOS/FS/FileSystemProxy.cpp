@@ -326,7 +326,7 @@ std::optional<IPCReply> FSDevice::Read(const ReadWriteRequest& request)
   return MakeIPCReply([&](Ticks t) {
     auto& system = GetSystem();
     auto& memory = system.GetMemory();
-    return m_core.Read(request.fd, memory.GetPointerForRange(request.buffer, request.size),
+    return m_core.Read(request.fd, memory.GetPointerForSyscallWrite(request.buffer, request.size),
                        request.size, request.buffer, t);
   });
 }
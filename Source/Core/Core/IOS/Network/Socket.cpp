@@ -649,7 +649,8 @@ void WiiSocket::Update(bool read, bool write, bool except)
           u32 flags = memory.Read_U32(BufferIn + 0x04);
           int data_len = BufferOutSize;
           // Not a string, Windows requires a char* for recvfrom
-          char* data = reinterpret_cast<char*>(memory.GetPointerForRange(BufferOut, BufferOutSize));
+          char* data =
+              reinterpret_cast<char*>(memory.GetPointerForSyscallWrite(BufferOut, BufferOutSize));
 
           sockaddr_in local_name;
           memset(&local_name, 0, sizeof(sockaddr_in));
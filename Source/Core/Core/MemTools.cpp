@@ -14,6 +14,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 
+#include "Core/HW/Memmap.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
@@ -61,7 +62,11 @@ static LONG NTAPI Handler(PEXCEPTION_POINTERS pPtrs)
     uintptr_t fault_address = (uintptr_t)pPtrs->ExceptionRecord->ExceptionInformation[1];
     SContext* ctx = pPtrs->ContextRecord;
 
-    if (Core::System::GetInstance().GetJitInterface().HandleFault(fault_address, ctx))
+    auto& system = Core::System::GetInstance();
+    if (system.GetMemory().GetWriteTracker().HandleFault(fault_address))
+      return EXCEPTION_CONTINUE_EXECUTION;
+
+    if (system.GetJitInterface().HandleFault(fault_address, ctx))
     {
       return EXCEPTION_CONTINUE_EXECUTION;
     }
@@ -276,6 +281,10 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
   }
   uintptr_t bad_address = (uintptr_t)info->si_addr;
 
+  auto& system = Core::System::GetInstance();
+  if (system.GetMemory().GetWriteTracker().HandleFault(bad_address))
+    return;
+
 // Get all the information we can out of the context.
 #ifdef __OpenBSD__
   ucontext_t* ctx = context;
@@ -283,13 +292,13 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
   mcontext_t* ctx = &context->uc_mcontext;
 #endif
   // assume it's not a write
-  if (!Core::System::GetInstance().GetJitInterface().HandleFault(bad_address,
+  if (!system.GetJitInterface().HandleFault(bad_address,
 #ifdef __APPLE__
-                                                                 *ctx
+                                            *ctx
 #else
-                                                                 ctx
+                                            ctx
 #endif
-                                                                 ))
+                                            ))
   {
     // retry and crash
     // According to the sigaction man page, if sa_flags "SA_SIGINFO" is set to the sigaction
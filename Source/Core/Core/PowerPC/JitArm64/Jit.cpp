@@ -20,6 +20,7 @@
 #include "Common/MathUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/TimelineTrace.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -944,6 +945,7 @@ void JitArm64::Jit(u32 em_address)
 
 void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TIMELINE_TRACE_SCOPE("JIT compile");
   CleanUpAfterStackFault();
 
   if (SConfig::GetInstance().bJITNoBlockCache)
@@ -53,6 +53,9 @@ void AdvancedWidget::CreateWidgets()
 
   m_log_render_time = new ConfigBool(tr("Log Render Time to File"),
                                      Config::GFX_LOG_RENDER_TIME_TO_FILE, m_game_layer);
+  m_log_performance_metrics =
+      new ConfigBool(tr("Log Performance Metrics to File"),
+                     Config::GFX_LOG_PERFORMANCE_METRICS_TO_FILE, m_game_layer);
 
   m_enable_wireframe =
       new ConfigBool(tr("Enable Wireframe"), Config::GFX_ENABLE_WIREFRAME, m_game_layer);
@@ -65,6 +68,7 @@ void AdvancedWidget::CreateWidgets()
   debugging_layout->addWidget(m_enable_format_overlay, 0, 1);
   debugging_layout->addWidget(m_enable_api_validation, 1, 0);
   debugging_layout->addWidget(m_log_render_time, 1, 1);
+  debugging_layout->addWidget(m_log_performance_metrics, 2, 0);
 
   // Utility
   auto* utility_box = new QGroupBox(tr("Utility"));
@@ -76,6 +80,12 @@ void AdvancedWidget::CreateWidgets()
   m_prefetch_custom_textures = new ConfigBool(tr("Prefetch Custom Textures"),
                                               Config::GFX_CACHE_HIRES_TEXTURES, m_game_layer);
   m_prefetch_custom_textures->setEnabled(m_load_custom_textures->isChecked());
+  m_custom_textures_memory_budget = new ConfigInteger(
+      0, 1024 * 1024, Config::GFX_HIRES_TEXTURES_MEMORY_BUDGET, m_game_layer, 256);
+  m_custom_textures_memory_budget->setEnabled(m_load_custom_textures->isChecked());
+  m_custom_textures_vram_budget =
+      new ConfigInteger(0, 1024 * 1024, Config::GFX_HIRES_TEXTURES_VRAM_BUDGET, m_game_layer, 256);
+  m_custom_textures_vram_budget->setEnabled(m_load_custom_textures->isChecked());
   m_dump_efb_target = new ConfigBool(tr("Dump EFB Target"), Config::GFX_DUMP_EFB_TARGET);
   m_dump_xfb_target = new ConfigBool(tr("Dump XFB Target"), Config::GFX_DUMP_XFB_TARGET);
 
@@ -100,6 +110,13 @@ void AdvancedWidget::CreateWidgets()
   utility_layout->addWidget(m_dump_efb_target, 2, 0);
   utility_layout->addWidget(m_dump_xfb_target, 2, 1);
 
+  utility_layout->addWidget(new QLabel(tr("Custom Texture Memory (MiB):")), 3, 0);
+  m_custom_textures_memory_budget->SetTitle(tr("Custom Texture Memory"));
+  utility_layout->addWidget(m_custom_textures_memory_budget, 3, 1);
+  utility_layout->addWidget(new QLabel(tr("Custom Texture VRAM (MiB):")), 4, 0);
+  m_custom_textures_vram_budget->SetTitle(tr("Custom Texture VRAM"));
+  utility_layout->addWidget(m_custom_textures_vram_budget, 4, 1);
+
   // Texture dumping
   auto* texture_dump_box = new QGroupBox(tr("Texture Dumping"));
   auto* texture_dump_layout = new QGridLayout();
@@ -188,11 +205,18 @@ void AdvancedWidget::CreateWidgets()
 
   m_defer_efb_access_invalidation = new ConfigBool(
       tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION, m_game_layer);
+  m_predictive_efb_access = new ConfigBool(tr("Predictive EFB Access"),
+                                           Config::GFX_HACK_EFB_ACCESS_PREDICTIVE, m_game_layer);
   m_manual_texture_sampling = new ConfigBool(
       tr("Manual Texture Sampling"), Config::GFX_HACK_FAST_TEXTURE_SAMPLING, m_game_layer, true);
 
+  m_geometry_cache = new ConfigBool(tr("Cache Display List Geometry"),
+                                    Config::GFX_HACK_GEOMETRY_CACHE, m_game_layer);
+
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
   experimental_layout->addWidget(m_manual_texture_sampling, 0, 1);
+  experimental_layout->addWidget(m_geometry_cache, 1, 0);
+  experimental_layout->addWidget(m_predictive_efb_access, 1, 1);
 
   main_layout->addWidget(debugging_box);
   main_layout->addWidget(utility_box);
@@ -208,7 +232,11 @@ void AdvancedWidget::CreateWidgets()
 void AdvancedWidget::ConnectWidgets()
 {
   connect(m_load_custom_textures, &QCheckBox::toggled, this,
-          [this](bool checked) { m_prefetch_custom_textures->setEnabled(checked); });
+          [this](bool checked) {
+            m_prefetch_custom_textures->setEnabled(checked);
+            m_custom_textures_memory_budget->setEnabled(checked);
+            m_custom_textures_vram_budget->setEnabled(checked);
+          });
   connect(m_dump_textures, &QCheckBox::toggled, this, [this](bool checked) {
     m_dump_mip_textures->setEnabled(checked);
     m_dump_base_textures->setEnabled(checked);
@@ -252,6 +280,13 @@ void AdvancedWidget::AddDescriptions()
       "Logs the render time of every frame to User/Logs/render_time.txt.<br><br>Use this "
       "feature to measure Dolphin's performance.<br><br><dolphin_emphasis>If "
       "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_LOG_PERFORMANCE_METRICS_DESCRIPTION[] = QT_TR_NOOP(
+      "Logs the performance metrics once per second to "
+      "User/Logs/performance_metrics_&lt;game_id&gt;_&lt;time&gt;.json, with one JSON object "
+      "per line. Every session is logged to a new file.<br><br>This includes frame time percentiles, a histogram "
+      "of the latency from the emulated VI to the present, and the shader compilation and "
+      "texture decoding stalls.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_DUMP_TEXTURE_DESCRIPTION[] =
       QT_TR_NOOP("Dumps decoded game textures based on the other flags to "
                  "User/Dump/Textures/&lt;game_id&gt;/.<br><br><dolphin_emphasis>If unsure, leave "
@@ -271,9 +306,20 @@ void AdvancedWidget::AddDescriptions()
                  "User/Load/DynamicInputTextures/&lt;game_id&gt;/.<br><br><dolphin_emphasis>If "
                  "unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_CACHE_CUSTOM_TEXTURE_DESCRIPTION[] = QT_TR_NOOP(
-      "Caches custom textures to system RAM on startup.<br><br>This can require exponentially "
-      "more RAM but fixes possible stuttering.<br><br><dolphin_emphasis>If unsure, leave this "
-      "unchecked.</dolphin_emphasis>");
+      "Loads custom textures to system RAM on startup, until the custom texture memory limit is "
+      "reached.<br><br>This can require exponentially more RAM but fixes possible "
+      "stuttering.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_CUSTOM_TEXTURE_MEMORY_DESCRIPTION[] = QT_TR_NOOP(
+      "Limits how much system RAM loaded custom textures can take up. Textures are loaded in the "
+      "background when the game first uses them, and the least recently used ones are unloaded "
+      "when the limit is reached. The original texture is shown until the custom one is "
+      "loaded.<br><br>A value of 0 uses up to half of the system RAM.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this at 0.</dolphin_emphasis>");
+  static const char TR_CUSTOM_TEXTURE_VRAM_DESCRIPTION[] = QT_TR_NOOP(
+      "Limits how much video memory custom textures can take up. When the limit is reached, the "
+      "custom textures that were used least recently are removed from video memory.<br><br>A "
+      "value of 0 doesn't limit video memory usage.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this at 0.</dolphin_emphasis>");
   static const char TR_DUMP_EFB_DESCRIPTION[] =
       QT_TR_NOOP("Dumps the contents of EFB copies to User/Dump/Textures/.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -346,6 +392,12 @@ void AdvancedWidget::AddDescriptions()
       "<br><br>May improve performance in some games which rely on CPU EFB Access at the cost "
       "of stability.<br><br><dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_PREDICTIVE_EFB_ACCESS_DESCRIPTION[] = QT_TR_NOOP(
+      "Remembers which parts of the EFB the CPU read in the last frame, and starts copying them "
+      "from the GPU right after the same draw call in the next frame, so the reads don't have to "
+      "wait for the GPU.<br><br>May improve performance in games which rely on CPU EFB Access, at "
+      "the cost of extra copies when the game's reads change between frames.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION[] = QT_TR_NOOP(
       "Use a manual implementation of texture sampling instead of the graphics backend's built-in "
       "functionality.<br><br>"
@@ -357,6 +409,12 @@ void AdvancedWidget::AddDescriptions()
       "resolutions.<br><br>If this setting is enabled, the Texture Filtering setting will be "
       "disabled."
       "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_GEOMETRY_CACHE_DESCRIPTION[] = QT_TR_NOOP(
+      "Reuses the converted vertices of display lists that are drawn again with the same vertex "
+      "data, vertex format and vertex arrays, instead of converting them again.<br><br>"
+      "May improve performance in games that draw most of their geometry through display lists, "
+      "at the cost of some memory.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
 #ifdef _WIN32
   static const char TR_BORDERLESS_FULLSCREEN_DESCRIPTION[] = QT_TR_NOOP(
@@ -374,11 +432,14 @@ void AdvancedWidget::AddDescriptions()
   m_enable_format_overlay->SetDescription(tr(TR_TEXTURE_FORMAT_DESCRIPTION));
   m_enable_api_validation->SetDescription(tr(TR_VALIDATION_LAYER_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
+  m_log_performance_metrics->SetDescription(tr(TR_LOG_PERFORMANCE_METRICS_DESCRIPTION));
   m_dump_textures->SetDescription(tr(TR_DUMP_TEXTURE_DESCRIPTION));
   m_dump_mip_textures->SetDescription(tr(TR_DUMP_MIP_TEXTURE_DESCRIPTION));
   m_dump_base_textures->SetDescription(tr(TR_DUMP_BASE_TEXTURE_DESCRIPTION));
   m_load_custom_textures->SetDescription(tr(TR_LOAD_CUSTOM_TEXTURE_DESCRIPTION));
   m_prefetch_custom_textures->SetDescription(tr(TR_CACHE_CUSTOM_TEXTURE_DESCRIPTION));
+  m_custom_textures_memory_budget->SetDescription(tr(TR_CUSTOM_TEXTURE_MEMORY_DESCRIPTION));
+  m_custom_textures_vram_budget->SetDescription(tr(TR_CUSTOM_TEXTURE_VRAM_DESCRIPTION));
   m_dump_efb_target->SetDescription(tr(TR_DUMP_EFB_DESCRIPTION));
   m_dump_xfb_target->SetDescription(tr(TR_DUMP_XFB_DESCRIPTION));
   m_disable_vram_copies->SetDescription(tr(TR_DISABLE_VRAM_COPIES_DESCRIPTION));
@@ -407,5 +468,7 @@ void AdvancedWidget::AddDescriptions()
   m_borderless_fullscreen->SetDescription(tr(TR_BORDERLESS_FULLSCREEN_DESCRIPTION));
 #endif
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
+  m_predictive_efb_access->SetDescription(tr(TR_PREDICTIVE_EFB_ACCESS_DESCRIPTION));
   m_manual_texture_sampling->SetDescription(tr(TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION));
+  m_geometry_cache->SetDescription(tr(TR_GEOMETRY_CACHE_DESCRIPTION));
 }
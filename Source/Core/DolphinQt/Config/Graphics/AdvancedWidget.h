@@ -33,6 +33,7 @@ private:
   ConfigBool* m_enable_format_overlay;
   ConfigBool* m_enable_api_validation;
   ConfigBool* m_log_render_time;
+  ConfigBool* m_log_performance_metrics;
 
   // Utility
   ConfigBool* m_prefetch_custom_textures;
@@ -41,6 +42,8 @@ private:
   ConfigBool* m_disable_vram_copies;
   ConfigBool* m_load_custom_textures;
   ConfigBool* m_enable_graphics_mods;
+  ConfigInteger* m_custom_textures_memory_budget;
+  ConfigInteger* m_custom_textures_vram_budget;
 
   // Texture dumping
   ConfigBool* m_dump_textures;
@@ -63,7 +66,9 @@ private:
 
   // Experimental
   ConfigBool* m_defer_efb_access_invalidation;
+  ConfigBool* m_predictive_efb_access;
   ConfigBool* m_manual_texture_sampling;
+  ConfigBool* m_geometry_cache;
 
   Config::Layer* m_game_layer = nullptr;
 };
@@ -138,6 +138,9 @@ void GeneralWidget::CreateWidgets()
   m_wait_for_shaders = new ConfigBool(tr("Compile Shaders Before Starting"),
                                       Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING, m_game_layer);
   shader_compilation_layout->addWidget(m_wait_for_shaders);
+  m_specialize_ubershaders = new ConfigBool(tr("Specialize Ubershaders"),
+                                            Config::GFX_SPECIALIZE_UBERSHADERS, m_game_layer);
+  shader_compilation_layout->addWidget(m_specialize_ubershaders);
   shader_compilation_box->setLayout(shader_compilation_layout);
 
   main_layout->addWidget(m_video_box);
@@ -288,6 +291,12 @@ void GeneralWidget::AddDescriptions()
                  "two or fewer cores, it is recommended to enable this option, as a large shader "
                  "queue may reduce frame rates.<br><br><dolphin_emphasis>Otherwise, if "
                  "unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SPECIALIZE_UBERSHADERS_DESCRIPTION[] = QT_TR_NOOP(
+      "Compiles variants of the ubershaders for the number of TEV stages, alpha testing and "
+      "lighting of each draw, in the background and before starting for the shaders the game is "
+      "known to use. The generic ubershaders are used until they are ready.<br><br>Improves "
+      "performance in the ubershader modes on slower GPUs, at the cost of more shader "
+      "compilation.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
   m_backend_combo->SetTitle(tr("Backend"));
   m_backend_combo->SetDescription(
@@ -319,6 +328,7 @@ void GeneralWidget::AddDescriptions()
   m_shader_compilation_mode[3]->SetDescription(tr(TR_SHADER_COMPILE_SKIP_DRAWING_DESCRIPTION));
 
   m_wait_for_shaders->SetDescription(tr(TR_SHADER_COMPILE_BEFORE_START_DESCRIPTION));
+  m_specialize_ubershaders->SetDescription(tr(TR_SPECIALIZE_UBERSHADERS_DESCRIPTION));
 }
 
 void GeneralWidget::OnBackendChanged(const QString& backend_name)
@@ -57,6 +57,7 @@ private:
 
   std::array<ConfigRadioInt*, 4> m_shader_compilation_mode{};
   ConfigBool* m_wait_for_shaders;
+  ConfigBool* m_specialize_ubershaders;
   int m_previous_backend = 0;
   Config::Layer* m_game_layer = nullptr;
 };
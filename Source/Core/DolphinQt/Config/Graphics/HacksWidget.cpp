@@ -62,6 +62,8 @@ void HacksWidget::CreateWidgets()
       new ConfigSlider({0, 512, 128}, Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES, m_game_layer);
   m_gpu_texture_decoding = new ConfigBool(tr("GPU Texture Decoding"),
                                           Config::GFX_ENABLE_GPU_TEXTURE_DECODING, m_game_layer);
+  m_track_memory_writes = new ConfigBool(tr("Track Memory Writes"),
+                                         Config::GFX_TEXTURE_CACHE_WRITE_TRACKING, m_game_layer);
 
   auto* safe_label = new QLabel(tr("Safe"));
   safe_label->setAlignment(Qt::AlignRight);
@@ -73,6 +75,7 @@ void HacksWidget::CreateWidgets()
   texture_cache_layout->addWidget(m_accuracy, 0, 2);
   texture_cache_layout->addWidget(new QLabel(tr("Fast")), 0, 3);
   texture_cache_layout->addWidget(m_gpu_texture_decoding, 1, 0);
+  texture_cache_layout->addWidget(m_track_memory_writes, 1, 2);
 
   // XFB
   auto* xfb_box = new QGroupBox(tr("External Frame Buffer (XFB)"));
@@ -217,6 +220,12 @@ void HacksWidget::AddDescriptions()
       "bottleneck.<br><br>If this setting is enabled, Arbitrary Mipmap Detection will be "
       "disabled.<br><br>"
       "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_TRACK_MEMORY_WRITES_DESCRIPTION[] = QT_TR_NOOP(
+      "Detects writes to emulated memory using page protection, so that textures which haven't "
+      "been written to don't need to be hashed again. Gives the same results as without this "
+      "setting.<br><br>This may improve performance in games which use many large textures, but "
+      "can reduce it in games which update textures every frame. Not supported on macOS."
+      "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_FAST_DEPTH_CALC_DESCRIPTION[] = QT_TR_NOOP(
       "Uses a less accurate algorithm to calculate depth values.<br><br>Causes issues in a few "
       "games, but can result in a decent speed increase depending on the game and/or "
@@ -254,6 +263,7 @@ void HacksWidget::AddDescriptions()
   m_immediate_xfb->SetDescription(tr(TR_IMMEDIATE_XFB_DESCRIPTION));
   m_skip_duplicate_xfbs->SetDescription(tr(TR_SKIP_DUPLICATE_XFBS_DESCRIPTION));
   m_gpu_texture_decoding->SetDescription(tr(TR_GPU_DECODING_DESCRIPTION));
+  m_track_memory_writes->SetDescription(tr(TR_TRACK_MEMORY_WRITES_DESCRIPTION));
   m_fast_depth_calculation->SetDescription(tr(TR_FAST_DEPTH_CALC_DESCRIPTION));
   m_disable_bounding_box->SetDescription(tr(TR_DISABLE_BOUNDINGBOX_DESCRIPTION));
   m_save_texture_cache_state->SetDescription(tr(TR_SAVE_TEXTURE_CACHE_TO_STATE_DESCRIPTION));
@@ -34,6 +34,7 @@ private:
   ConfigSliderLabel* m_accuracy_label;
   ConfigSlider* m_accuracy;
   ConfigBool* m_gpu_texture_decoding;
+  ConfigBool* m_track_memory_writes;
 
   // External Framebuffer
   ConfigBool* m_store_xfb_copies;
@@ -16,6 +16,7 @@
 #include <QMap>
 #include <QUrl>
 
+#include <fmt/chrono.h>
 #include <fmt/format.h>
 
 #include "Common/Align.h"
@@ -23,6 +24,8 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/StringUtil.h"
+#include "Common/TimeUtil.h"
+#include "Common/TimelineTrace.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CommonTitles.h"
@@ -241,6 +244,30 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnTimelineTraceToggled(bool enabled)
+{
+  if (enabled)
+  {
+    Common::TimelineTrace::Start();
+    return;
+  }
+
+  Common::TimelineTrace::Stop();
+  const std::string filename =
+      fmt::format("{}timeline_{} {:%Y-%m-%d %Hh%Mm%Ss}.json", File::GetUserPath(D_DUMPDEBUG_IDX),
+                  SConfig::GetInstance().GetGameID(), *Common::LocalTime(std::time(nullptr)));
+  File::CreateFullPath(filename);
+  if (!Common::TimelineTrace::WriteChromeTrace(filename))
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -277,6 +304,14 @@ void MenuBar::AddToolsMenu()
 
   tools_menu->addAction(tr("FIFO Player"), this, &MenuBar::ShowFIFOPlayer);
 
+  QAction* const timeline_trace = tools_menu->addAction(tr("Record &Timeline Trace"));
+  timeline_trace->setCheckable(true);
+  timeline_trace->setToolTip(
+      tr("Records what the CPU, GPU, DSP and shader compiler threads are doing. The trace is "
+         "written to the Dump/Debug folder when recording is stopped and can be opened in "
+         "Perfetto or chrome://tracing."));
+  connect(timeline_trace, &QAction::toggled, this, &MenuBar::OnTimelineTraceToggled);
+
   auto* usb_device_menu = new QMenu(tr("Emulated USB Devices"), tools_menu);
   usb_device_menu->addAction(tr("&Skylanders Portal"), this, &MenuBar::ShowSkylanderPortal);
   usb_device_menu->addAction(tr("&Infinity Base"), this, &MenuBar::ShowInfinityBase);
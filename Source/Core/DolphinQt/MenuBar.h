@@ -199,6 +199,7 @@ private:
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnTimelineTraceToggled(bool enabled);
 
   QString GetSignatureSelector() const;
 
@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/CPUCullBenchCommand.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Core/System.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/XFMemory.h"
+#include "VideoCommon/XFStateManager.h"
+
+namespace DolphinTool
+{
+namespace
+{
+struct Result
+{
+  u32 num_components;
+  bool per_vertex_posmtx;
+  std::string implementation;
+  double vertices_per_second;
+};
+
+void SetUpTransform()
+{
+  // Orthographic identity projection and identity position matrix 0, which all vertices use.
+  xfmem.projection.type = ProjectionType::Orthographic;
+  xfmem.projection.rawProjection = {1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+  Core::System::GetInstance().GetXFStateManager().SetProjectionChanged();
+  std::fill_n(xfmem.posMatrices, 12, 0.0f);
+  xfmem.posMatrices[0] = xfmem.posMatrices[5] = xfmem.posMatrices[10] = 1.0f;
+  g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 0;
+  xfmem.viewport.ht = -1.0f;
+  // Without culling, only the bounds checks can cull a triangle.
+  bpmem.genMode.cull_mode = CullMode::None;
+}
+
+// Culls the draw over and over for at least the given duration, and returns the number of
+// vertices culled per second.
+double Measure(CPUCull& cull, VertexLoaderBase* loader, const std::vector<u8>& vertices, u32 count,
+               std::chrono::milliseconds duration)
+{
+  // Warm up the caches and start the worker threads first.
+  cull.AreAllVerticesCulled(loader, OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES, vertices.data(),
+                            count);
+
+  u64 iterations = 0;
+  const auto start = Clock::now();
+  auto now = start;
+  do
+  {
+    cull.AreAllVerticesCulled(loader, OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES,
+                              vertices.data(), count);
+    ++iterations;
+    now = Clock::now();
+  } while (now - start < duration);
+
+  const double seconds = std::chrono::duration<double>(now - start).count();
+  return static_cast<double>(iterations) * count / seconds;
+}
+
+void PrintTextReport(const std::vector<Result>& results, u32 count)
+{
+  fmt::print(std::cout, "Vertices per draw: {}\n\n", count);
+  fmt::print(std::cout, "{:<10} {:<12} {:<18} {:>12}\n", "Position", "Matrix index",
+             "Implementation", "MVertices/s");
+  for (const Result& result : results)
+  {
+    fmt::print(std::cout, "{:<10} {:<12} {:<18} {:>12.1f}\n",
+               result.num_components == 3 ? "XYZ" : "XY",
+               result.per_vertex_posmtx ? "Per vertex" : "Global", result.implementation,
+               result.vertices_per_second / 1e6);
+  }
+}
+
+void PrintJSONReport(const std::vector<Result>& results, u32 count)
+{
+  picojson::array entries;
+  for (const Result& result : results)
+  {
+    picojson::object entry;
+    entry["components"] = picojson::value(static_cast<double>(result.num_components));
+    entry["per_vertex_posmtx"] = picojson::value(result.per_vertex_posmtx);
+    entry["implementation"] = picojson::value(result.implementation);
+    entry["vertices_per_second"] = picojson::value(result.vertices_per_second);
+    entries.emplace_back(std::move(entry));
+  }
+
+  picojson::object json;
+  json["count"] = picojson::value(static_cast<double>(count));
+  json["results"] = picojson::value(std::move(entries));
+  std::cout << picojson::value(json) << '\n';
+}
+}  // namespace
+
+int CPUCullBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: cpucullbench [options]...");
+
+  parser.add_option("-c", "--count")
+      .type("int")
+      .action("store")
+      .help("Number of vertices per draw. Default is 300000.")
+      .set_default(300000);
+
+  parser.add_option("-w", "--workers")
+      .type("int")
+      .action("store")
+      .help("Number of worker threads to compare against culling on one thread. Default is 3.")
+      .set_default(3);
+
+  parser.add_option("-t", "--time")
+      .type("int")
+      .action("store")
+      .help("Milliseconds to spend on each configuration. Default is 250.")
+      .set_default(250);
+
+  parser.add_option("-j", "--json")
+      .action("store_true")
+      .help("Optional. Print the results as JSON instead of a table.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const int count = static_cast<int>(options.get("count"));
+  const int num_workers = static_cast<int>(options.get("workers"));
+  const int time_ms = static_cast<int>(options.get("time"));
+  if (count < 3)
+  {
+    fmt::print(std::cerr, "Error: The count must be at least 3\n");
+    return EXIT_FAILURE;
+  }
+  if (num_workers < 0)
+  {
+    fmt::print(std::cerr, "Error: The number of worker threads can't be negative\n");
+    return EXIT_FAILURE;
+  }
+  if (time_ms < 1)
+  {
+    fmt::print(std::cerr, "Error: The time must be at least 1 ms\n");
+    return EXIT_FAILURE;
+  }
+
+  SetUpTransform();
+
+  std::vector<std::pair<std::string, std::unique_ptr<CPUCull>>> implementations;
+  implementations.emplace_back("One thread", std::make_unique<CPUCull>());
+  implementations.back().second->Init(false);
+  if (num_workers > 0)
+  {
+    implementations.emplace_back(fmt::format("{} worker threads", num_workers),
+                                 std::make_unique<CPUCull>());
+    implementations.back().second->Init(false);
+    implementations.back().second->SetNumWorkerThreads(static_cast<u32>(num_workers));
+  }
+  if (cpu_info.bAVX512F)
+  {
+    implementations.emplace_back("AVX-512", std::make_unique<CPUCull>());
+    implementations.back().second->Init();
+  }
+
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> off_screen(100.0f, 200.0f);
+
+  std::vector<Result> results;
+  for (const CoordComponentCount pos_elements : {CoordComponentCount::XY, CoordComponentCount::XYZ})
+  {
+    for (const bool per_vertex_posmtx : {false, true})
+    {
+      TVtxDesc vtx_desc;
+      VAT vtx_attr;
+      vtx_desc.low.PosMatIdx = per_vertex_posmtx;
+      vtx_desc.low.Position = VertexComponentFormat::Direct;
+      vtx_attr.g0.PosElements = pos_elements;
+      vtx_attr.g0.PosFormat = ComponentFormat::Float;
+      const std::unique_ptr<VertexLoaderBase> loader =
+          VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr);
+      const u32 stride = loader->m_native_vtx_decl.stride;
+      const u32 position_offset = loader->m_native_vtx_decl.position.offset;
+      const u32 num_components = pos_elements == CoordComponentCount::XYZ ? 3 : 2;
+
+      // Every vertex is off screen, so no triangle is visible and the whole draw has to be
+      // transformed. The transform functions may read 4 bytes past the last vertex.
+      std::vector<u8> vertices(count * stride + 16, 0);
+      for (int i = 0; i < count; ++i)
+      {
+        for (u32 j = 0; j < num_components; ++j)
+        {
+          const float value = off_screen(rng);
+          std::memcpy(&vertices[i * stride + position_offset + j * sizeof(float)], &value,
+                      sizeof(float));
+        }
+      }
+
+      for (const auto& [name, cull] : implementations)
+      {
+        const double rate = Measure(*cull, loader.get(), vertices, static_cast<u32>(count),
+                                    std::chrono::milliseconds(time_ms));
+        results.push_back({num_components, per_vertex_posmtx, name, rate});
+      }
+    }
+  }
+
+  if (options.is_set_by_user("json"))
+    PrintJSONReport(results, static_cast<u32>(count));
+  else
+    PrintTextReport(results, static_cast<u32>(count));
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,355 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/FifoBenchCommand.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/StringUtil.h"
+#include "Common/WindowSystemInfo.h"
+#include "Core/Boot/Boot.h"
+#include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/Fifo.h"
+#include "VideoCommon/GPUStageTimer.h"
+#include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DolphinTool
+{
+namespace
+{
+struct FrameSample
+{
+  VideoCommon::GPUStageTimes stage_ns;
+  u64 wall_ns = 0;
+};
+
+struct Percentiles
+{
+  double mean = 0;
+  double p50 = 0;
+  double p95 = 0;
+  double max = 0;
+};
+
+Percentiles ComputePercentiles(std::vector<u64> values_ns)
+{
+  Percentiles result;
+  if (values_ns.empty())
+    return result;
+
+  std::ranges::sort(values_ns);
+  const auto to_us = [](u64 ns) { return static_cast<double>(ns) / 1000.0; };
+  const auto at = [&](double fraction) {
+    const size_t index = static_cast<size_t>(fraction * (values_ns.size() - 1));
+    return to_us(values_ns[index]);
+  };
+
+  u64 sum = 0;
+  for (const u64 value : values_ns)
+    sum += value;
+
+  result.mean = to_us(sum) / values_ns.size();
+  result.p50 = at(0.50);
+  result.p95 = at(0.95);
+  result.max = to_us(values_ns.back());
+  return result;
+}
+
+// Picks the first Vulkan adapter that is implemented on the CPU, so results do not depend on the
+// host GPU.
+std::optional<int> FindSoftwareVulkanAdapter()
+{
+  VideoBackendBase::PopulateBackendInfo(WindowSystemInfo{});
+
+  for (size_t i = 0; i < g_backend_info.Adapters.size(); ++i)
+  {
+    std::string name = g_backend_info.Adapters[i];
+    Common::ToLower(&name);
+    if (name.find("llvmpipe") != std::string::npos ||
+        name.find("lavapipe") != std::string::npos ||
+        name.find("swiftshader") != std::string::npos)
+    {
+      return static_cast<int>(i);
+    }
+  }
+
+  return std::nullopt;
+}
+
+void PrintTextReport(const std::vector<FrameSample>& samples,
+                     const Fifo::FifoManager::PipelineTimes& pipeline_times)
+{
+  fmt::print(std::cout, "Frames: {}\n\n", samples.size());
+  fmt::print(std::cout, "{:<20} {:>12} {:>12} {:>12} {:>12}\n", "us/frame", "mean", "p50", "p95",
+             "max");
+
+  std::vector<u64> values(samples.size());
+  const auto print_row = [&](const char* name) {
+    const Percentiles p = ComputePercentiles(values);
+    fmt::print(std::cout, "{:<20} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f}\n", name, p.mean, p.p50,
+               p.p95, p.max);
+  };
+
+  u64 gpu_total = 0;
+  for (size_t i = 0; i < samples.size(); ++i)
+  {
+    values[i] = 0;
+    for (const u64 ns : samples[i].stage_ns)
+      values[i] += ns;
+    gpu_total += values[i];
+  }
+  print_row("GPU thread total");
+
+  for (size_t stage = 0; stage < samples.front().stage_ns.size(); ++stage)
+  {
+    const auto gpu_stage = static_cast<VideoCommon::GPUStage>(stage);
+    for (size_t i = 0; i < samples.size(); ++i)
+      values[i] = samples[i].stage_ns[gpu_stage];
+    print_row(VideoCommon::GPUStageTimer::GetStageName(gpu_stage));
+  }
+
+  for (size_t i = 0; i < samples.size(); ++i)
+    values[i] = samples[i].wall_ns;
+  print_row("Wall clock");
+
+  fmt::print(std::cout, "\nGPU thread time: {:.3f} s\n", static_cast<double>(gpu_total) / 1e9);
+
+  if (pipeline_times.wall_ns != 0)
+  {
+    const double wall_ns = static_cast<double>(pipeline_times.wall_ns);
+    fmt::print(std::cout, "Pipelined GPU thread utilization: decode {:.1f}%, submission {:.1f}%\n",
+               100.0 * pipeline_times.decode_busy_ns / wall_ns,
+               100.0 * pipeline_times.submit_busy_ns / wall_ns);
+  }
+}
+
+void PrintJSONReport(const std::vector<FrameSample>& samples,
+                     const Fifo::FifoManager::PipelineTimes& pipeline_times)
+{
+  picojson::array frames;
+  for (const FrameSample& sample : samples)
+  {
+    picojson::object frame;
+    for (size_t stage = 0; stage < sample.stage_ns.size(); ++stage)
+    {
+      const auto gpu_stage = static_cast<VideoCommon::GPUStage>(stage);
+      frame[VideoCommon::GPUStageTimer::GetStageName(gpu_stage)] =
+          picojson::value(static_cast<double>(sample.stage_ns[gpu_stage]) / 1000.0);
+    }
+    frame["Wall clock"] = picojson::value(static_cast<double>(sample.wall_ns) / 1000.0);
+    frames.emplace_back(std::move(frame));
+  }
+
+  picojson::object json;
+  json["unit"] = picojson::value("us");
+  json["frames"] = picojson::value(std::move(frames));
+  if (pipeline_times.wall_ns != 0)
+  {
+    picojson::object pipeline;
+    pipeline["Decode busy"] =
+        picojson::value(static_cast<double>(pipeline_times.decode_busy_ns) / 1000.0);
+    pipeline["Submission busy"] =
+        picojson::value(static_cast<double>(pipeline_times.submit_busy_ns) / 1000.0);
+    pipeline["Wall clock"] = picojson::value(static_cast<double>(pipeline_times.wall_ns) / 1000.0);
+    json["pipeline"] = picojson::value(std::move(pipeline));
+  }
+  std::cout << picojson::value(json) << '\n';
+}
+}  // namespace
+
+int FifoBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: fifobench [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path. Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the FIFO log (.dff) FILE.")
+      .metavar("FILE");
+
+  parser.add_option("-b", "--backend")
+      .type("string")
+      .action("store")
+      .help("Video backend to replay the log with. Default is null. [%choices]")
+      .choices({"null", "software", "vulkan"})
+      .set_default("null");
+
+  parser.add_option("-s", "--software_driver")
+      .action("store_true")
+      .help("Optional. Only with the vulkan backend: use a CPU implementation of Vulkan "
+            "(lavapipe/SwiftShader) instead of the host GPU.");
+
+  parser.add_option("-n", "--loops")
+      .type("int")
+      .action("store")
+      .help("Number of times to replay the whole log. Default is 1.")
+      .set_default(1);
+
+  parser.add_option("-j", "--json")
+      .action("store_true")
+      .help("Optional. Print the per-frame timings as JSON instead of a summary.");
+
+  parser.add_option("-p", "--pipelined")
+      .action("store_true")
+      .help("Optional. Split the GPU thread into a decode and a submission thread, and report "
+            "how busy each of them was.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+
+  // Validate options
+  const std::string& input_file_path = options["input"];
+  if (input_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const int loops = static_cast<int>(options.get("loops"));
+  if (loops < 1)
+  {
+    fmt::print(std::cerr, "Error: The number of loops must be at least 1\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& backend = options["backend"];
+  const bool software_driver = options.is_set_by_user("software_driver");
+  if (software_driver && backend != "vulkan")
+  {
+    fmt::print(std::cerr, "Error: --software_driver requires the vulkan backend\n");
+    return EXIT_FAILURE;
+  }
+
+  if (backend == "software")
+    Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Software Renderer");
+  else if (backend == "vulkan")
+    Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Vulkan");
+  else
+    Config::SetCurrent(Config::MAIN_GFX_BACKEND, "Null");
+
+  if (software_driver)
+  {
+    const std::optional<int> adapter = FindSoftwareVulkanAdapter();
+    if (!adapter)
+    {
+      fmt::print(std::cerr, "Error: No software Vulkan driver was found\n");
+      return EXIT_FAILURE;
+    }
+    Config::SetCurrent(Config::GFX_ADAPTER, *adapter);
+  }
+
+  // Run as fast as possible, with the GPU on its own thread so only its work is measured.
+  Config::SetCurrent(Config::MAIN_CPU_THREAD, true);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::GFX_VSYNC, false);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES, false);
+  Config::SetCurrent(Config::MAIN_PIPELINED_GPU_THREAD, options.is_set_by_user("pipelined"));
+
+  auto& system = Core::System::GetInstance();
+  FifoPlayer& fifo_player = system.GetFifoPlayer();
+
+  std::vector<FrameSample> samples;
+  std::atomic<bool> done = false;
+  u64 frames_to_run = 0;
+  VideoCommon::GPUStageTimes last_times{};
+  auto last_wall_time = Clock::now();
+
+  // Called on the CPU thread before each frame is written, after the GPU went idle on the
+  // previous one, so the difference between two calls is exactly one frame of GPU work.
+  fifo_player.SetFrameWrittenCallback([&] {
+    const auto now = Clock::now();
+    const VideoCommon::GPUStageTimes times = VideoCommon::GPUStageTimer::GetTimes();
+
+    if (frames_to_run == 0)
+    {
+      frames_to_run = u64(fifo_player.GetFrameRangeEnd() - fifo_player.GetFrameRangeStart() + 1) *
+                      static_cast<u64>(loops);
+      samples.reserve(frames_to_run);
+    }
+    else if (samples.size() < frames_to_run)
+    {
+      FrameSample& sample = samples.emplace_back();
+      for (size_t i = 0; i < times.size(); ++i)
+      {
+        const auto stage = static_cast<VideoCommon::GPUStage>(i);
+        sample.stage_ns[stage] = times[stage] - last_times[stage];
+      }
+      sample.wall_ns = static_cast<u64>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_wall_time).count());
+
+      if (samples.size() == frames_to_run)
+        done.store(true);
+    }
+
+    last_times = times;
+    last_wall_time = now;
+  });
+
+  VideoCommon::GPUStageTimer::Reset();
+  VideoCommon::GPUStageTimer::SetEnabled(true);
+
+  if (!BootManager::BootCore(system, BootParameters::GenerateFromFile(input_file_path),
+                             WindowSystemInfo{}))
+  {
+    fmt::print(std::cerr, "Error: Could not replay the FIFO log\n");
+    return EXIT_FAILURE;
+  }
+
+  while (!done.load() && !Core::IsUninitialized(system))
+  {
+    Core::HostDispatchJobs(system);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Core::Stop(system);
+  Core::Shutdown(system);
+  const Fifo::FifoManager::PipelineTimes pipeline_times = system.GetFifo().GetPipelineTimes();
+  VideoCommon::GPUStageTimer::SetEnabled(false);
+  fifo_player.SetFrameWrittenCallback(nullptr);
+
+  if (!done.load() || samples.empty())
+  {
+    fmt::print(std::cerr, "Error: Emulation stopped before the benchmark finished\n");
+    return EXIT_FAILURE;
+  }
+
+  if (options.is_set_by_user("json"))
+    PrintJSONReport(samples, pipeline_times);
+  else
+    PrintTextReport(samples, pipeline_times);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
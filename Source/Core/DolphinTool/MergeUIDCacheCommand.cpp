@@ -0,0 +1,136 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/MergeUIDCacheCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDCache.h"
+
+namespace DolphinTool
+{
+int MergeUIDCacheCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: mergeuidcache [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("append")
+      .help("Path to a pipeline UID cache FILE (e.g. GALE01.uidcache). Can be given multiple "
+            "times. The .uidusage file next to it is merged too if there is one.")
+      .metavar("FILE");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the merged UID cache FILE. A .uidusage file is written next to it if any "
+            "input had one.")
+      .metavar("FILE");
+
+  parser.add_option("-k", "--skip_invalid")
+      .action("store_true")
+      .help("Optional. Skip input files of a different Dolphin version instead of failing.");
+
+  parser.add_option("-q", "--quiet")
+      .action("store_true")
+      .help("Mute all messages except for errors.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::list<std::string> input_paths = options.all("input");
+  if (input_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  if (!options.is_set("output"))
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& output_path = options["output"];
+  const bool skip_invalid = options.is_set("skip_invalid");
+  const bool quiet = options.is_set("quiet");
+
+  std::vector<VideoCommon::SerializedGXPipelineUid> uids;
+  std::vector<VideoCommon::SerializedGXPipelineUsage> usages;
+  size_t num_merged_files = 0;
+  for (const std::string& input_path : input_paths)
+  {
+    // Compiling UIDs of another version would create the wrong shaders, so they're never merged.
+    const auto [input_uids, error] = VideoCommon::ReadPipelineUIDCacheFile(input_path);
+    if (error)
+    {
+      fmt::print(std::cerr, "{}: {} {}\n", skip_invalid ? "Warning" : "Error", input_path,
+                 VideoCommon::GetPipelineUIDCacheErrorString(*error));
+      if (!skip_invalid)
+        return EXIT_FAILURE;
+      continue;
+    }
+
+    const size_t num_uids_before = uids.size();
+    VideoCommon::MergePipelineUIDs(&uids, input_uids);
+    ++num_merged_files;
+
+    const std::string usage_path = VideoCommon::GetPipelineUsageFilePath(input_path);
+    const auto [input_usages, usage_error] = VideoCommon::ReadPipelineUsageFile(usage_path);
+    if (!usage_error)
+    {
+      VideoCommon::MergePipelineUsage(&usages, input_usages);
+    }
+    else if (*usage_error != VideoCommon::PipelineUIDCacheError::OpenFailed)
+    {
+      fmt::print(std::cerr, "Warning: {} {}, ignoring it\n", usage_path,
+                 VideoCommon::GetPipelineUIDCacheErrorString(*usage_error));
+    }
+
+    if (!quiet)
+    {
+      fmt::print(std::cout, "{}: {} UIDs, {} new\n", input_path, input_uids.size(),
+                 uids.size() - num_uids_before);
+    }
+  }
+
+  if (num_merged_files == 0)
+  {
+    fmt::print(std::cerr, "Error: None of the input files could be merged\n");
+    return EXIT_FAILURE;
+  }
+
+  if (!VideoCommon::WritePipelineUIDCacheFile(output_path, uids))
+  {
+    fmt::print(std::cerr, "Error: Could not write {}\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  if (!usages.empty())
+  {
+    const std::string usage_path = VideoCommon::GetPipelineUsageFilePath(output_path);
+    if (!VideoCommon::WritePipelineUsageFile(usage_path, usages))
+    {
+      fmt::print(std::cerr, "Error: Could not write {}\n", usage_path);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (!quiet)
+  {
+    fmt::print(std::cout, "Merged {} UIDs from {} files into {}\n", uids.size(), num_merged_files,
+               output_path);
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,163 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/PackTexturesCommand.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureArchive.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DolphinTool
+{
+namespace
+{
+constexpr std::string_view TEXTURE_PREFIX = "tex1_";
+
+struct TextureFile
+{
+  std::string name;
+  std::string path;
+  bool has_arbitrary_mipmaps;
+};
+
+// Mipmaps in separate files (e.g. tex1_..._mip1.png) are loaded together with the first level.
+bool IsMipmapFile(std::string_view filename)
+{
+  const size_t mip_index = filename.rfind("_mip");
+  if (mip_index == std::string_view::npos || mip_index + 4 == filename.size())
+    return false;
+
+  return std::all_of(filename.begin() + mip_index + 4, filename.end(),
+                     [](char c) { return std::isdigit(static_cast<unsigned char>(c)); });
+}
+
+// Finds the textures like HiresTexture::Update does for a texture pack folder.
+std::vector<TextureFile> FindTextures(const std::string& directory)
+{
+  std::vector<TextureFile> textures;
+  for (const std::string& path : Common::DoFileSearch({directory}, {".png", ".dds"}, true))
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (!filename.starts_with(TEXTURE_PREFIX) || IsMipmapFile(filename))
+      continue;
+
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    textures.push_back({std::move(filename), path, has_arbitrary_mipmaps});
+  }
+
+  // Keeps the archive the same when it's built again from the same files.
+  std::ranges::sort(textures, {}, &TextureFile::path);
+  return textures;
+}
+}  // namespace
+
+int PackTexturesCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: packtextures [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack FOLDER.")
+      .metavar("FOLDER");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the texture archive FILE, usually named after the game ID (e.g. GALE01.dtp).")
+      .metavar("FILE");
+
+  parser.add_option("-q", "--quiet")
+      .action("store_true")
+      .help("Mute all messages except for errors.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  if (!options.is_set("input"))
+  {
+    fmt::println(std::cerr, "Error: No input folder set");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_path = options["input"];
+  if (!File::IsDirectory(input_path))
+  {
+    fmt::println(std::cerr, "Error: {} is not a folder", input_path);
+    return EXIT_FAILURE;
+  }
+
+  if (!options.is_set("output"))
+  {
+    fmt::println(std::cerr, "Error: No output file set");
+    return EXIT_FAILURE;
+  }
+  const std::string& output_path = options["output"];
+  const bool quiet = options.is_set("quiet");
+
+  // Store compressed textures as they are. Whether the video backend supports them is checked
+  // when they are loaded from the archive.
+  g_backend_info.bSupportsST3CTextures = true;
+  g_backend_info.bSupportsBPTCTextures = true;
+
+  VideoCommon::TextureArchiveWriter writer;
+  if (!writer.Open(output_path))
+  {
+    fmt::println(std::cerr, "Error: Unable to create {}", output_path);
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<TextureFile> textures = FindTextures(input_path);
+  size_t num_packed = 0;
+  for (const TextureFile& texture : textures)
+  {
+    VideoCommon::CustomTextureData data;
+    if (!VideoCommon::LoadTextureDataFromFile(texture.name, StringToPath(texture.path),
+                                              AbstractTextureType::Texture_2D, &data) ||
+        !VideoCommon::PurgeInvalidMipsFromTextureData(texture.name, &data) ||
+        !writer.AddTexture(texture.name, texture.has_arbitrary_mipmaps, data))
+    {
+      fmt::println(std::cerr, "Warning: Skipping {}", texture.path);
+      continue;
+    }
+
+    ++num_packed;
+    if (!quiet)
+      fmt::println(std::cout, "Packed {}", texture.name);
+  }
+
+  if (!writer.Finish())
+  {
+    fmt::println(std::cerr, "Error: Unable to write {}", output_path);
+    return EXIT_FAILURE;
+  }
+
+  if (!quiet)
+    fmt::println(std::cout, "Packed {} of {} textures into {}", num_packed, textures.size(),
+                 output_path);
+
+  return num_packed == textures.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,196 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/PrecompileShadersCommand.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/WindowSystemInfo.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDCache.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// Adds the UIDs (and usage) of the input files to the UID cache the game loads on this machine.
+// Files of another Dolphin version are rejected, as their UIDs would be compiled into the wrong
+// shaders.
+bool ImportUIDCaches(const std::list<std::string>& input_paths, const std::string& cache_path)
+{
+  // The local files are only kept if they're valid, like ShaderCache does when loading them.
+  std::vector<VideoCommon::SerializedGXPipelineUid> uids =
+      VideoCommon::ReadPipelineUIDCacheFile(cache_path).uids;
+  const std::string usage_path = VideoCommon::GetPipelineUsageFilePath(cache_path);
+  std::vector<VideoCommon::SerializedGXPipelineUsage> usages =
+      VideoCommon::ReadPipelineUsageFile(usage_path).usages;
+
+  const size_t num_local_uids = uids.size();
+  for (const std::string& input_path : input_paths)
+  {
+    const auto [input_uids, error] = VideoCommon::ReadPipelineUIDCacheFile(input_path);
+    if (error)
+    {
+      fmt::print(std::cerr, "Error: {} {}\n", input_path,
+                 VideoCommon::GetPipelineUIDCacheErrorString(*error));
+      return false;
+    }
+    VideoCommon::MergePipelineUIDs(&uids, input_uids);
+
+    const auto [input_usages, usage_error] =
+        VideoCommon::ReadPipelineUsageFile(VideoCommon::GetPipelineUsageFilePath(input_path));
+    if (!usage_error)
+      VideoCommon::MergePipelineUsage(&usages, input_usages);
+  }
+
+  if (!VideoCommon::WritePipelineUIDCacheFile(cache_path, uids) ||
+      (!usages.empty() && !VideoCommon::WritePipelineUsageFile(usage_path, usages)))
+  {
+    fmt::print(std::cerr, "Error: Could not write {}\n", cache_path);
+    return false;
+  }
+
+  fmt::print(std::cout, "Imported {} new UIDs, {} in total\n", uids.size() - num_local_uids,
+             uids.size());
+  return true;
+}
+}  // namespace
+
+int PrecompileShadersCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: precompileshaders [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path. Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("append")
+      .help("Optional. Path to a pipeline UID cache FILE to import before compiling, e.g. one "
+            "created by mergeuidcache. Can be given multiple times. Without it, only the UIDs "
+            "already in the user folder are compiled.")
+      .metavar("FILE");
+
+  parser.add_option("-g", "--game_id")
+      .type("string")
+      .action("store")
+      .help("Game ID to compile the shaders for. Default is the name of the first input file.");
+
+  parser.add_option("-b", "--backend")
+      .type("string")
+      .action("store")
+      .help("Video backend to compile the shaders for, e.g. Vulkan or OGL. Default is the backend "
+            "set in the user folder.");
+
+  parser.add_option("-a", "--adapter")
+      .type("int")
+      .action("store")
+      .help("Optional. Index of the GPU to compile the shaders for. Default is the adapter set in "
+            "the user folder.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+
+  // Validate options
+  const std::list<std::string> input_paths = options.all("input");
+  std::string game_id = options["game_id"];
+  if (game_id.empty() && !input_paths.empty())
+    SplitPath(input_paths.front(), nullptr, &game_id, nullptr);
+  if (game_id.empty())
+  {
+    fmt::print(std::cerr, "Error: No game ID set\n");
+    return EXIT_FAILURE;
+  }
+
+  if (options.is_set("backend"))
+  {
+    const std::string& backend = options["backend"];
+    const auto& backends = VideoBackendBase::GetAvailableBackends();
+    if (std::ranges::find(backends, backend, &VideoBackendBase::GetConfigName) == backends.end())
+    {
+      fmt::print(std::cerr, "Error: {} is not an available video backend\n", backend);
+      return EXIT_FAILURE;
+    }
+    Config::SetCurrent(Config::MAIN_GFX_BACKEND, backend);
+  }
+
+  const bool adapter_set = options.is_set("adapter");
+  const int adapter = adapter_set ? static_cast<int>(options.get("adapter")) : 0;
+  if (adapter_set)
+    Config::SetCurrent(Config::GFX_ADAPTER, adapter);
+
+  const std::string cache_path = File::GetUserPath(D_CACHE_IDX) + game_id +
+                                 std::string(VideoCommon::PIPELINE_UID_CACHE_EXTENSION);
+  if (!input_paths.empty() && !ImportUIDCaches(input_paths, cache_path))
+    return EXIT_FAILURE;
+
+  // The game's INIs can change settings that the shaders depend on.
+  SConfig::GetInstance().SetRunningGameMetadata(game_id);
+
+  // Compiles every pipeline of the UID cache while the backend starts, and stores the results in
+  // the shader cache of the selected backend and driver.
+  Config::SetCurrent(Config::GFX_SHADER_CACHE, true);
+  Config::SetCurrent(Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING, true);
+
+  const WindowSystemInfo wsi;
+  VideoBackendBase::PopulateBackendInfo(wsi);
+  if (g_backend_info.api_type == APIType::Nothing)
+  {
+    fmt::print(std::cerr, "Error: The {} backend does not use shaders\n",
+               g_video_backend->GetDisplayName());
+    return EXIT_FAILURE;
+  }
+  if (adapter_set &&
+      (adapter < 0 || static_cast<size_t>(adapter) >= g_backend_info.Adapters.size()))
+  {
+    fmt::print(std::cerr, "Error: The adapter index is out of range\n");
+    return EXIT_FAILURE;
+  }
+
+  Core::DeclareAsGPUThread();
+  if (!g_video_backend->Initialize(wsi))
+  {
+    fmt::print(std::cerr, "Error: Could not initialize the {} backend\n",
+               g_video_backend->GetDisplayName());
+    return EXIT_FAILURE;
+  }
+  // Pipelines that were already in the pipeline cache of the driver are loaded, not compiled.
+  const int num_loaded = g_stats.num_pipelines_loaded;
+  const int num_compiled = g_stats.num_pipelines_precompiled - num_loaded;
+  g_video_backend->Shutdown();
+  Core::UndeclareAsGPUThread();
+
+  SConfig::GetInstance().ResetRunningGameMetadata();
+
+  fmt::print(std::cout, "Compiled {} pipelines for {} on {}, {} were already cached\n",
+             num_compiled, game_id, g_video_backend->GetDisplayName(), num_loaded);
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
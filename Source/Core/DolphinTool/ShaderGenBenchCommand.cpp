@@ -0,0 +1,241 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/ShaderGenBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/PipelineUIDCache.h"
+#include "VideoCommon/PixelShaderGen.h"
+#include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/VertexShaderGen.h"
+#include "VideoCommon/VideoCommon.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// The distinct shaders of a UID cache, like the shader cache would compile them.
+struct ShaderSet
+{
+  std::set<VertexShaderUid> vertex;
+  std::set<GeometryShaderUid> geometry;
+  std::set<PixelShaderUid> pixel;
+};
+
+ShaderSet GetShaderSet(const std::vector<VideoCommon::SerializedGXPipelineUid>& uids,
+                       APIType api_type, const ShaderHostConfig& host_config)
+{
+  ShaderSet shaders;
+  for (const VideoCommon::SerializedGXPipelineUid& uid : uids)
+  {
+    shaders.vertex.insert(uid.vs_uid);
+    if (!uid.gs_uid.GetUidData()->IsPassthrough())
+      shaders.geometry.insert(uid.gs_uid);
+
+    PixelShaderUid ps_uid = uid.ps_uid;
+    ClearUnusedPixelShaderUidBits(api_type, host_config, &ps_uid);
+    shaders.pixel.insert(ps_uid);
+  }
+  return shaders;
+}
+
+struct Result
+{
+  u64 rounds = 0;
+  u64 bytes = 0;
+  double seconds = 0;
+  double vertex_seconds = 0;
+  double geometry_seconds = 0;
+  double pixel_seconds = 0;
+};
+
+// Generates every shader of the set. The digest of the code is updated if it's given.
+void Generate(const ShaderSet& shaders, APIType api_type, const ShaderHostConfig& host_config,
+              Result* result, u32* digest)
+{
+  const auto add = [&](const ShaderCode& code) {
+    const std::string& buffer = code.GetBuffer();
+    result->bytes += buffer.size();
+    if (digest)
+      *digest = Common::UpdateCRC32(*digest, reinterpret_cast<const u8*>(buffer.data()),
+                                    buffer.size());
+  };
+
+  auto start = Clock::now();
+  for (const VertexShaderUid& uid : shaders.vertex)
+    add(GenerateVertexShaderCode(api_type, host_config, uid.GetUidData(), {}));
+  auto end = Clock::now();
+  result->vertex_seconds += std::chrono::duration<double>(end - start).count();
+
+  start = end;
+  for (const GeometryShaderUid& uid : shaders.geometry)
+    add(GenerateGeometryShaderCode(api_type, host_config, uid.GetUidData()));
+  end = Clock::now();
+  result->geometry_seconds += std::chrono::duration<double>(end - start).count();
+
+  start = end;
+  for (const PixelShaderUid& uid : shaders.pixel)
+    add(GeneratePixelShaderCode(api_type, host_config, uid.GetUidData(), {}));
+  end = Clock::now();
+  result->pixel_seconds += std::chrono::duration<double>(end - start).count();
+}
+
+void PrintTextReport(const ShaderSet& shaders, const Result& result, u32 digest)
+{
+  const double rounds = static_cast<double>(result.rounds);
+  const auto print_stage = [&](std::string_view name, size_t count, double seconds) {
+    if (count == 0)
+      return;
+    fmt::print(std::cout, "{:<10} {:>8} {:>12.1f} {:>12.2f}\n", name, count,
+               seconds * 1e3 / rounds, seconds * 1e6 / (rounds * count));
+  };
+
+  fmt::print(std::cout, "{:<10} {:>8} {:>12} {:>12}\n", "Stage", "Shaders", "ms/round",
+             "us/shader");
+  print_stage("Vertex", shaders.vertex.size(), result.vertex_seconds);
+  print_stage("Geometry", shaders.geometry.size(), result.geometry_seconds);
+  print_stage("Pixel", shaders.pixel.size(), result.pixel_seconds);
+  fmt::print(std::cout, "\n{} rounds, {:.1f} MB/s of shader code, digest {:08x}\n", result.rounds,
+             result.bytes / result.seconds / 1e6, digest);
+}
+
+void PrintJSONReport(const ShaderSet& shaders, const Result& result, u32 digest)
+{
+  picojson::object json;
+  json["rounds"] = picojson::value(static_cast<double>(result.rounds));
+  json["vertex_shaders"] = picojson::value(static_cast<double>(shaders.vertex.size()));
+  json["geometry_shaders"] = picojson::value(static_cast<double>(shaders.geometry.size()));
+  json["pixel_shaders"] = picojson::value(static_cast<double>(shaders.pixel.size()));
+  json["vertex_seconds"] = picojson::value(result.vertex_seconds);
+  json["geometry_seconds"] = picojson::value(result.geometry_seconds);
+  json["pixel_seconds"] = picojson::value(result.pixel_seconds);
+  json["bytes_per_second"] = picojson::value(result.bytes / result.seconds);
+  json["digest"] = picojson::value(fmt::format("{:08x}", digest));
+  std::cout << picojson::value(json) << '\n';
+}
+}  // namespace
+
+int ShaderGenBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: shadergenbench [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to a pipeline UID cache FILE (e.g. GALE01.uidcache) to generate the shaders of.")
+      .metavar("FILE");
+
+  parser.add_option("-a", "--api")
+      .type("string")
+      .action("store")
+      .help("Shading language to generate. Default is vulkan. [%choices]")
+      .choices({"opengl", "d3d", "vulkan", "metal"})
+      .set_default("vulkan");
+
+  parser.add_option("-c", "--host_config")
+      .type("string")
+      .action("store")
+      .help("Optional. Host config BITS in hex, as in the file names of the shader cache. "
+            "Default is 0.")
+      .metavar("BITS")
+      .set_default("0");
+
+  parser.add_option("-t", "--time")
+      .type("int")
+      .action("store")
+      .help("Minimum milliseconds to spend generating. Default is 1000.")
+      .set_default(1000);
+
+  parser.add_option("-j", "--json")
+      .action("store_true")
+      .help("Optional. Print the results as JSON instead of a table.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_path = options["input"];
+
+  const std::string& api = options["api"];
+  APIType api_type = APIType::Vulkan;
+  if (api == "opengl")
+    api_type = APIType::OpenGL;
+  else if (api == "d3d")
+    api_type = APIType::D3D;
+  else if (api == "metal")
+    api_type = APIType::Metal;
+
+  ShaderHostConfig host_config{};
+  if (!TryParse(options["host_config"], &host_config.bits, 16))
+  {
+    fmt::print(std::cerr, "Error: Invalid host config {}\n", options["host_config"]);
+    return EXIT_FAILURE;
+  }
+
+  const int time_ms = static_cast<int>(options.get("time"));
+  if (time_ms < 1)
+  {
+    fmt::print(std::cerr, "Error: The time must be at least 1 ms\n");
+    return EXIT_FAILURE;
+  }
+
+  const auto [uids, error] = VideoCommon::ReadPipelineUIDCacheFile(input_path);
+  if (error)
+  {
+    fmt::print(std::cerr, "Error: {} {}\n", input_path,
+               VideoCommon::GetPipelineUIDCacheErrorString(*error));
+    return EXIT_FAILURE;
+  }
+
+  const ShaderSet shaders = GetShaderSet(uids, api_type, host_config);
+  if (shaders.vertex.empty())
+  {
+    fmt::print(std::cerr, "Error: {} is empty\n", input_path);
+    return EXIT_FAILURE;
+  }
+
+  // The first round is only used for the digest, which can be compared between builds to check
+  // that the generated code hasn't changed. It also warms up the caches of the generators.
+  Result result;
+  u32 digest = Common::StartCRC32();
+  Generate(shaders, api_type, host_config, &result, &digest);
+
+  result = {};
+  const auto start = Clock::now();
+  do
+  {
+    Generate(shaders, api_type, host_config, &result, nullptr);
+    ++result.rounds;
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  } while (result.seconds * 1e3 < time_ms);
+
+  if (options.is_set_by_user("json"))
+    PrintJSONReport(shaders, result, digest);
+  else
+    PrintTextReport(shaders, result, digest);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -0,0 +1,288 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/TextureDecodeBenchCommand.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace DolphinTool
+{
+namespace
+{
+enum class DecoderLevel
+{
+  Generic,
+  SSE2,
+  SSSE3,
+  AVX2,
+};
+
+const char* GetLevelName(DecoderLevel level)
+{
+  switch (level)
+  {
+  case DecoderLevel::Generic:
+    return "Generic";
+  case DecoderLevel::SSE2:
+    return "SSE2";
+  case DecoderLevel::SSSE3:
+    return "SSSE3";
+  case DecoderLevel::AVX2:
+    return "AVX2";
+  }
+  return "";
+}
+
+std::vector<DecoderLevel> GetSupportedLevels()
+{
+  std::vector<DecoderLevel> levels{DecoderLevel::Generic};
+#ifdef _M_X86_64
+  levels.push_back(DecoderLevel::SSE2);
+  if (cpu_info.bSSSE3)
+    levels.push_back(DecoderLevel::SSSE3);
+  if (cpu_info.bAVX2)
+    levels.push_back(DecoderLevel::AVX2);
+#endif
+  return levels;
+}
+
+struct BenchFormat
+{
+  TextureFormat format;
+  TLUTFormat tlut_format;
+};
+
+constexpr BenchFormat FORMATS[] = {
+    {TextureFormat::I4, TLUTFormat::IA8},     {TextureFormat::I8, TLUTFormat::IA8},
+    {TextureFormat::IA4, TLUTFormat::IA8},    {TextureFormat::IA8, TLUTFormat::IA8},
+    {TextureFormat::RGB565, TLUTFormat::IA8}, {TextureFormat::RGB5A3, TLUTFormat::IA8},
+    {TextureFormat::RGBA8, TLUTFormat::IA8},  {TextureFormat::C4, TLUTFormat::RGB5A3},
+    {TextureFormat::C8, TLUTFormat::RGB5A3},  {TextureFormat::C14X2, TLUTFormat::RGB5A3},
+    {TextureFormat::CMPR, TLUTFormat::IA8},
+};
+
+struct Result
+{
+  BenchFormat format;
+  DecoderLevel level;
+  double texels_per_second;
+};
+
+// Decodes the texture over and over for at least the given duration, and returns the number of
+// texels decoded per second.
+double Measure(const BenchFormat& format, DecoderLevel level, int width, int height,
+               const std::vector<u8>& src, const std::vector<u8>& tlut, u32* dst,
+               std::chrono::milliseconds duration)
+{
+#ifdef _M_X86_64
+  const bool old_ssse3 = cpu_info.bSSSE3;
+  const bool old_avx2 = cpu_info.bAVX2;
+  cpu_info.bSSSE3 = level >= DecoderLevel::SSSE3;
+  cpu_info.bAVX2 = level >= DecoderLevel::AVX2;
+#endif
+
+  const auto decode = [&] {
+    if (level == DecoderLevel::Generic)
+    {
+      TexDecoder_DecodeImpl_Generic(dst, src.data(), width, height, format.format,
+                                    tlut.data(), format.tlut_format);
+    }
+    else
+    {
+      TexDecoder_Decode(reinterpret_cast<u8*>(dst), src.data(), width, height,
+                        format.format, tlut.data(), format.tlut_format);
+    }
+  };
+
+  // Warm up the caches first.
+  decode();
+
+  u64 iterations = 0;
+  const auto start = Clock::now();
+  auto now = start;
+  do
+  {
+    for (int i = 0; i < 16; ++i)
+      decode();
+    iterations += 16;
+    now = Clock::now();
+  } while (now - start < duration);
+
+#ifdef _M_X86_64
+  cpu_info.bSSSE3 = old_ssse3;
+  cpu_info.bAVX2 = old_avx2;
+#endif
+
+  const double seconds = std::chrono::duration<double>(now - start).count();
+  return static_cast<double>(iterations) * width * height / seconds;
+}
+
+std::optional<TextureFormat> ParseFormat(const std::string& name)
+{
+  for (const BenchFormat& format : FORMATS)
+  {
+    if (fmt::format("{:n}", format.format) == name)
+      return format.format;
+  }
+  return std::nullopt;
+}
+
+void PrintTextReport(const std::vector<Result>& results, int width, int height)
+{
+  fmt::print(std::cout, "Texture size: {}x{}\n\n", width, height);
+  fmt::print(std::cout, "{:<8} {:<8} {:>14} {:>10}\n", "Format", "Decoder", "MTexels/s",
+             "Speedup");
+
+  double generic_rate = 0;
+  for (const Result& result : results)
+  {
+    if (result.level == DecoderLevel::Generic)
+      generic_rate = result.texels_per_second;
+
+    fmt::print(std::cout, "{:<8} {:<8} {:>14.1f} {:>9.2f}x\n",
+               fmt::format("{:n}", result.format.format), GetLevelName(result.level),
+               result.texels_per_second / 1e6, result.texels_per_second / generic_rate);
+  }
+}
+
+void PrintJSONReport(const std::vector<Result>& results, int width, int height)
+{
+  picojson::array entries;
+  for (const Result& result : results)
+  {
+    picojson::object entry;
+    entry["format"] = picojson::value(fmt::format("{:n}", result.format.format));
+    entry["tlut_format"] = picojson::value(fmt::format("{:n}", result.format.tlut_format));
+    entry["decoder"] = picojson::value(GetLevelName(result.level));
+    entry["texels_per_second"] = picojson::value(result.texels_per_second);
+    entries.emplace_back(std::move(entry));
+  }
+
+  picojson::object json;
+  json["width"] = picojson::value(static_cast<double>(width));
+  json["height"] = picojson::value(static_cast<double>(height));
+  json["results"] = picojson::value(std::move(entries));
+  std::cout << picojson::value(json) << '\n';
+}
+}  // namespace
+
+int TextureDecodeBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: texdecodebench [options]...");
+
+  parser.add_option("-f", "--format")
+      .type("string")
+      .action("store")
+      .help("Optional. Only benchmark the texture format with this NAME (e.g. CMPR).")
+      .metavar("NAME")
+      .set_default("");
+
+  parser.add_option("-W", "--width")
+      .type("int")
+      .action("store")
+      .help("Width of the decoded texture. Default is 512.")
+      .set_default(512);
+
+  parser.add_option("-H", "--height")
+      .type("int")
+      .action("store")
+      .help("Height of the decoded texture. Default is 512.")
+      .set_default(512);
+
+  parser.add_option("-t", "--time")
+      .type("int")
+      .action("store")
+      .help("Milliseconds to spend on each format and decoder. Default is 250.")
+      .set_default(250);
+
+  parser.add_option("-j", "--json")
+      .action("store_true")
+      .help("Optional. Print the results as JSON instead of a table.");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  std::optional<TextureFormat> only_format;
+  if (!options["format"].empty())
+  {
+    only_format = ParseFormat(options["format"]);
+    if (!only_format)
+    {
+      fmt::print(std::cerr, "Error: Unknown texture format {}\n", options["format"]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  const int width = static_cast<int>(options.get("width"));
+  const int height = static_cast<int>(options.get("height"));
+  const int time_ms = static_cast<int>(options.get("time"));
+  // The decoders write whole blocks, and CMPR has the largest ones.
+  if (width < 8 || height < 8 || width % 8 != 0 || height % 8 != 0)
+  {
+    fmt::print(std::cerr, "Error: The width and height must be positive multiples of 8\n");
+    return EXIT_FAILURE;
+  }
+  if (time_ms < 1)
+  {
+    fmt::print(std::cerr, "Error: The time must be at least 1 ms\n");
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> byte(0, 255);
+  const auto random_bytes = [&](size_t size) {
+    std::vector<u8> bytes(size);
+    for (u8& value : bytes)
+      value = static_cast<u8>(byte(rng));
+    return bytes;
+  };
+
+  // Large enough for the palette of C14X2.
+  const std::vector<u8> tlut = random_bytes(0x4000 * sizeof(u16));
+  // Aligned like the buffer of the texture cache.
+  const std::unique_ptr<u32, decltype(&Common::FreeAlignedMemory)> dst(
+      static_cast<u32*>(Common::AllocateAlignedMemory(sizeof(u32) * width * height, 32)),
+      Common::FreeAlignedMemory);
+
+  std::vector<Result> results;
+  for (const BenchFormat& format : FORMATS)
+  {
+    if (only_format && format.format != *only_format)
+      continue;
+
+    const std::vector<u8> src =
+        random_bytes(TexDecoder_GetTextureSizeInBytes(width, height, format.format));
+    for (const DecoderLevel level : GetSupportedLevels())
+    {
+      const double rate = Measure(format, level, width, height, src, tlut, dst.get(),
+                                  std::chrono::milliseconds(time_ms));
+      results.push_back({format, level, rate});
+    }
+  }
+
+  if (options.is_set_by_user("json"))
+    PrintJSONReport(results, width, height);
+  else
+    PrintTextReport(results, width, height);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -14,16 +14,25 @@
 #include "Common/StringUtil.h"
 #include "Core/Core.h"
 
+#include "DolphinTool/CPUCullBenchCommand.h"
 #include "DolphinTool/ConvertCommand.h"
 #include "DolphinTool/ExtractCommand.h"
+#include "DolphinTool/FifoBenchCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/MergeUIDCacheCommand.h"
+#include "DolphinTool/PackTexturesCommand.h"
+#include "DolphinTool/PrecompileShadersCommand.h"
+#include "DolphinTool/ShaderGenBenchCommand.h"
+#include "DolphinTool/TextureDecodeBenchCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+                        "commands supported: [convert, verify, header, extract, fifobench, "
+                        "texdecodebench, shadergenbench, cpucullbench, packtextures, "
+                        "mergeuidcache, precompileshaders]\n");
 }
 
 #ifdef _WIN32
@@ -52,6 +61,20 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "fifobench")
+    return DolphinTool::FifoBenchCommand(args);
+  else if (command_str == "texdecodebench")
+    return DolphinTool::TextureDecodeBenchCommand(args);
+  else if (command_str == "shadergenbench")
+    return DolphinTool::ShaderGenBenchCommand(args);
+  else if (command_str == "cpucullbench")
+    return DolphinTool::CPUCullBenchCommand(args);
+  else if (command_str == "packtextures")
+    return DolphinTool::PackTexturesCommand(args);
+  else if (command_str == "mergeuidcache")
+    return DolphinTool::MergeUIDCacheCommand(args);
+  else if (command_str == "precompileshaders")
+    return DolphinTool::PrecompileShadersCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
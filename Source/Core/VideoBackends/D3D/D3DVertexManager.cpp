@@ -267,24 +267,36 @@ void VertexManager::UploadUniforms()
   auto& vertex_shader_manager = system.GetVertexShaderManager();
   if (vertex_shader_manager.dirty)
   {
-    UpdateConstantBuffer(m_vertex_constant_buffer.Get(), &vertex_shader_manager.constants,
-                         sizeof(VertexShaderConstants));
+    if (IsUniformBlockChanged(UniformBlock::Vertex, &vertex_shader_manager.constants,
+                              sizeof(VertexShaderConstants)))
+    {
+      UpdateConstantBuffer(m_vertex_constant_buffer.Get(), &vertex_shader_manager.constants,
+                           sizeof(VertexShaderConstants));
+    }
     vertex_shader_manager.dirty = false;
   }
 
   auto& geometry_shader_manager = system.GetGeometryShaderManager();
   if (geometry_shader_manager.dirty)
   {
-    UpdateConstantBuffer(m_geometry_constant_buffer.Get(), &geometry_shader_manager.constants,
-                         sizeof(GeometryShaderConstants));
+    if (IsUniformBlockChanged(UniformBlock::Geometry, &geometry_shader_manager.constants,
+                              sizeof(GeometryShaderConstants)))
+    {
+      UpdateConstantBuffer(m_geometry_constant_buffer.Get(), &geometry_shader_manager.constants,
+                           sizeof(GeometryShaderConstants));
+    }
     geometry_shader_manager.dirty = false;
   }
 
   auto& pixel_shader_manager = system.GetPixelShaderManager();
   if (pixel_shader_manager.dirty)
   {
-    UpdateConstantBuffer(m_pixel_constant_buffer.Get(), &pixel_shader_manager.constants,
-                         sizeof(PixelShaderConstants));
+    if (IsUniformBlockChanged(UniformBlock::Pixel, &pixel_shader_manager.constants,
+                              sizeof(PixelShaderConstants)))
+    {
+      UpdateConstantBuffer(m_pixel_constant_buffer.Get(), &pixel_shader_manager.constants,
+                           sizeof(PixelShaderConstants));
+    }
     pixel_shader_manager.dirty = false;
   }
 
@@ -149,7 +149,15 @@ void VertexManager::UpdateVertexShaderConstants()
   auto& system = Core::System::GetInstance();
   auto& vertex_shader_manager = system.GetVertexShaderManager();
 
-  if (!vertex_shader_manager.dirty || !ReserveConstantStorage())
+  if (!vertex_shader_manager.dirty)
+    return;
+  if (!IsUniformBlockChanged(UniformBlock::Vertex, &vertex_shader_manager.constants,
+                             sizeof(VertexShaderConstants)))
+  {
+    vertex_shader_manager.dirty = false;
+    return;
+  }
+  if (!ReserveConstantStorage())
     return;
 
   Gfx::GetInstance()->SetConstantBuffer(1, m_uniform_stream_buffer.GetCurrentGPUPointer());
@@ -165,7 +173,15 @@ void VertexManager::UpdateGeometryShaderConstants()
   auto& system = Core::System::GetInstance();
   auto& geometry_shader_manager = system.GetGeometryShaderManager();
 
-  if (!geometry_shader_manager.dirty || !ReserveConstantStorage())
+  if (!geometry_shader_manager.dirty)
+    return;
+  if (!IsUniformBlockChanged(UniformBlock::Geometry, &geometry_shader_manager.constants,
+                             sizeof(GeometryShaderConstants)))
+  {
+    geometry_shader_manager.dirty = false;
+    return;
+  }
+  if (!ReserveConstantStorage())
     return;
 
   Gfx::GetInstance()->SetConstantBuffer(3, m_uniform_stream_buffer.GetCurrentGPUPointer());
@@ -181,18 +197,23 @@ void VertexManager::UpdatePixelShaderConstants()
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
 
-  if (!ReserveConstantStorage())
+  if (!pixel_shader_manager.dirty)
     return;
-
-  if (pixel_shader_manager.dirty)
+  if (!IsUniformBlockChanged(UniformBlock::Pixel, &pixel_shader_manager.constants,
+                             sizeof(PixelShaderConstants)))
   {
-    Gfx::GetInstance()->SetConstantBuffer(0, m_uniform_stream_buffer.GetCurrentGPUPointer());
-    std::memcpy(m_uniform_stream_buffer.GetCurrentHostPointer(), &pixel_shader_manager.constants,
-                sizeof(PixelShaderConstants));
-    m_uniform_stream_buffer.CommitMemory(sizeof(PixelShaderConstants));
-    ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, sizeof(PixelShaderConstants));
     pixel_shader_manager.dirty = false;
+    return;
   }
+  if (!ReserveConstantStorage())
+    return;
+
+  Gfx::GetInstance()->SetConstantBuffer(0, m_uniform_stream_buffer.GetCurrentGPUPointer());
+  std::memcpy(m_uniform_stream_buffer.GetCurrentHostPointer(), &pixel_shader_manager.constants,
+              sizeof(PixelShaderConstants));
+  m_uniform_stream_buffer.CommitMemory(sizeof(PixelShaderConstants));
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, sizeof(PixelShaderConstants));
+  pixel_shader_manager.dirty = false;
 }
 
 void VertexManager::UpdateCustomShaderConstants()
@@ -299,6 +320,13 @@ void VertexManager::UploadAllConstants()
   m_uniform_stream_buffer.CommitMemory(allocation_size);
   ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, allocation_size);
 
+  SetUploadedUniformBlock(UniformBlock::Pixel, &pixel_shader_manager.constants,
+                          sizeof(PixelShaderConstants));
+  SetUploadedUniformBlock(UniformBlock::Vertex, &vertex_shader_manager.constants,
+                          sizeof(VertexShaderConstants));
+  SetUploadedUniformBlock(UniformBlock::Geometry, &geometry_shader_manager.constants,
+                          sizeof(GeometryShaderConstants));
+
   // Clear dirty flags
   vertex_shader_manager.dirty = false;
   geometry_shader_manager.dirty = false;
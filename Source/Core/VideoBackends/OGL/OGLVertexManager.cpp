@@ -12,14 +12,19 @@
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLExtensions/GLExtensions.h"
 
+#include "Core/System.h"
+
 #include "VideoBackends/OGL/OGLGfx.h"
 #include "VideoBackends/OGL/OGLPipeline.h"
 #include "VideoBackends/OGL/OGLStreamBuffer.h"
 #include "VideoBackends/OGL/ProgramShaderCache.h"
 
+#include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace OGL
@@ -190,6 +195,31 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
 
 void VertexManager::UploadUniforms()
 {
+  // All blocks are streamed together if any of them is dirty, so only drop the dirty flags of the
+  // blocks which didn't change. The ones which did are still remembered as uploaded.
+  auto& system = Core::System::GetInstance();
+  auto& vertex_shader_manager = system.GetVertexShaderManager();
+  if (vertex_shader_manager.dirty &&
+      !IsUniformBlockChanged(UniformBlock::Vertex, &vertex_shader_manager.constants,
+                             sizeof(VertexShaderConstants)))
+  {
+    vertex_shader_manager.dirty = false;
+  }
+  auto& geometry_shader_manager = system.GetGeometryShaderManager();
+  if (geometry_shader_manager.dirty &&
+      !IsUniformBlockChanged(UniformBlock::Geometry, &geometry_shader_manager.constants,
+                             sizeof(GeometryShaderConstants)))
+  {
+    geometry_shader_manager.dirty = false;
+  }
+  auto& pixel_shader_manager = system.GetPixelShaderManager();
+  if (pixel_shader_manager.dirty &&
+      !IsUniformBlockChanged(UniformBlock::Pixel, &pixel_shader_manager.constants,
+                             sizeof(PixelShaderConstants)))
+  {
+    pixel_shader_manager.dirty = false;
+  }
+
   ProgramShaderCache::UploadConstants();
 }
 }  // namespace OGL
@@ -207,7 +207,15 @@ void VertexManager::UpdateVertexShaderConstants()
   auto& system = Core::System::GetInstance();
   auto& vertex_shader_manager = system.GetVertexShaderManager();
 
-  if (!vertex_shader_manager.dirty || !ReserveConstantStorage())
+  if (!vertex_shader_manager.dirty)
+    return;
+  if (!IsUniformBlockChanged(UniformBlock::Vertex, &vertex_shader_manager.constants,
+                             sizeof(VertexShaderConstants)))
+  {
+    vertex_shader_manager.dirty = false;
+    return;
+  }
+  if (!ReserveConstantStorage())
     return;
 
   StateTracker::GetInstance()->SetGXUniformBuffer(
@@ -225,7 +233,15 @@ void VertexManager::UpdateGeometryShaderConstants()
   auto& system = Core::System::GetInstance();
   auto& geometry_shader_manager = system.GetGeometryShaderManager();
 
-  if (!geometry_shader_manager.dirty || !ReserveConstantStorage())
+  if (!geometry_shader_manager.dirty)
+    return;
+  if (!IsUniformBlockChanged(UniformBlock::Geometry, &geometry_shader_manager.constants,
+                             sizeof(GeometryShaderConstants)))
+  {
+    geometry_shader_manager.dirty = false;
+    return;
+  }
+  if (!ReserveConstantStorage())
     return;
 
   StateTracker::GetInstance()->SetGXUniformBuffer(
@@ -243,6 +259,15 @@ void VertexManager::UpdatePixelShaderConstants()
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
 
+  if (pixel_shader_manager.dirty &&
+      !IsUniformBlockChanged(UniformBlock::Pixel, &pixel_shader_manager.constants,
+                             sizeof(PixelShaderConstants)))
+  {
+    pixel_shader_manager.dirty = false;
+  }
+  if (!pixel_shader_manager.dirty && !pixel_shader_manager.custom_constants_dirty)
+    return;
+
   if (!ReserveConstantStorage())
     return;
 
@@ -364,6 +389,13 @@ void VertexManager::UploadAllConstants()
   m_uniform_stream_buffer->CommitMemory(allocation_size);
   ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, allocation_size);
 
+  SetUploadedUniformBlock(UniformBlock::Pixel, &pixel_shader_manager.constants,
+                          sizeof(PixelShaderConstants));
+  SetUploadedUniformBlock(UniformBlock::Vertex, &vertex_shader_manager.constants,
+                          sizeof(VertexShaderConstants));
+  SetUploadedUniformBlock(UniformBlock::Geometry, &geometry_shader_manager.constants,
+                          sizeof(GeometryShaderConstants));
+
   // Clear dirty flags
   vertex_shader_manager.dirty = false;
   geometry_shader_manager.dirty = false;
@@ -3,6 +3,9 @@
 
 #include "VideoCommon/Assets/CustomResourceManager.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 
@@ -10,10 +13,15 @@
 
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
 
 namespace VideoCommon
 {
+// Scheduling the whole prefetch queue every frame would copy thousands of entries for large packs.
+static constexpr std::size_t PREFETCH_BATCH_SIZE = 32;
+
 void CustomResourceManager::Initialize()
 {
   // Use half of available system memory but leave at least 2GiB unused for system stability.
@@ -22,7 +30,8 @@ void CustomResourceManager::Initialize()
   const size_t sys_mem = Common::MemPhysical();
   const size_t keep_unused_mem = std::max(sys_mem / 2, std::min(sys_mem, must_keep_unused));
 
-  m_max_ram_available = sys_mem - keep_unused_mem;
+  m_default_max_ram_available = sys_mem - keep_unused_mem;
+  m_max_ram_available = m_default_max_ram_available;
 
   if (m_max_ram_available == 0)
     ERROR_LOG_FMT(VIDEO, "Not enough system memory for custom resources.");
@@ -46,6 +55,7 @@ void CustomResourceManager::Reset()
 
   m_active_assets = {};
   m_pending_assets = {};
+  m_prefetch_assets = {};
   m_asset_handle_to_data.clear();
   m_asset_id_to_handle.clear();
   m_texture_data_asset_cache.clear();
@@ -81,6 +91,22 @@ CustomResourceManager::TextureTimePair CustomResourceManager::GetTextureDataFrom
   return {};
 }
 
+void CustomResourceManager::PrefetchTextureDataAsset(
+    const CustomAssetLibrary::AssetID& asset_id,
+    std::shared_ptr<VideoCommon::CustomAssetLibrary> library)
+{
+  auto& resource = m_texture_data_asset_cache[asset_id];
+
+  // Already loaded or requested by the game
+  if (resource.asset)
+    return;
+
+  resource.asset =
+      CreateAsset<TextureAsset>(asset_id, AssetData::AssetType::TextureData, std::move(library));
+  resource.asset_data = &m_asset_handle_to_data[resource.asset->GetHandle()];
+  m_prefetch_assets.InsertAsset(resource.asset->GetHandle(), resource.asset);
+}
+
 void CustomResourceManager::LoadTextureDataAsset(
     const CustomAssetLibrary::AssetID& asset_id,
     std::shared_ptr<VideoCommon::CustomAssetLibrary> library, InternalTextureDataResource* resource)
@@ -99,6 +125,7 @@ void CustomResourceManager::LoadTextureDataAsset(
     const auto asset_handle = resource->asset->GetHandle();
     m_pending_assets.MakeAssetHighestPriority(asset_handle,
                                               m_asset_handle_to_data[asset_handle].asset.get());
+    m_prefetch_assets.RemoveAsset(asset_handle);
   }
   else if (resource->asset_data->load_status == AssetData::LoadStatus::LoadFinished)
   {
@@ -112,19 +139,39 @@ void CustomResourceManager::XFBTriggered()
   ProcessDirtyAssets();
   ProcessLoadedAssets();
 
+  const int memory_budget_mib = g_ActiveConfig.iHiresTexturesMemoryBudget;
+  m_max_ram_available = memory_budget_mib > 0 ? u64(memory_budget_mib) * 1024 * 1024 :
+                                                m_default_max_ram_available;
+
   if (m_ram_used > m_max_ram_available)
   {
     RemoveAssetsUntilBelowMemoryLimit();
   }
 
-  if (m_pending_assets.IsEmpty())
-    return;
+  g_stats.custom_texture_ram_bytes = m_ram_used;
 
   if (m_ram_used > m_max_ram_available)
     return;
 
-  const u64 allowed_memory = m_max_ram_available - m_ram_used;
-  m_asset_loader.ScheduleAssetsToLoad(m_pending_assets.Elements(), allowed_memory);
+  if (!m_pending_assets.IsEmpty())
+  {
+    const u64 allowed_memory = m_max_ram_available - m_ram_used;
+    m_asset_loader.ScheduleAssetsToLoad(m_pending_assets.Elements(), allowed_memory);
+    return;
+  }
+
+  // Stop prefetching at the threshold RemoveAssetsUntilBelowMemoryLimit evicts down to, otherwise
+  // every prefetched asset would push out an older one.
+  const u64 prefetch_limit = m_max_ram_available * 8 / 10;
+  if (m_prefetch_assets.IsEmpty() || m_ram_used >= prefetch_limit)
+    return;
+
+  const auto& prefetch_assets = m_prefetch_assets.Elements();
+  const auto batch_end =
+      std::next(prefetch_assets.begin(),
+                static_cast<std::ptrdiff_t>(std::min(prefetch_assets.size(), PREFETCH_BATCH_SIZE)));
+  m_asset_loader.ScheduleAssetsToLoad({prefetch_assets.begin(), batch_end},
+                                      prefetch_limit - m_ram_used);
 }
 
 void CustomResourceManager::ProcessDirtyAssets()
@@ -178,6 +225,7 @@ void CustomResourceManager::ProcessLoadedAssets()
       continue;
 
     m_pending_assets.RemoveAsset(handle);
+    m_prefetch_assets.RemoveAsset(handle);
 
     asset_data.load_request_time = {};
     if (!load_successful)
@@ -47,6 +47,12 @@ public:
   TextureTimePair GetTextureDataFromAsset(const CustomAssetLibrary::AssetID& asset_id,
                                           std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
 
+  // Loads the texture data in the background ahead of its first use. Prefetched assets are only
+  // loaded when nothing the game asked for is waiting and there is room left in the memory budget,
+  // so they never push out assets that were used.
+  void PrefetchTextureDataAsset(const CustomAssetLibrary::AssetID& asset_id,
+                                std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
+
 private:
   // A generic interface to describe an assets' type
   // and load state
@@ -193,14 +199,18 @@ private:
   // Ordered by most recently used.
   AssetPriorityQueue m_pending_assets;
 
+  // Assets to load once there is nothing pending, in the order they were prefetched.
+  AssetPriorityQueue m_prefetch_assets;
+
   std::map<std::size_t, AssetData> m_asset_handle_to_data;
   std::map<CustomAssetLibrary::AssetID, std::size_t> m_asset_id_to_handle;
 
   // Memory used by currently "loaded" assets.
   u64 m_ram_used = 0;
 
-  // A calculated amount of memory to avoid exceeding.
+  // The amount of memory to avoid exceeding, either set by the user or calculated.
   u64 m_max_ram_available = 0;
+  u64 m_default_max_ram_available = 0;
 
   std::map<CustomAssetLibrary::AssetID, InternalTextureDataResource> m_texture_data_asset_cache;
 
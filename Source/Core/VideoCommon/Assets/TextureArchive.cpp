@@ -0,0 +1,369 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TextureArchive.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include <xxhash.h>
+
+#include "Common/Align.h"
+#include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
+#include "VideoCommon/AbstractTexture.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr u32 ARCHIVE_MAGIC = 0x4b505444;  // "DTPK"
+constexpr u32 ARCHIVE_VERSION = 1;
+
+// Level data is aligned so that it can be copied efficiently out of the mapping.
+constexpr u64 DATA_ALIGNMENT = 16;
+
+constexpr u8 FLAG_ARBITRARY_MIPMAPS = 1;
+
+// File layout: the header, the data of all levels, then the hash table, the levels and the names
+// the header points to. All values are little endian.
+#pragma pack(push, 1)
+
+struct ArchiveHeader
+{
+  u32 magic;
+  u32 version;
+  u32 num_textures;
+  u32 num_buckets;
+  u64 buckets_offset;
+  u64 levels_offset;
+  u32 num_levels;
+  u32 names_size;
+  u64 names_offset;
+  u8 reserved[16];
+};
+static_assert(sizeof(ArchiveHeader) == 64, "ArchiveHeader should be 64 bytes");
+
+// A bucket of the hash table. A texture is in the first bucket at or after the one its name hash
+// maps to, wrapping around at the end. The table is never full, and empty buckets have no levels.
+struct ArchiveBucket
+{
+  u64 name_hash;
+  u32 name_offset;
+  u32 name_size;
+  u32 first_level;
+  u16 num_levels;
+  u8 format;
+  u8 flags;
+};
+static_assert(sizeof(ArchiveBucket) == 24, "ArchiveBucket should be 24 bytes");
+
+struct ArchiveLevel
+{
+  u64 data_offset;
+  u64 data_size;
+  u32 width;
+  u32 height;
+  u32 row_length;
+  u32 reserved;
+};
+static_assert(sizeof(ArchiveLevel) == 32, "ArchiveLevel should be 32 bytes");
+
+#pragma pack(pop)
+
+// The formats that LoadDDSTexture and LoadPNGTexture produce.
+constexpr std::array SUPPORTED_FORMATS = {AbstractTextureFormat::RGBA8, AbstractTextureFormat::DXT1,
+                                          AbstractTextureFormat::DXT3, AbstractTextureFormat::DXT5,
+                                          AbstractTextureFormat::BPTC};
+
+bool IsSupportedFormat(AbstractTextureFormat format)
+{
+  return std::ranges::find(SUPPORTED_FORMATS, format) != SUPPORTED_FORMATS.end();
+}
+
+u64 HashName(std::string_view name)
+{
+  return XXH3_64bits(name.data(), name.size());
+}
+
+u64 GetMinimumLevelSize(AbstractTextureFormat format, u32 row_length, u32 height)
+{
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(format);
+  return static_cast<u64>(AbstractTexture::CalculateStrideForFormat(format, row_length)) *
+         ((height + block_size - 1) / block_size);
+}
+
+bool IsRangeInFile(u64 offset, u64 size, u64 file_size)
+{
+  return offset <= file_size && size <= file_size - offset;
+}
+
+template <typename T>
+T ReadStruct(const u8* data, u32 index)
+{
+  T value;
+  std::memcpy(&value, data + static_cast<size_t>(index) * sizeof(T), sizeof(T));
+  return value;
+}
+}  // namespace
+
+bool TextureArchive::Open(const std::string& path)
+{
+  if (!m_file.Open(path))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open texture archive '{}'", path);
+    return false;
+  }
+
+  const std::span<const u8> header_data = m_file.GetRange(0, sizeof(ArchiveHeader));
+  if (header_data.empty())
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture archive '{}' is too small", path);
+    return false;
+  }
+
+  ArchiveHeader header;
+  std::memcpy(&header, header_data.data(), sizeof(header));
+  if (header.magic != ARCHIVE_MAGIC || header.version != ARCHIVE_VERSION)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture archive '{}' has an unknown format or version", path);
+    return false;
+  }
+
+  const u64 file_size = m_file.GetSize();
+  if (!MathUtil::IsPow2(header.num_buckets) || header.num_textures >= header.num_buckets ||
+      !IsRangeInFile(header.buckets_offset, u64{header.num_buckets} * sizeof(ArchiveBucket),
+                     file_size) ||
+      !IsRangeInFile(header.levels_offset, u64{header.num_levels} * sizeof(ArchiveLevel),
+                     file_size) ||
+      !IsRangeInFile(header.names_offset, header.names_size, file_size))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture archive '{}' has a corrupted header", path);
+    return false;
+  }
+
+  m_path = path;
+  m_num_textures = header.num_textures;
+  m_buckets = m_file.GetData() + header.buckets_offset;
+  m_num_buckets = header.num_buckets;
+  m_levels = m_file.GetData() + header.levels_offset;
+  m_num_levels = header.num_levels;
+  m_names = reinterpret_cast<const char*>(m_file.GetData() + header.names_offset);
+  m_names_size = header.names_size;
+  return true;
+}
+
+std::string_view TextureArchive::GetName(u32 offset, u32 size) const
+{
+  if (offset > m_names_size || size > m_names_size - offset)
+    return {};
+  return {m_names + offset, size};
+}
+
+std::optional<u32> TextureArchive::FindBucket(std::string_view name) const
+{
+  if (m_num_textures == 0)
+    return std::nullopt;
+
+  const u64 hash = HashName(name);
+  const u32 mask = m_num_buckets - 1;
+  for (u32 i = 0, index = static_cast<u32>(hash) & mask; i < m_num_buckets;
+       ++i, index = (index + 1) & mask)
+  {
+    const auto bucket = ReadStruct<ArchiveBucket>(m_buckets, index);
+    if (bucket.num_levels == 0)
+      return std::nullopt;
+    if (bucket.name_hash == hash && GetName(bucket.name_offset, bucket.name_size) == name)
+      return index;
+  }
+  return std::nullopt;
+}
+
+std::optional<TextureArchive::Texture> TextureArchive::FindTexture(std::string_view name) const
+{
+  const std::optional<u32> index = FindBucket(name);
+  if (!index)
+    return std::nullopt;
+
+  const auto bucket = ReadStruct<ArchiveBucket>(m_buckets, *index);
+  return Texture{GetName(bucket.name_offset, bucket.name_size),
+                 (bucket.flags & FLAG_ARBITRARY_MIPMAPS) != 0};
+}
+
+void TextureArchive::ForEachTexture(const std::function<void(const Texture&)>& function) const
+{
+  for (u32 i = 0; i < m_num_buckets; ++i)
+  {
+    const auto bucket = ReadStruct<ArchiveBucket>(m_buckets, i);
+    if (bucket.num_levels == 0)
+      continue;
+
+    const std::string_view name = GetName(bucket.name_offset, bucket.name_size);
+    if (!name.empty())
+      function(Texture{name, (bucket.flags & FLAG_ARBITRARY_MIPMAPS) != 0});
+  }
+}
+
+bool TextureArchive::LoadTexture(std::string_view name, CustomTextureData* data) const
+{
+  const std::optional<u32> index = FindBucket(name);
+  if (!index)
+    return false;
+
+  const auto bucket = ReadStruct<ArchiveBucket>(m_buckets, *index);
+  const auto format = static_cast<AbstractTextureFormat>(bucket.format);
+  if (!IsSupportedFormat(format) || bucket.first_level > m_num_levels ||
+      bucket.num_levels > m_num_levels - bucket.first_level)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture '{}' in archive '{}' is corrupted", name, m_path);
+    return false;
+  }
+
+  data->m_slices.clear();
+  auto& slice = data->m_slices.emplace_back();
+  slice.m_levels.resize(bucket.num_levels);
+  for (u32 i = 0; i < bucket.num_levels; ++i)
+  {
+    const auto level = ReadStruct<ArchiveLevel>(m_levels, bucket.first_level + i);
+    const std::span<const u8> level_data = m_file.GetRange(level.data_offset, level.data_size);
+    if (level_data.empty() || level.row_length < level.width ||
+        level.data_size < GetMinimumLevelSize(format, level.row_length, level.height))
+    {
+      ERROR_LOG_FMT(VIDEO, "Level {} of texture '{}' in archive '{}' is corrupted", i, name,
+                    m_path);
+      data->m_slices.clear();
+      return false;
+    }
+
+    auto& out = slice.m_levels[i];
+    out.format = format;
+    out.width = level.width;
+    out.height = level.height;
+    out.row_length = level.row_length;
+    out.data.reset(level_data.size());
+    std::memcpy(out.data.data(), level_data.data(), level_data.size());
+  }
+
+  return true;
+}
+
+bool TextureArchiveWriter::Open(const std::string& path)
+{
+  m_textures.clear();
+  m_levels.clear();
+  m_names.clear();
+
+  // The header is written last, once the offsets of the index are known.
+  const ArchiveHeader header{};
+  return m_file.Open(path, "wb") && m_file.WriteBytes(&header, sizeof(header));
+}
+
+bool TextureArchiveWriter::AddTexture(std::string name, bool has_arbitrary_mipmaps,
+                                      const CustomTextureData& data)
+{
+  if (data.m_slices.empty() || data.m_slices[0].m_levels.empty())
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture '{}' has no levels", name);
+    return false;
+  }
+
+  const auto& levels = data.m_slices[0].m_levels;
+  const AbstractTextureFormat format = levels[0].format;
+  if (!IsSupportedFormat(format) || levels.size() > std::numeric_limits<u16>::max() ||
+      std::ranges::any_of(levels, [format](const auto& level) { return level.format != format; }))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture '{}' has a format that can't be stored", name);
+    return false;
+  }
+
+  if (name.empty() || m_names.contains(name))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture '{}' was already added", name);
+    return false;
+  }
+
+  const u32 first_level = static_cast<u32>(m_levels.size());
+  for (const auto& level : levels)
+  {
+    const u64 offset = Common::AlignUp(m_file.Tell(), DATA_ALIGNMENT);
+    if (!m_file.Seek(offset, File::SeekOrigin::Begin) ||
+        !m_file.WriteBytes(level.data.data(), level.data.size()))
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to write texture '{}'", name);
+      m_levels.resize(first_level);
+      return false;
+    }
+    m_levels.push_back({offset, level.data.size(), level.width, level.height, level.row_length});
+  }
+
+  m_names.insert(name);
+  m_textures.push_back({std::move(name), has_arbitrary_mipmaps, format, first_level,
+                        static_cast<u32>(levels.size())});
+  return true;
+}
+
+bool TextureArchiveWriter::Finish()
+{
+  // At most half full, which keeps the probe sequences short.
+  const u32 num_buckets = MathUtil::NextPowerOf2(static_cast<u32>(m_textures.size()) * 2 + 1);
+  const u32 mask = num_buckets - 1;
+
+  std::vector<ArchiveBucket> buckets(num_buckets);
+  std::string names;
+  for (const PendingTexture& texture : m_textures)
+  {
+    const u64 hash = HashName(texture.name);
+    u32 index = static_cast<u32>(hash) & mask;
+    while (buckets[index].num_levels != 0)
+      index = (index + 1) & mask;
+
+    buckets[index] = {
+        .name_hash = hash,
+        .name_offset = static_cast<u32>(names.size()),
+        .name_size = static_cast<u32>(texture.name.size()),
+        .first_level = texture.first_level,
+        .num_levels = static_cast<u16>(texture.num_levels),
+        .format = static_cast<u8>(texture.format),
+        .flags = texture.has_arbitrary_mipmaps ? FLAG_ARBITRARY_MIPMAPS : u8{0},
+    };
+    names += texture.name;
+  }
+
+  std::vector<ArchiveLevel> levels;
+  levels.reserve(m_levels.size());
+  for (const PendingLevel& level : m_levels)
+  {
+    levels.push_back({level.data_offset, level.data_size, level.width, level.height,
+                      level.row_length, 0});
+  }
+
+  ArchiveHeader header{};
+  header.magic = ARCHIVE_MAGIC;
+  header.version = ARCHIVE_VERSION;
+  header.num_textures = static_cast<u32>(m_textures.size());
+  header.num_buckets = num_buckets;
+  header.num_levels = static_cast<u32>(levels.size());
+  header.names_size = static_cast<u32>(names.size());
+
+  if (!m_file.Seek(Common::AlignUp(m_file.Tell(), DATA_ALIGNMENT), File::SeekOrigin::Begin))
+    return false;
+
+  header.buckets_offset = m_file.Tell();
+  if (!m_file.WriteArray(buckets.data(), buckets.size()))
+    return false;
+
+  header.levels_offset = m_file.Tell();
+  if (!m_file.WriteArray(levels.data(), levels.size()))
+    return false;
+
+  header.names_offset = m_file.Tell();
+  if (!m_file.WriteString(names))
+    return false;
+
+  return m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteBytes(&header, sizeof(header)) &&
+         m_file.Close();
+}
+}  // namespace VideoCommon
@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/MappedFile.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+namespace VideoCommon
+{
+// A single file holding all textures of a custom texture pack. Texture packs with thousands of
+// loose files take a long time to search and open, while an archive is only mapped into memory
+// and textures are found through a hash table stored in the file.
+//
+// Textures are stored in the format they are uploaded in (e.g. BCn straight from DDS files) with
+// all of their mipmaps, so loading a texture only copies it out of the mapping.
+class TextureArchive
+{
+public:
+  static constexpr std::string_view FILE_EXTENSION = ".dtp";
+
+  struct Texture
+  {
+    std::string_view name;
+    bool has_arbitrary_mipmaps;
+  };
+
+  // Returns false if the file can't be mapped or is not a valid archive.
+  bool Open(const std::string& path);
+
+  const std::string& GetPath() const { return m_path; }
+  u32 GetTextureCount() const { return m_num_textures; }
+
+  std::optional<Texture> FindTexture(std::string_view name) const;
+  // Calls the function for every texture in the archive, in no particular order.
+  void ForEachTexture(const std::function<void(const Texture&)>& function) const;
+
+  // Copies the levels of a texture into a single array slice. Returns false if there is no such
+  // texture or if its data is corrupted.
+  bool LoadTexture(std::string_view name, CustomTextureData* data) const;
+
+private:
+  std::optional<u32> FindBucket(std::string_view name) const;
+  std::string_view GetName(u32 offset, u32 size) const;
+
+  File::MappedFile m_file;
+  std::string m_path;
+
+  u32 m_num_textures = 0;
+  const u8* m_buckets = nullptr;
+  u32 m_num_buckets = 0;
+  const u8* m_levels = nullptr;
+  u32 m_num_levels = 0;
+  const char* m_names = nullptr;
+  u32 m_names_size = 0;
+};
+
+// Builds a texture archive. The texture data is written out as textures are added, so only the
+// index is held in memory.
+class TextureArchiveWriter
+{
+public:
+  bool Open(const std::string& path);
+
+  // Only stores the first array slice. Returns false if the texture can't be stored, or if there
+  // already is a texture with the same name.
+  bool AddTexture(std::string name, bool has_arbitrary_mipmaps, const CustomTextureData& data);
+
+  // Writes the index. The archive can't be opened before this is called.
+  bool Finish();
+
+private:
+  struct PendingLevel
+  {
+    u64 data_offset;
+    u64 data_size;
+    u32 width;
+    u32 height;
+    u32 row_length;
+  };
+
+  struct PendingTexture
+  {
+    std::string name;
+    bool has_arbitrary_mipmaps;
+    AbstractTextureFormat format;
+    u32 first_level;
+    u32 num_levels;
+  };
+
+  File::IOFile m_file;
+  std::vector<PendingTexture> m_textures;
+  std::vector<PendingLevel> m_levels;
+  std::unordered_set<std::string> m_names;
+};
+}  // namespace VideoCommon
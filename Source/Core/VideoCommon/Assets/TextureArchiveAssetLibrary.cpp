@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TextureArchiveAssetLibrary.h"
+
+#include <utility>
+
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon
+{
+namespace
+{
+bool IsFormatSupportedByBackend(AbstractTextureFormat format)
+{
+  switch (format)
+  {
+  case AbstractTextureFormat::DXT1:
+  case AbstractTextureFormat::DXT3:
+  case AbstractTextureFormat::DXT5:
+    return g_backend_info.bSupportsST3CTextures;
+  case AbstractTextureFormat::BPTC:
+    return g_backend_info.bSupportsBPTCTextures;
+  default:
+    return true;
+  }
+}
+}  // namespace
+
+CustomAssetLibrary::LoadInfo TextureArchiveAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                     TextureAndSamplerData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture archives don't store samplers!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TextureArchiveAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                     CustomTextureData* data)
+{
+  for (const TextureArchive& archive : m_archives)
+  {
+    if (!archive.FindTexture(asset_id))
+      continue;
+
+    if (!archive.LoadTexture(asset_id, data))
+      return {};
+
+    const auto& levels = data->m_slices[0].m_levels;
+    if (!IsFormatSupportedByBackend(levels[0].format))
+    {
+      ERROR_LOG_FMT(VIDEO,
+                    "Asset '{}' error - the texture is compressed in a format that the video "
+                    "backend doesn't support!",
+                    asset_id);
+      return {};
+    }
+
+    if (!PurgeInvalidMipsFromTextureData(asset_id, data))
+      return {};
+
+    std::size_t size = 0;
+    for (const auto& level : levels)
+      size += level.data.size();
+    return LoadInfo{size};
+  }
+
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture not found in any archive!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo
+TextureArchiveAssetLibrary::LoadRasterSurfaceShader(const AssetID& asset_id,
+                                                    RasterSurfaceShaderData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture archives only store textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TextureArchiveAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                      MaterialData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture archives only store textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TextureArchiveAssetLibrary::LoadMesh(const AssetID& asset_id,
+                                                                  MeshData* data)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture archives only store textures!", asset_id);
+  return {};
+}
+
+bool TextureArchiveAssetLibrary::AddArchive(const std::string& path)
+{
+  TextureArchive archive;
+  if (!archive.Open(path))
+    return false;
+
+  m_archives.push_back(std::move(archive));
+  return true;
+}
+
+u32 TextureArchiveAssetLibrary::GetTextureCount() const
+{
+  u32 count = 0;
+  for (const TextureArchive& archive : m_archives)
+    count += archive.GetTextureCount();
+  return count;
+}
+
+std::optional<TextureArchive::Texture>
+TextureArchiveAssetLibrary::FindTexture(std::string_view name) const
+{
+  for (const TextureArchive& archive : m_archives)
+  {
+    if (auto texture = archive.FindTexture(name))
+      return texture;
+  }
+  return std::nullopt;
+}
+
+void TextureArchiveAssetLibrary::ForEachTexture(
+    const std::function<void(const TextureArchive::Texture&)>& function) const
+{
+  for (size_t i = 0; i < m_archives.size(); ++i)
+  {
+    m_archives[i].ForEachTexture([&](const TextureArchive::Texture& texture) {
+      for (size_t j = 0; j < i; ++j)
+      {
+        if (m_archives[j].FindTexture(texture.name))
+          return;
+      }
+      function(texture);
+    });
+  }
+}
+}  // namespace VideoCommon
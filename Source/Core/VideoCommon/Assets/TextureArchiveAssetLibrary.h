@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/TextureArchive.h"
+
+namespace VideoCommon
+{
+// This class implements 'CustomAssetLibrary' and loads raw textures out of texture archives.
+// The asset id of a texture is its name in the archive. Archives are only added before the
+// library is handed out, so lookups don't need any locking.
+class TextureArchiveAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureAndSamplerData* data) override;
+  LoadInfo LoadTexture(const AssetID& asset_id, CustomTextureData* data) override;
+  LoadInfo LoadRasterSurfaceShader(const AssetID& asset_id, RasterSurfaceShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+  // Textures are looked up in the archives in the order they were added.
+  bool AddArchive(const std::string& path);
+
+  bool IsEmpty() const { return m_archives.empty(); }
+  u32 GetTextureCount() const;
+
+  std::optional<TextureArchive::Texture> FindTexture(std::string_view name) const;
+  // Calls the function for every texture, skipping textures hidden by an earlier archive.
+  void ForEachTexture(const std::function<void(const TextureArchive::Texture&)>& function) const;
+
+private:
+  std::vector<TextureArchive> m_archives;
+};
+}  // namespace VideoCommon
@@ -20,6 +20,8 @@ public:
 
   // Called from the Video thread.
   void PullEvents();
+  // Can be called from any thread, e.g. for the pipelined GPU thread to hand over work early.
+  bool HasPendingEvents() const { return !m_queue.Empty(); }
 
   // The following are called from the CPU thread.
   void WaitForEmptyQueue();
@@ -3,11 +3,13 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/TimelineTrace.h"
 
 #include "Core/Core.h"
 #include "Core/System.h"
@@ -26,12 +28,29 @@ AsyncShaderCompiler::~AsyncShaderCompiler()
 }
 
 void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
+{
+  QueuePendingWorkItem({std::move(item), Clock::now()}, priority);
+}
+
+void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority,
+                                        Clock::time_point deadline, u32 expired_priority)
+{
+  QueuePendingWorkItem({std::move(item), Clock::now(), deadline, expired_priority}, priority);
+}
+
+void AsyncShaderCompiler::QueuePendingWorkItem(PendingWorkItem item, u32 priority)
 {
   // If no worker threads are available, compile synchronously.
   if (!HasWorkerThreads())
   {
-    item->Compile();
-    m_completed_work.push_back(std::move(item));
+    TIMELINE_TRACE_SCOPE("Shader compile");
+    item.item->Compile();
+    u64 generation;
+    {
+      std::lock_guard<std::mutex> guard(m_completed_work_lock);
+      generation = m_generation;
+    }
+    AddCompletedWorkItem(std::move(item.item), item.queue_time, generation);
   }
   else
   {
@@ -41,6 +60,41 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
 }
 
+void AsyncShaderCompiler::AddCompletedWorkItem(WorkItemPtr item, Clock::time_point queue_time,
+                                               u64 generation)
+{
+  const float latency_ms =
+      std::chrono::duration<float, std::milli>(Clock::now() - queue_time).count();
+
+  std::lock_guard<std::mutex> guard(m_completed_work_lock);
+  if (generation != m_generation)
+  {
+    // Cancelled while compiling, the item is destroyed after the lock is released.
+    m_num_wasted++;
+    return;
+  }
+
+  m_latency_samples[m_num_latency_samples++ % LATENCY_SAMPLES] = latency_ms;
+  m_num_completed++;
+  m_completed_work.push_back(std::move(item));
+}
+
+void AsyncShaderCompiler::CancelPendingWork()
+{
+  // The items are destroyed after the locks are released, as that can destroy pipelines.
+  std::multimap<u32, PendingWorkItem> pending_work;
+  std::deque<WorkItemPtr> completed_work;
+  {
+    std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
+    std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
+    m_generation++;
+    m_num_cancelled += m_pending_work.size();
+    m_num_wasted += m_completed_work.size();
+    m_pending_work.swap(pending_work);
+    m_completed_work.swap(completed_work);
+  }
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
@@ -68,6 +122,38 @@ bool AsyncShaderCompiler::HasCompletedWork()
   return !m_completed_work.empty();
 }
 
+AsyncShaderCompiler::Statistics AsyncShaderCompiler::GetStatistics()
+{
+  Statistics stats;
+  {
+    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    stats.pending_items = m_pending_work.size();
+    stats.busy_workers = m_busy_workers.load();
+    stats.expired_items = m_num_expired;
+  }
+
+  std::array<float, LATENCY_SAMPLES> samples;
+  size_t num_samples;
+  {
+    std::lock_guard<std::mutex> guard(m_completed_work_lock);
+    stats.completed_items = m_num_completed;
+    stats.cancelled_items = m_num_cancelled;
+    stats.wasted_items = m_num_wasted;
+    samples = m_latency_samples;
+    num_samples = std::min(m_num_latency_samples, LATENCY_SAMPLES);
+  }
+
+  if (num_samples != 0)
+  {
+    std::sort(samples.begin(), samples.begin() + num_samples);
+    const auto percentile = [&](size_t p) { return samples[(num_samples - 1) * p / 100]; };
+    stats.latency_p50_ms = percentile(50);
+    stats.latency_p90_ms = percentile(90);
+    stats.latency_p99_ms = percentile(99);
+  }
+  return stats;
+}
+
 bool AsyncShaderCompiler::WaitUntilCompletion(
     const std::function<void(size_t, size_t)>& progress_callback)
 {
@@ -216,21 +302,39 @@ void AsyncShaderCompiler::WorkerThreadRun()
   std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
+    // Work can be queued before this thread starts waiting, so the wakeup can't be relied on.
+    m_worker_thread_wake.wait(pending_lock,
+                              [this] { return !m_pending_work.empty() || m_exit_flag.IsSet(); });
 
     while (!m_pending_work.empty() && !m_exit_flag.IsSet())
     {
-      m_busy_workers++;
       auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
+      PendingWorkItem pending(std::move(iter->second));
       m_pending_work.erase(iter);
+
+      // Work that wasn't started in time is probably no longer needed as urgently, so it moves
+      // behind the work that was queued since.
+      if (pending.deadline && Clock::now() > *pending.deadline)
+      {
+        const u32 expired_priority = pending.expired_priority;
+        pending.deadline.reset();
+        m_pending_work.emplace(expired_priority, std::move(pending));
+        m_num_expired++;
+        continue;
+      }
+
+      m_busy_workers++;
+      const u64 generation = m_generation;
       pending_lock.unlock();
 
-      if (item->Compile())
+      bool compiled;
       {
-        std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-        m_completed_work.push_back(std::move(item));
+        TIMELINE_TRACE_SCOPE("Shader compile");
+        compiled = pending.item->Compile();
       }
+      if (compiled)
+        AddCompletedWorkItem(std::move(pending.item), pending.queue_time, generation);
+      pending.item.reset();
 
       pending_lock.lock();
       m_busy_workers--;
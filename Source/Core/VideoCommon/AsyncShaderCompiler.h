@@ -3,13 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -32,6 +35,24 @@ public:
   };
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
+  using Clock = std::chrono::steady_clock;
+
+  struct Statistics
+  {
+    size_t pending_items = 0;
+    size_t busy_workers = 0;
+    u64 completed_items = 0;
+    // Items that missed their deadline and were moved to their expired priority.
+    u64 expired_items = 0;
+    // Items that were dropped before being compiled, and items that were compiled but dropped
+    // because they were cancelled while compiling.
+    u64 cancelled_items = 0;
+    u64 wasted_items = 0;
+    // Time from queueing to the end of the compile, over the most recent items.
+    float latency_p50_ms = 0;
+    float latency_p90_ms = 0;
+    float latency_p99_ms = 0;
+  };
 
   AsyncShaderCompiler();
   virtual ~AsyncShaderCompiler();
@@ -45,9 +66,17 @@ public:
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+  // Same as above, but if a worker picks up the item after the deadline, it is requeued with
+  // expired_priority instead, behind the work that was queued more recently.
+  void QueueWorkItem(WorkItemPtr item, u32 priority, Clock::time_point deadline,
+                     u32 expired_priority);
+  // Drops all pending work, and the results of the work that is currently compiling. The work
+  // items are destroyed without being retrieved.
+  void CancelPendingWork();
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
+  Statistics GetStatistics();
 
   // Calls progress_callback periodically, with completed_items, and total_items.
   // Returns false if interrupted.
@@ -65,8 +94,21 @@ protected:
   virtual void WorkerThreadExit(void* param);
 
 private:
+  struct PendingWorkItem
+  {
+    WorkItemPtr item;
+    Clock::time_point queue_time;
+    std::optional<Clock::time_point> deadline;
+    u32 expired_priority = 0;
+  };
+
+  // Number of recent compile latencies the percentiles are computed from.
+  static constexpr size_t LATENCY_SAMPLES = 256;
+
   void WorkerThreadEntryPoint(void* param);
   void WorkerThreadRun();
+  void QueuePendingWorkItem(PendingWorkItem item, u32 priority);
+  void AddCompletedWorkItem(WorkItemPtr item, Clock::time_point queue_time, u64 generation);
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -76,13 +118,26 @@ private:
 
   // A multimap is used to store the work items. We can't use a priority_queue here, because
   // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
+  std::multimap<u32, PendingWorkItem> m_pending_work;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
   std::atomic_size_t m_busy_workers{0};
 
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
+
+  // Incremented by CancelPendingWork. Items that finish compiling with an older generation are
+  // dropped. Only changed with both locks held.
+  u64 m_generation = 0;
+
+  // Guarded by m_completed_work_lock, except m_num_expired, which is guarded by
+  // m_pending_work_lock.
+  u64 m_num_expired = 0;
+  u64 m_num_completed = 0;
+  u64 m_num_cancelled = 0;
+  u64 m_num_wasted = 0;
+  std::array<float, LATENCY_SAMPLES> m_latency_samples{};
+  size_t m_num_latency_samples = 0;
 };
 
 }  // namespace VideoCommon
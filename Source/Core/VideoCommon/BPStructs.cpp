@@ -37,6 +37,7 @@
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -54,6 +55,38 @@ void BPInit()
   bpmem.bpMask = 0xFFFFFF;
 }
 
+// Registers which only set up a later copy, clear or texture load, and don't affect primitives.
+// The command that triggers the operation flushes the pipeline, so the primitives before and after
+// writes to these registers can still be drawn together.
+static bool IsDeferrableBPReg(u8 address)
+{
+  switch (address)
+  {
+  case BPMEM_DISPLAYCOPYFILTER:
+  case BPMEM_DISPLAYCOPYFILTER + 1:
+  case BPMEM_DISPLAYCOPYFILTER + 2:
+  case BPMEM_DISPLAYCOPYFILTER + 3:
+  case BPMEM_COPYFILTER0:
+  case BPMEM_COPYFILTER1:
+  case BPMEM_EFB_TL:
+  case BPMEM_EFB_WH:
+  case BPMEM_EFB_ADDR:
+  case BPMEM_EFB_STRIDE:
+  case BPMEM_COPYYSCALE:
+  case BPMEM_CLEAR_AR:
+  case BPMEM_CLEAR_GB:
+  case BPMEM_CLEAR_Z:
+  case BPMEM_PRELOAD_ADDR:
+  case BPMEM_PRELOAD_TMEMEVEN:
+  case BPMEM_PRELOAD_TMEMODD:
+  case BPMEM_LOADTLUT0:
+  case BPMEM_BP_MASK:
+    return true;
+  default:
+    return false;
+  }
+}
+
 static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager& xf_state_manager,
                       GeometryShaderManager& geometry_shader_manager, const BPCmd& bp,
                       int cycles_into_future)
@@ -92,7 +125,10 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     }
   }
 
-  FlushPipeline();
+  if (!IsDeferrableBPReg(bp.address))
+    FlushPipeline();
+  else if (g_vertex_manager->HasSendableVertices())
+    INCSTAT(g_stats.this_frame.num_draw_calls_merged);
 
   ((u32*)&bpmem)[bp.address] = bp.newvalue;
 
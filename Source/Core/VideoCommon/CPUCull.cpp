@@ -3,6 +3,8 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -54,10 +56,14 @@
 #include "VideoCommon/CPUCullImpl.h"
 #define USE_FMA
 #include "VideoCommon/CPUCullImpl.h"
+#define USE_AVX512
+#include "VideoCommon/CPUCullImpl.h"
 #endif
 
 #if defined(USE_SSE)
-#if defined(__AVX__) && defined(__FMA__)
+#if defined(__AVX512F__) && defined(__FMA__)
+static constexpr int MIN_SSE = 60;
+#elif defined(__AVX__) && defined(__FMA__)
 static constexpr int MIN_SSE = 51;
 #elif defined(__AVX__)
 static constexpr int MIN_SSE = 50;
@@ -71,10 +77,12 @@ static constexpr int MIN_SSE = 0;
 #endif
 
 template <bool PositionHas3Elems, bool PerVertexPosMtx>
-static CPUCull::TransformFunction GetTransformFunction()
+static CPUCull::TransformFunction GetTransformFunction([[maybe_unused]] bool allow_avx512)
 {
 #if defined(USE_SSE)
-  if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
+  if (MIN_SSE >= 60 || (allow_avx512 && cpu_info.bAVX512F))
+    return CPUCull_AVX512::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
+  else if (MIN_SSE >= 51 || (cpu_info.bAVX && cpu_info.bFMA))
     return CPUCull_FMA::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
   else if (MIN_SSE >= 50 || cpu_info.bAVX)
     return CPUCull_AVX::TransformVertices<PositionHas3Elems, PerVertexPosMtx>;
@@ -121,14 +129,24 @@ static Common::EnumMap<CPUCull::CullFunction, CullMode::All> GetCullFunction1()
   };
 }
 
+// Chunks are a multiple of the vertices per quad, triangle and (for the winding order) pair of
+// strip triangles, so they always start at the beginning of a primitive.
+static constexpr u32 CHUNK_VERTICES = 1536;
+static constexpr u32 MIN_CHUNKED_VERTICES = CHUNK_VERTICES * 2;
+// Room in front of the transformed vertices for the first vertex of a triangle fan. Keeps the
+// vertices written by the transform functions aligned to 64 bytes.
+static constexpr u32 CHUNK_BUFFER_OFFSET = 4;
+// Strips and fans need two more vertices than the chunk has triangles, rounded up
+static constexpr u32 CHUNK_BUFFER_SIZE = CHUNK_BUFFER_OFFSET + CHUNK_VERTICES + 4;
+
 CPUCull::~CPUCull() = default;
 
-void CPUCull::Init()
+void CPUCull::Init(bool allow_avx512)
 {
-  m_transform_table[false][false] = GetTransformFunction<false, false>();
-  m_transform_table[false][true] = GetTransformFunction<false, true>();
-  m_transform_table[true][false] = GetTransformFunction<true, false>();
-  m_transform_table[true][true] = GetTransformFunction<true, true>();
+  m_transform_table[false][false] = GetTransformFunction<false, false>(allow_avx512);
+  m_transform_table[false][true] = GetTransformFunction<false, true>(allow_avx512);
+  m_transform_table[true][false] = GetTransformFunction<true, false>(allow_avx512);
+  m_transform_table[true][true] = GetTransformFunction<true, true>(allow_avx512);
   using Prim = OpcodeDecoder::Primitive;
   m_cull_table[Prim::GX_DRAW_QUADS] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
   m_cull_table[Prim::GX_DRAW_QUADS_2] = GetCullFunction1<Prim::GX_DRAW_QUADS>();
@@ -137,6 +155,18 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
+void CPUCull::SetNumWorkerThreads(u32 num_threads)
+{
+  m_requested_worker_threads.store(num_threads, std::memory_order_relaxed);
+}
+
+CPUCull::TransformBuffer CPUCull::AllocateTransformBuffer(u32 size)
+{
+  // 64 bytes for the AVX-512 transform functions
+  return TransformBuffer(static_cast<TransformedVertex*>(
+      Common::AllocateAlignedMemory(size * sizeof(TransformedVertex), 64)));
+}
+
 bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                                    const u8* src, u32 count)
 {
@@ -149,8 +179,7 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   {
     u32 new_size = MathUtil::NextPowerOf2(count);
     m_transform_buffer_size = new_size;
-    m_transform_buffer.reset(static_cast<TransformedVertex*>(
-        Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
+    m_transform_buffer = AllocateTransformBuffer(new_size);
   }
 
   // transform functions need the projection matrix to tranform to clip space
@@ -164,11 +193,127 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cull_mode = cullmode_invert[cull_mode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cull_mode];
+
+  // Large draws are transformed and culled a chunk at a time, which keeps the transformed vertices
+  // in the cache and stops transforming at the first visible triangle. With worker threads, the
+  // chunks are also spread across threads.
+  if (count >= MIN_CHUNKED_VERTICES && cull_mode != CullMode::All)
+  {
+    // Strip triangles are counted by their first vertex, so the last two vertices start none.
+    const u32 num_start_vertices =
+        primitive == OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP ? count - 2 : count;
+    return AreAllVerticesCulledInChunks({
+        .transform = transform,
+        .cull = cull,
+        .primitive = primitive,
+        .src = src,
+        .stride = stride,
+        .count = count,
+        .num_chunks = (num_start_vertices + CHUNK_VERTICES - 1) / CHUNK_VERTICES,
+    });
+  }
+
+  transform(m_transform_buffer.get(), src, stride, count);
   return cull(m_transform_buffer.get(), count);
 }
 
+bool CPUCull::AreAllVerticesCulledInChunks(const ChunkedJob& job)
+{
+  const u32 num_worker_threads = m_requested_worker_threads.load(std::memory_order_relaxed);
+  if (m_chunk_buffers.empty() || num_worker_threads != m_num_worker_threads)
+  {
+    m_workers.clear();
+    m_num_worker_threads = num_worker_threads;
+    StartWorkerThreads();
+  }
+
+  m_job = job;
+  m_next_chunk.store(0, std::memory_order_relaxed);
+  m_found_visible.store(false, std::memory_order_relaxed);
+
+  // Don't wake up threads that would have no chunk left to cull.
+  const u32 num_workers = std::min<u32>(static_cast<u32>(m_workers.size()), job.num_chunks - 1);
+  m_busy_workers.store(num_workers, std::memory_order_relaxed);
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers[i]->Push(i + 1);
+
+  CullChunks(0);
+
+  // The workers may still be working on their last chunk, which reads the source vertices.
+  if (num_workers != 0)
+    m_workers_done.Wait();
+
+  return !m_found_visible.load(std::memory_order_relaxed);
+}
+
+void CPUCull::StartWorkerThreads()
+{
+  m_chunk_buffers.clear();
+  for (u32 i = 0; i <= m_num_worker_threads; ++i)
+    m_chunk_buffers.push_back(AllocateTransformBuffer(CHUNK_BUFFER_SIZE));
+
+  for (u32 i = 0; i < m_num_worker_threads; ++i)
+  {
+    m_workers.push_back(std::make_unique<Common::WorkQueueThreadSP<u32>>(
+        "CPU Cull Worker", [this](u32 thread_index) {
+          CullChunks(thread_index);
+          if (m_busy_workers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            m_workers_done.Set();
+        }));
+  }
+}
+
+void CPUCull::CullChunks(u32 thread_index)
+{
+  TransformedVertex* const buffer = m_chunk_buffers[thread_index].get();
+
+  // Stop as soon as any thread found a visible triangle, the rest of the draw doesn't matter.
+  while (!m_found_visible.load(std::memory_order_relaxed))
+  {
+    const u32 chunk = m_next_chunk.fetch_add(1, std::memory_order_relaxed);
+    if (chunk >= m_job.num_chunks)
+      break;
+
+    if (!IsChunkCulled(chunk, buffer))
+      m_found_visible.store(true, std::memory_order_relaxed);
+  }
+}
+
+bool CPUCull::IsChunkCulled(u32 chunk, TransformedVertex* buffer) const
+{
+  const ChunkedJob& job = m_job;
+  TransformedVertex* const output = buffer + CHUNK_BUFFER_OFFSET;
+  const u32 first = chunk * CHUNK_VERTICES;
+
+  switch (job.primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+  {
+    // Include the two vertices that complete the chunk's last triangles.
+    const u32 count = std::min(first + CHUNK_VERTICES + 2, job.count) - first;
+    job.transform(output, job.src + first * job.stride, job.stride, count);
+    return job.cull(output, count);
+  }
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+  {
+    // Each triangle consists of the first vertex of the fan and the two vertices at its end, so
+    // the chunk's vertices are preceded by the first vertex of the fan and the one before them.
+    const u32 begin = std::max(first, 2u) - 1;
+    const u32 count = std::min(first + CHUNK_VERTICES, job.count) - begin;
+    job.transform(output - 1, job.src, job.stride, 1);
+    job.transform(output, job.src + begin * job.stride, job.stride, count);
+    return job.cull(output - 1, count + 1);
+  }
+  default:
+  {
+    const u32 count = std::min(first + CHUNK_VERTICES, job.count) - first;
+    job.transform(output, job.src + first * job.stride, job.stride, count);
+    return job.cull(output, count);
+  }
+  }
+}
+
 template <typename T>
 void CPUCull::BufferDeleter<T>::operator()(T* ptr)
 {
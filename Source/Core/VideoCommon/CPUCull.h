@@ -3,6 +3,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Common/Event.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -11,10 +17,16 @@ class CPUCull
 {
 public:
   ~CPUCull();
-  void Init();
+  // The AVX-512 transform functions can be disallowed to compare them with the other ones.
+  void Init(bool allow_avx512 = true);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
 
+  // Chunks of large draws are culled by these threads and the calling thread together. 0 culls
+  // everything on the calling thread. May be called from any thread, the threads are started or
+  // replaced by the next large draw.
+  void SetNumWorkerThreads(u32 num_threads);
+
   struct alignas(16) TransformedVertex
   {
     float x, y, z, w;
@@ -29,10 +41,43 @@ private:
   {
     void operator()(T* ptr);
   };
-  std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
+  using TransformBuffer = std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>>;
+
+  // The large draw that is currently being culled in chunks
+  struct ChunkedJob
+  {
+    TransformFunction transform = nullptr;
+    CullFunction cull = nullptr;
+    OpcodeDecoder::Primitive primitive{};
+    const u8* src = nullptr;
+    u32 stride = 0;
+    u32 count = 0;
+    u32 num_chunks = 0;
+  };
+
+  static TransformBuffer AllocateTransformBuffer(u32 size);
+
+  bool AreAllVerticesCulledInChunks(const ChunkedJob& job);
+  void StartWorkerThreads();
+  void CullChunks(u32 thread_index);
+  bool IsChunkCulled(u32 chunk, TransformedVertex* buffer) const;
+
+  TransformBuffer m_transform_buffer{};
   u32 m_transform_buffer_size = 0;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
       m_cull_table{};
+
+  std::atomic<u32> m_requested_worker_threads = 0;
+  u32 m_num_worker_threads = 0;
+  ChunkedJob m_job;
+  std::atomic<u32> m_next_chunk = 0;
+  std::atomic<bool> m_found_visible = false;
+  std::atomic<u32> m_busy_workers = 0;
+  Common::Event m_workers_done;
+  // One per thread, including the calling thread at index 0
+  std::vector<TransformBuffer> m_chunk_buffers;
+  // Declared last so the threads are stopped before anything they use is destroyed
+  std::vector<std::unique_ptr<Common::WorkQueueThreadSP<u32>>> m_workers;
 };
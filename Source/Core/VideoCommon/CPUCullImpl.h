@@ -1,7 +1,9 @@
 // Copyright 2022 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#if defined(USE_FMA)
+#if defined(USE_AVX512)
+#define VECTOR_NAMESPACE CPUCull_AVX512
+#elif defined(USE_FMA)
 #define VECTOR_NAMESPACE CPUCull_FMA
 #elif defined(USE_AVX)
 #define VECTOR_NAMESPACE CPUCull_AVX
@@ -19,7 +21,9 @@
 #error This file is meant to be used by CPUCull.cpp only!
 #endif
 
-#if defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
+#if defined(__GNUC__) && defined(USE_AVX512) && !defined(__AVX512F__)
+#define ATTR_TARGET __attribute__((target("avx512f,avx2,avx,fma")))
+#elif defined(__GNUC__) && defined(USE_FMA) && !(defined(__AVX__) && defined(__FMA__))
 #define ATTR_TARGET __attribute__((target("avx,fma")))
 #elif defined(__GNUC__) && defined(USE_AVX) && !defined(__AVX__)
 #define ATTR_TARGET __attribute__((target("avx")))
@@ -236,6 +240,124 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
 
 #endif
 
+#ifdef USE_AVX512
+template <int i>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 vector_broadcast(__m512 v)
+{
+  return _mm512_permute_ps(v, _MM_SHUFFLE(i, i, i, i));
+}
+
+// Same as _mm256_hadd_ps, for each of the four 128-bit lanes
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 HaddZMM(__m512 a, __m512 b)
+{
+  return _mm512_add_ps(_mm512_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                       _mm512_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 BroadcastLane(__m256 v)
+{
+  return _mm512_broadcast_f32x4(_mm256_castps256_ps128(v));
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 CombineLanes(Vector v0, Vector v1, Vector v2,
+                                                            Vector v3)
+{
+  __m512 output = _mm512_castps128_ps512(v0);
+  output = _mm512_insertf32x4(output, v1, 1);
+  output = _mm512_insertf32x4(output, v2, 2);
+  output = _mm512_insertf32x4(output, v3, 3);
+  return output;
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512 ApplyMatrixZMM(__m512 v, __m512 m0, __m512 m1,
+                                                              __m512 m2, __m512 m3)
+{
+  __m512 output = _mm512_mul_ps(vector_broadcast<0>(v), m0);
+  output = _mm512_fmadd_ps(vector_broadcast<1>(v), m1, output);
+  output = _mm512_fmadd_ps(vector_broadcast<2>(v), m2, output);
+  output = _mm512_fmadd_ps(vector_broadcast<3>(v), m3, output);
+  return output;
+}
+
+template <bool PositionHas3Elems, bool PerVertexPosMtx>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static Vector LoadVertexXMM(const u8* data)
+{
+  const float* fdata = reinterpret_cast<const float*>(data);
+  if constexpr (PerVertexPosMtx)
+  {
+    // The position matrix multiply below sums over all four components, so w has to be 1
+    if constexpr (PositionHas3Elems)
+    {
+      return _mm_blend_ps(_mm_loadu_ps(fdata), _mm_set1_ps(1.0f), 8);
+    }
+    else
+    {
+      const Vector base = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+      return _mm_loadl_pi(base, reinterpret_cast<const __m64*>(fdata));
+    }
+  }
+  else
+  {
+    if constexpr (PositionHas3Elems)
+      return _mm_loadu_ps(fdata);
+    else
+      return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(fdata));
+  }
+}
+
+template <bool PositionHas3Elems, bool PerVertexPosMtx>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m512
+LoadTransform4Vertices(const u8* data, u32 stride,                          //
+                       __m512 pos0, __m512 pos1, __m512 pos2, __m512 pos3,  //
+                       __m512 proj0, __m512 proj1, __m512 proj2, __m512 proj3)
+{
+  const u8* v0data = data;
+  const u8* v1data = data + stride;
+  const u8* v2data = data + stride * 2;
+  const u8* v3data = data + stride * 3;
+
+  if constexpr (PerVertexPosMtx)
+  {
+    const float* m0 = &xfmem.posMatrices[(v0data[0] & 0x3f) * 4];
+    const float* m1 = &xfmem.posMatrices[(v1data[0] & 0x3f) * 4];
+    const float* m2 = &xfmem.posMatrices[(v2data[0] & 0x3f) * 4];
+    const float* m3 = &xfmem.posMatrices[(v3data[0] & 0x3f) * 4];
+    constexpr size_t pos_offset = sizeof(u32);
+
+    const __m512 v = CombineLanes(
+        LoadVertexXMM<PositionHas3Elems, true>(v0data + pos_offset),
+        LoadVertexXMM<PositionHas3Elems, true>(v1data + pos_offset),
+        LoadVertexXMM<PositionHas3Elems, true>(v2data + pos_offset),
+        LoadVertexXMM<PositionHas3Elems, true>(v3data + pos_offset));
+
+    // Each lane gets the rows of its own vertex's position matrix
+    const __m512 mul0 = _mm512_mul_ps(v, CombineLanes(_mm_loadu_ps(m0 + 0), _mm_loadu_ps(m1 + 0),
+                                                      _mm_loadu_ps(m2 + 0), _mm_loadu_ps(m3 + 0)));
+    const __m512 mul1 = _mm512_mul_ps(v, CombineLanes(_mm_loadu_ps(m0 + 4), _mm_loadu_ps(m1 + 4),
+                                                      _mm_loadu_ps(m2 + 4), _mm_loadu_ps(m3 + 4)));
+    const __m512 mul2 = _mm512_mul_ps(v, CombineLanes(_mm_loadu_ps(m0 + 8), _mm_loadu_ps(m1 + 8),
+                                                      _mm_loadu_ps(m2 + 8), _mm_loadu_ps(m3 + 8)));
+    const __m512 mul3 = _mm512_broadcast_f32x4(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+    const __m512 output = HaddZMM(HaddZMM(mul0, mul1), HaddZMM(mul2, mul3));
+    return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+  }
+  else
+  {
+    const __m512 v = CombineLanes(LoadVertexXMM<PositionHas3Elems, false>(v0data),
+                                  LoadVertexXMM<PositionHas3Elems, false>(v1data),
+                                  LoadVertexXMM<PositionHas3Elems, false>(v2data),
+                                  LoadVertexXMM<PositionHas3Elems, false>(v3data));
+
+    __m512 output = pos3;  // vertex.w is always 1.0
+    output = _mm512_fmadd_ps(vector_broadcast<0>(v), pos0, output);
+    output = _mm512_fmadd_ps(vector_broadcast<1>(v), pos1, output);
+    if constexpr (PositionHas3Elems)
+      output = _mm512_fmadd_ps(vector_broadcast<2>(v), pos2, output);
+    return ApplyMatrixZMM(output, proj0, proj1, proj2, proj3);
+  }
+}
+#endif
+
 #ifndef USE_AVX
 // Note: Assumes 16-byte aligned source
 ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposed(const void* source, Vector& o0,
@@ -512,7 +634,41 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   const u8* cvertices = static_cast<const u8*>(vertices);
   Vector* voutput = static_cast<Vector*>(output);
   u32 idx = g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 0x3f;
-#ifdef USE_AVX
+#if defined(USE_AVX512)
+  __m256 proj0, proj1, proj2, proj3;
+  __m256 pos0, pos1, pos2, pos3;
+  LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
+  LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
+  const __m512 zproj0 = BroadcastLane(proj0), zproj1 = BroadcastLane(proj1);
+  const __m512 zproj2 = BroadcastLane(proj2), zproj3 = BroadcastLane(proj3);
+  const __m512 zpos0 = BroadcastLane(pos0), zpos1 = BroadcastLane(pos1);
+  const __m512 zpos2 = BroadcastLane(pos2), zpos3 = BroadcastLane(pos3);
+  for (int i = 3; i < count; i += 4)
+  {
+    __m512 v0123 = LoadTransform4Vertices<PositionHas3Elems, PerVertexPosMtx>(
+        cvertices, stride, zpos0, zpos1, zpos2, zpos3, zproj0, zproj1, zproj2, zproj3);
+    _mm512_store_ps(reinterpret_cast<float*>(voutput), v0123);
+    cvertices += stride * 4;
+    voutput += 4;
+  }
+  if (count & 2)
+  {
+    __m256 v01 = LoadTransform2Vertices<PositionHas3Elems, PerVertexPosMtx>(
+        cvertices, cvertices + stride, pos0, pos1, pos2, pos3, proj0, proj1, proj2, proj3);
+    _mm256_store_ps(reinterpret_cast<float*>(voutput), v01);
+    cvertices += stride * 2;
+    voutput += 2;
+  }
+  if (count & 1)
+  {
+    *voutput = LoadTransformVertex<PositionHas3Elems, PerVertexPosMtx>(
+        cvertices,                                                     //
+        _mm256_castps256_ps128(pos0), _mm256_castps256_ps128(pos1),    //
+        _mm256_castps256_ps128(pos2), _mm256_castps256_ps128(pos3),    //
+        _mm256_castps256_ps128(proj0), _mm256_castps256_ps128(proj1),  //
+        _mm256_castps256_ps128(proj2), _mm256_castps256_ps128(proj3));
+  }
+#elif defined(USE_AVX)
   __m256 proj0, proj1, proj2, proj3;
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
@@ -0,0 +1,77 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/CommandStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/Align.h"
+
+namespace VideoCommon
+{
+// The vertex loaders can write a few bytes past the end of their output.
+constexpr size_t DATA_PADDING = 16;
+
+void CommandStream::Clear()
+{
+  m_commands.clear();
+  m_draws.clear();
+  m_data_size = 0;
+  m_sync_requested = false;
+}
+
+u32 CommandStream::AllocateData(size_t size)
+{
+  const size_t offset = m_data_size;
+  const size_t new_size = Common::AlignUp(offset + size + DATA_PADDING, 16);
+  if (new_size > m_data_capacity)
+  {
+    const size_t new_capacity = std::max(new_size, m_data_capacity * 2);
+    auto new_data = std::make_unique_for_overwrite<u8[]>(new_capacity);
+    if (m_data_size != 0)
+      std::memcpy(new_data.get(), m_data.get(), m_data_size);
+    m_data = std::move(new_data);
+    m_data_capacity = new_capacity;
+  }
+
+  m_data_size = new_size;
+  return static_cast<u32>(offset);
+}
+
+void CommandStream::LoadCP(u8 command, u32 value)
+{
+  m_commands.push_back({.type = Type::LoadCP, .reg = command, .value = value});
+}
+
+void CommandStream::LoadBP(u8 command, u32 value, u32 cycles)
+{
+  m_commands.push_back({.type = Type::LoadBP, .reg = command, .value = value, .cycles = cycles});
+}
+
+void CommandStream::LoadXF(u16 address, u8 size, const u8* data)
+{
+  AddXFCommand(Type::LoadXF, address, size, data);
+}
+
+void CommandStream::LoadIndexedXF(u16 address, u8 size, const u8* data)
+{
+  AddXFCommand(Type::LoadIndexedXF, address, size, data);
+}
+
+void CommandStream::AddXFCommand(Type type, u16 address, u8 size, const u8* data)
+{
+  const u32 offset = AllocateData(size * sizeof(u32));
+  std::memcpy(&m_data[offset], data, size * sizeof(u32));
+  m_commands.push_back({.type = type, .size = size, .address = address, .index = offset});
+}
+
+LoadedDraw& CommandStream::AddDraw(size_t size)
+{
+  const u32 offset = AllocateData(size);
+  m_commands.push_back({.type = Type::Draw, .index = static_cast<u32>(m_draws.size())});
+  LoadedDraw& draw = m_draws.emplace_back();
+  draw.data_offset = offset;
+  return draw;
+}
+}  // namespace VideoCommon
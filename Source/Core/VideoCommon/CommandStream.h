@@ -0,0 +1,107 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+class VertexLoaderBase;
+
+namespace OpcodeDecoder
+{
+enum class Primitive : u8;
+}
+
+namespace VideoCommon
+{
+// Vertices that were loaded to the native format, up to one vertex manager batch.
+struct LoadedDraw
+{
+  VertexLoaderBase* loader = nullptr;
+  TVtxDesc vtx_desc;
+  VAT vtx_attr;
+  VertexLoaderManager::ZFreezeVertices zfreeze_vertices;
+  u32 data_offset = 0;
+  int count = 0;
+  int num_loaded = 0;
+  u8 vtx_attr_group = 0;
+  OpcodeDecoder::Primitive primitive{};
+};
+
+// The part of the FIFO that the pipelined GPU thread's decode thread leaves to the GPU thread, in
+// FIFO order. The decode thread applies CP registers other than the matrix indices itself, reads
+// indexed XF loads and display lists from memory, and runs the vertex loaders, so the GPU thread
+// only has to apply BP/XF state and submit draws to the backend.
+class CommandStream
+{
+public:
+  enum class Type : u8
+  {
+    LoadCP,
+    LoadBP,
+    LoadXF,
+    LoadIndexedXF,
+    Draw,
+  };
+
+  struct Command
+  {
+    Type type;
+    u8 reg = 0;       // LoadCP, LoadBP
+    u8 size = 0;      // LoadXF, LoadIndexedXF, in words
+    u16 address = 0;  // LoadXF, LoadIndexedXF
+    u32 value = 0;    // LoadCP, LoadBP
+    u32 cycles = 0;   // LoadBP, for PE token timing
+    u32 index = 0;    // LoadXF, LoadIndexedXF: offset of the data, Draw: index of the draw
+  };
+
+  void Clear();
+
+  bool IsEmpty() const { return m_commands.empty(); }
+  size_t GetNumCommands() const { return m_commands.size(); }
+  size_t GetDataSize() const { return m_data_size; }
+
+  // Set when decoding must not continue before the GPU thread applied the stream, e.g. for PE
+  // tokens, which the CPU may wait for before it changes the FIFO.
+  void RequestSync() { m_sync_requested = true; }
+  bool IsSyncRequested() const { return m_sync_requested; }
+
+  void LoadCP(u8 command, u32 value);
+  void LoadBP(u8 command, u32 value, u32 cycles);
+  // data is in the big endian layout of the FIFO and of indexed loads.
+  void LoadXF(u16 address, u8 size, const u8* data);
+  void LoadIndexedXF(u16 address, u8 size, const u8* data);
+
+  // Adds a draw with room for size bytes of vertex data. The returned reference and the vertex
+  // data pointer are valid until the next command is added.
+  LoadedDraw& AddDraw(size_t size);
+  u8* GetVertexData(const LoadedDraw& draw) { return &m_data[draw.data_offset]; }
+  const u8* GetVertexData(const LoadedDraw& draw) const { return &m_data[draw.data_offset]; }
+
+  std::span<const Command> GetCommands() const { return m_commands; }
+  const LoadedDraw& GetDraw(const Command& command) const { return m_draws[command.index]; }
+  const u8* GetData(const Command& command) const { return &m_data[command.index]; }
+
+private:
+  u32 AllocateData(size_t size);
+  void AddXFCommand(Type type, u16 address, u8 size, const u8* data);
+
+  std::vector<Command> m_commands;
+  std::vector<LoadedDraw> m_draws;
+
+  // Not a vector, as zero-initializing the vertex data on every resize would cost about as much
+  // as copying it.
+  std::unique_ptr<u8[]> m_data;
+  size_t m_data_size = 0;
+  size_t m_data_capacity = 0;
+
+  bool m_sync_requested = false;
+};
+}  // namespace VideoCommon
@@ -4,7 +4,10 @@
 #include "VideoCommon/Fifo.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstring>
+#include <memory>
+#include <thread>
 
 #include "Common/Assert.h"
 #include "Common/BlockingLoop.h"
@@ -12,7 +15,9 @@
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -25,17 +30,25 @@
 #include "VideoCommon/AsyncRequests.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/CommandStream.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace Fifo
 {
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// Pipelined GPU thread: the decode thread hands over a command stream once it gets this big.
+static constexpr size_t MAX_STREAM_COMMANDS = 2048;
+static constexpr size_t MAX_STREAM_DATA_SIZE = 512 * 1024;
+// Also the number of streams the decode thread can be ahead by, plus the one being decoded.
+static constexpr u32 NUM_COMMAND_STREAMS = 4;
+
 FifoManager::FifoManager(Core::System& system) : m_system{system}
 {
 }
@@ -48,6 +61,7 @@ void FifoManager::RefreshConfig()
   m_config_sync_gpu_max_distance = Config::Get(Config::MAIN_SYNC_GPU_MAX_DISTANCE);
   m_config_sync_gpu_min_distance = Config::Get(Config::MAIN_SYNC_GPU_MIN_DISTANCE);
   m_config_sync_gpu_overclock = Config::Get(Config::MAIN_SYNC_GPU_OVERCLOCK);
+  m_config_pipelined_gpu_thread = Config::Get(Config::MAIN_PIPELINED_GPU_THREAD);
 }
 
 void FifoManager::DoState(PointerWrap& p)
@@ -285,6 +299,9 @@ void FifoManager::ResetVideoBuffer()
 // Purpose: Keep the Core HW updated about the CPU-GPU distance
 void FifoManager::RunGpuLoop()
 {
+  if (m_config_pipelined_gpu_thread)
+    StartDecodeThread();
+
   m_gpu_mainloop.Run(
       [this] {
         // Run events from the CPU thread.
@@ -307,77 +324,13 @@ void FifoManager::RunGpuLoop()
             m_video_buffer_seen_ptr = write_ptr;
           }
         }
+        else if (m_decode_thread.joinable() && !OpcodeDecoder::g_record_fifo_data)
+        {
+          RunPipelinedFifo();
+        }
         else
         {
-          auto& command_processor = m_system.GetCommandProcessor();
-          auto& fifo = command_processor.GetFifo();
-          command_processor.SetCPStatusFromGPU();
-
-          // check if we are able to run this buffer
-          while (!command_processor.IsInterruptWaiting() &&
-                 fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
-                 fifo.CPReadWriteDistance.load(std::memory_order_relaxed) &&
-                 !AtBreakpoint(m_system))
-          {
-            if (m_config_sync_gpu && m_sync_ticks.load() < m_config_sync_gpu_min_distance)
-              break;
-
-            u32 cyclesExecuted = 0;
-            u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(readPtr);
-
-            if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
-              readPtr = fifo.CPBase.load(std::memory_order_relaxed);
-            else
-              readPtr += GPFifo::GATHER_PIPE_SIZE;
-
-            const s32 distance =
-                static_cast<s32>(fifo.CPReadWriteDistance.load(std::memory_order_relaxed)) -
-                GPFifo::GATHER_PIPE_SIZE;
-            ASSERT_MSG(COMMANDPROCESSOR, distance >= 0,
-                       "Negative fifo.CPReadWriteDistance = {} in FIFO Loop !\nThat can produce "
-                       "instability in the game. Please report it.",
-                       distance);
-
-            u8* write_ptr = m_video_buffer_write_ptr;
-            m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
-                DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
-
-            fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
-            fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
-            if ((write_ptr - m_video_buffer_read_ptr) == 0)
-            {
-              fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
-                                           std::memory_order_relaxed);
-            }
-
-            command_processor.SetCPStatusFromGPU();
-
-            if (m_config_sync_gpu)
-            {
-              cyclesExecuted = (int)(cyclesExecuted / m_config_sync_gpu_overclock);
-              int old = m_sync_ticks.fetch_sub(cyclesExecuted);
-              if (old >= m_config_sync_gpu_max_distance &&
-                  old - (int)cyclesExecuted < m_config_sync_gpu_max_distance)
-              {
-                m_sync_wakeup_event.Set();
-              }
-            }
-
-            // This call is pretty important in DualCore mode and must be called in the FIFO Loop.
-            // If we don't, s_swapRequested or s_efbAccessRequested won't be set to false
-            // leading the CPU thread to wait in Video_OutputXFB or Video_AccessEFB thus slowing
-            // things down.
-            AsyncRequests::GetInstance()->PullEvents();
-          }
-
-          // fast skip remaining GPU time if fifo is empty
-          if (m_sync_ticks.load() > 0)
-          {
-            int old = m_sync_ticks.exchange(0);
-            if (old >= m_config_sync_gpu_max_distance)
-              m_sync_wakeup_event.Set();
-          }
+          ProcessFifo<false>();
 
           // The fifo is empty and it's unlikely we will get any more work in the near future.
           // Make sure VertexManager finishes drawing any primitives it has stored in it's buffer.
@@ -386,6 +339,260 @@ void FifoManager::RunGpuLoop()
         }
       },
       100);
+
+  if (m_decode_thread.joinable())
+    StopDecodeThread();
+}
+
+// Runs everything the CPU has written to the FIFO so far. With the pipelined GPU thread, this is
+// called on the decode thread and only decodes the FIFO to m_decode_stream.
+template <bool pipelined>
+void FifoManager::ProcessFifo()
+{
+  auto& command_processor = m_system.GetCommandProcessor();
+  auto& fifo = command_processor.GetFifo();
+  command_processor.SetCPStatusFromGPU();
+
+  // check if we are able to run this buffer
+  while (!command_processor.IsInterruptWaiting() &&
+         fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
+         fifo.CPReadWriteDistance.load(std::memory_order_relaxed) && !AtBreakpoint(m_system))
+  {
+    if (m_config_sync_gpu && m_sync_ticks.load() < m_config_sync_gpu_min_distance)
+      break;
+
+    u32 cyclesExecuted = 0;
+    u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
+    ReadDataFromFifo(readPtr);
+
+    if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
+      readPtr = fifo.CPBase.load(std::memory_order_relaxed);
+    else
+      readPtr += GPFifo::GATHER_PIPE_SIZE;
+
+    const s32 distance =
+        static_cast<s32>(fifo.CPReadWriteDistance.load(std::memory_order_relaxed)) -
+        GPFifo::GATHER_PIPE_SIZE;
+    ASSERT_MSG(COMMANDPROCESSOR, distance >= 0,
+               "Negative fifo.CPReadWriteDistance = {} in FIFO Loop !\nThat can produce "
+               "instability in the game. Please report it.",
+               distance);
+
+    u8* write_ptr = m_video_buffer_write_ptr;
+    if constexpr (pipelined)
+    {
+      m_video_buffer_read_ptr =
+          OpcodeDecoder::DecodeFifo(DataReader(m_video_buffer_read_ptr, write_ptr),
+                                    &cyclesExecuted, *m_decode_stream, m_decode_geometry_cache);
+
+      // Interrupts have to be raised before the loop condition checks for them.
+      if (m_decode_stream->IsSyncRequested())
+      {
+        SubmitDecodedCommands();
+        WaitForDecodedCommands();
+      }
+    }
+    else
+    {
+      m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
+          DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
+    }
+
+    fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
+    fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
+    if ((write_ptr - m_video_buffer_read_ptr) == 0)
+    {
+      fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+    }
+
+    command_processor.SetCPStatusFromGPU();
+
+    if (m_config_sync_gpu)
+    {
+      cyclesExecuted = (int)(cyclesExecuted / m_config_sync_gpu_overclock);
+      int old = m_sync_ticks.fetch_sub(cyclesExecuted);
+      if (old >= m_config_sync_gpu_max_distance &&
+          old - (int)cyclesExecuted < m_config_sync_gpu_max_distance)
+      {
+        m_sync_wakeup_event.Set();
+      }
+    }
+
+    if constexpr (pipelined)
+    {
+      // Hand over work in small enough pieces for both threads to run in parallel. The GPU thread
+      // runs events from the CPU thread between them.
+      if (m_decode_stream->GetNumCommands() >= MAX_STREAM_COMMANDS ||
+          m_decode_stream->GetDataSize() >= MAX_STREAM_DATA_SIZE ||
+          AsyncRequests::GetInstance()->HasPendingEvents())
+      {
+        SubmitDecodedCommands();
+      }
+    }
+    else
+    {
+      // This call is pretty important in DualCore mode and must be called in the FIFO Loop.
+      // If we don't, s_swapRequested or s_efbAccessRequested won't be set to false
+      // leading the CPU thread to wait in Video_OutputXFB or Video_AccessEFB thus slowing
+      // things down.
+      AsyncRequests::GetInstance()->PullEvents();
+    }
+  }
+
+  // fast skip remaining GPU time if fifo is empty
+  if (m_sync_ticks.load() > 0)
+  {
+    int old = m_sync_ticks.exchange(0);
+    if (old >= m_config_sync_gpu_max_distance)
+      m_sync_wakeup_event.Set();
+  }
+}
+
+static u64 NowNs()
+{
+  return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count());
+}
+
+// The pipelined GPU thread splits the work of the GPU thread in two: a decode thread reads the
+// FIFO, applies CP state and runs the vertex loaders, while this thread applies BP/XF state and
+// submits draws to the backend. Everything that has to observe the whole pipeline (events from
+// the CPU thread, savestates, pausing) happens between decode passes, when the decode thread is
+// idle and everything it decoded has been submitted.
+void FifoManager::StartDecodeThread()
+{
+  m_decode_stream = std::make_unique<VideoCommon::CommandStream>();
+  for (u32 i = 1; i < NUM_COMMAND_STREAMS; ++i)
+    m_free_streams.Push(std::make_unique<VideoCommon::CommandStream>());
+
+  m_decode_busy_ns.store(0);
+  m_submit_busy_ns.store(0);
+  m_pipeline_wall_ns.store(0);
+
+  m_decode_thread_exit.Clear();
+  m_decode_thread = std::thread(&FifoManager::DecodeThread, this);
+}
+
+void FifoManager::StopDecodeThread()
+{
+  m_decode_thread_exit.Set();
+  m_decode_pass_event.Set();
+  m_decode_thread.join();
+
+  m_decoded_streams.Clear();
+  m_free_streams.Clear();
+  m_decode_stream.reset();
+
+  const PipelineTimes times = GetPipelineTimes();
+  if (times.wall_ns != 0)
+  {
+    INFO_LOG_FMT(VIDEO, "Pipelined GPU thread utilization: decode {:.1f}%, submission {:.1f}%",
+                 100.0 * times.decode_busy_ns / times.wall_ns,
+                 100.0 * times.submit_busy_ns / times.wall_ns);
+  }
+}
+
+void FifoManager::DecodeThread()
+{
+  Common::SetCurrentThreadName("Video Decode Thread");
+
+  while (true)
+  {
+    m_decode_pass_event.Wait();
+    if (m_decode_thread_exit.IsSet())
+      break;
+
+    const u64 start = NowNs();
+    m_decode_wait_ns = 0;
+
+    ProcessFifo<true>();
+    SubmitDecodedCommands();
+
+    m_decode_busy_ns.fetch_add(NowNs() - start - m_decode_wait_ns, std::memory_order_relaxed);
+
+    // Marks the end of the pass.
+    m_decoded_streams.Push(nullptr);
+  }
+}
+
+void FifoManager::SubmitDecodedCommands()
+{
+  if (m_decode_stream->IsEmpty())
+    return;
+
+  m_streams_in_flight.fetch_add(1);
+  m_decoded_streams.Push(std::move(m_decode_stream));
+
+  if (m_free_streams.Empty())
+  {
+    const u64 wait_start = NowNs();
+    m_free_streams.WaitForData();
+    m_decode_wait_ns += NowNs() - wait_start;
+  }
+  m_decode_stream = std::move(m_free_streams.Front());
+  m_free_streams.Pop();
+}
+
+void FifoManager::WaitForDecodedCommands()
+{
+  const u64 wait_start = NowNs();
+  while (const u32 in_flight = m_streams_in_flight.load())
+    m_streams_in_flight.wait(in_flight);
+  m_decode_wait_ns += NowNs() - wait_start;
+}
+
+void FifoManager::RunPipelinedFifo()
+{
+  const u64 start = NowNs();
+  u64 wait_ns = 0;
+
+  // Config changes are applied by events from the CPU thread on this thread, so the decode thread
+  // can't read the config while it is running.
+  m_decode_geometry_cache = g_ActiveConfig.bGeometryCache;
+  m_decode_pass_event.Set();
+
+  while (true)
+  {
+    if (m_decoded_streams.Empty())
+    {
+      const u64 wait_start = NowNs();
+      m_decoded_streams.WaitForData();
+      wait_ns += NowNs() - wait_start;
+    }
+
+    std::unique_ptr<VideoCommon::CommandStream> stream = std::move(m_decoded_streams.Front());
+    m_decoded_streams.Pop();
+    if (!stream)
+      break;
+
+    OpcodeDecoder::ReplayCommands(*stream);
+    stream->Clear();
+    m_free_streams.Push(std::move(stream));
+    m_streams_in_flight.fetch_sub(1);
+    m_streams_in_flight.notify_one();
+
+    AsyncRequests::GetInstance()->PullEvents();
+  }
+
+  // The fifo is empty and it's unlikely we will get any more work in the near future.
+  // Make sure VertexManager finishes drawing any primitives it has stored in it's buffer.
+  g_vertex_manager->Flush();
+  g_framebuffer_manager->RefreshPeekCache();
+
+  const u64 wall_ns = NowNs() - start;
+  m_submit_busy_ns.fetch_add(wall_ns - wait_ns, std::memory_order_relaxed);
+  m_pipeline_wall_ns.fetch_add(wall_ns, std::memory_order_relaxed);
+}
+
+FifoManager::PipelineTimes FifoManager::GetPipelineTimes() const
+{
+  return {
+      .decode_busy_ns = m_decode_busy_ns.load(std::memory_order_relaxed),
+      .submit_busy_ns = m_submit_busy_ns.load(std::memory_order_relaxed),
+      .wall_ns = m_pipeline_wall_ns.load(std::memory_order_relaxed),
+  };
 }
 
 void FifoManager::FlushGpu()
@@ -5,13 +5,16 @@
 
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <optional>
+#include <thread>
 
 #include "Common/BlockingLoop.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 class PointerWrap;
 
@@ -23,6 +26,10 @@ namespace CoreTiming
 {
 struct EventType;
 }
+namespace VideoCommon
+{
+class CommandStream;
+}
 
 namespace Fifo
 {
@@ -76,6 +83,15 @@ public:
   void EmulatorState(bool running);
   void ResetVideoBuffer();
 
+  // Time the stages of the pipelined GPU thread spent working, since the GPU loop started.
+  struct PipelineTimes
+  {
+    u64 decode_busy_ns = 0;
+    u64 submit_busy_ns = 0;
+    u64 wall_ns = 0;
+  };
+  PipelineTimes GetPipelineTimes() const;
+
 private:
   void RefreshConfig();
   void ReadDataFromFifo(u32 read_ptr);
@@ -84,6 +100,16 @@ private:
   int WaitForGpuThread(int ticks);
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
+  template <bool pipelined>
+  void ProcessFifo();
+
+  void StartDecodeThread();
+  void StopDecodeThread();
+  void DecodeThread();
+  void SubmitDecodedCommands();
+  void WaitForDecodedCommands();
+  void RunPipelinedFifo();
+
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 
   Common::BlockingLoop m_gpu_mainloop;
@@ -128,6 +154,22 @@ private:
   int m_config_sync_gpu_max_distance = 0;
   int m_config_sync_gpu_min_distance = 0;
   float m_config_sync_gpu_overclock = 0.0f;
+  bool m_config_pipelined_gpu_thread = false;
+
+  // Pipelined GPU thread. The decode thread runs one pass over the FIFO whenever the GPU thread
+  // sets m_decode_pass_event, and ends it by pushing nullptr to m_decoded_streams.
+  std::thread m_decode_thread;
+  Common::Event m_decode_pass_event;
+  Common::Flag m_decode_thread_exit;
+  std::unique_ptr<VideoCommon::CommandStream> m_decode_stream;  // Decode thread only
+  Common::WaitableSPSCQueue<std::unique_ptr<VideoCommon::CommandStream>> m_decoded_streams;
+  Common::WaitableSPSCQueue<std::unique_ptr<VideoCommon::CommandStream>> m_free_streams;
+  std::atomic<u32> m_streams_in_flight = 0;
+  bool m_decode_geometry_cache = false;
+  u64 m_decode_wait_ns = 0;  // Decode thread only
+  std::atomic<u64> m_decode_busy_ns = 0;
+  std::atomic<u64> m_submit_busy_ns = 0;
+  std::atomic<u64> m_pipeline_wall_ns = 0;
 
   Core::System& m_system;
 };
@@ -162,6 +162,39 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// Newer versions of swscale can convert slices of a frame on multiple threads.
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+#define FRAMEDUMP_THREADED_SWS 1
+#endif
+
+SwsContext* CreateScaler(int width, int height, AVPixelFormat dst_format)
+{
+#ifdef FRAMEDUMP_THREADED_SWS
+  SwsContext* const sws = sws_alloc_context();
+  if (!sws)
+    return nullptr;
+
+  av_opt_set_int(sws, "srcw", width, 0);
+  av_opt_set_int(sws, "srch", height, 0);
+  av_opt_set_int(sws, "src_format", AV_PIX_FMT_RGBA, 0);
+  av_opt_set_int(sws, "dstw", width, 0);
+  av_opt_set_int(sws, "dsth", height, 0);
+  av_opt_set_int(sws, "dst_format", dst_format, 0);
+  av_opt_set_int(sws, "sws_flags", SWS_BICUBIC, 0);
+  // 0 lets swscale use a thread per CPU core.
+  av_opt_set_int(sws, "threads", 0, 0);
+  if (sws_init_context(sws, nullptr, nullptr) < 0)
+  {
+    sws_freeContext(sws);
+    return nullptr;
+  }
+  return sws;
+#else
+  return sws_getContext(width, height, AV_PIX_FMT_RGBA, width, height, dst_format, SWS_BICUBIC,
+                        nullptr, nullptr, nullptr);
+#endif
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -274,6 +307,9 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->codec->time_base = time_base;
   m_context->codec->gop_size = 1;
   m_context->codec->level = 1;
+  // Let the encoder pick its thread count, so that encoding doesn't hold up the dump thread.
+  m_context->codec->thread_count = 0;
+  m_context->codec->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
 
   AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
 
@@ -395,13 +431,43 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   m_context->src_frame->height = m_context->height;
 
   // Convert image from RGBA to desired pixel format.
-  m_context->sws = sws_getCachedContext(
-      m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
-  if (m_context->sws)
+  if (!m_context->sws)
+    m_context->sws = CreateScaler(m_context->width, m_context->height, m_context->codec->pix_fmt);
+  if (m_context->sws && frame.width == m_context->width && frame.height == m_context->height)
   {
+    // A frame threaded encoder may still reference the previous frame, so convert into a new
+    // buffer instead of overwriting it.
+    AVFrame* const scaled_frame = m_context->scaled_frame;
+    if (!av_frame_is_writable(scaled_frame))
+    {
+      av_frame_unref(scaled_frame);
+      scaled_frame->format = m_context->codec->pix_fmt;
+      scaled_frame->width = m_context->width;
+      scaled_frame->height = m_context->height;
+      if (const int error = av_frame_get_buffer(scaled_frame, 1))
+      {
+        ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate frame: {}", AVErrorString(error));
+        return;
+      }
+    }
+
+#ifdef FRAMEDUMP_THREADED_SWS
+    // Wrap the mapped frame in a buffer that doesn't own it, as sws_scale_frame would copy a frame
+    // that isn't reference counted.
+    m_context->src_frame->buf[0] = av_buffer_create(
+        m_context->src_frame->data[0], static_cast<size_t>(frame.stride) * frame.height,
+        [](void*, u8*) {}, nullptr, AV_BUFFER_FLAG_READONLY);
+    const int error = m_context->src_frame->buf[0] ?
+                          sws_scale_frame(m_context->sws, m_context->scaled_frame,
+                                          m_context->src_frame) :
+                          AVERROR(ENOMEM);
+    av_buffer_unref(&m_context->src_frame->buf[0]);
+    if (error < 0)
+      ERROR_LOG_FMT(FRAMEDUMP, "Error while converting frame: {}", AVErrorString(error));
+#else
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
+#endif
   }
 
   m_context->last_pts = pts;
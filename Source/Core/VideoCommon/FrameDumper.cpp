@@ -43,6 +43,19 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
                                    const MathUtil::Rectangle<int>& target_rect, u64 ticks,
                                    int frame_number)
 {
+  ReclaimEncodedFrames();
+
+  ReadbackSlot& slot = m_readback_slots[m_next_readback_slot];
+  if (slot.readback_state != ReadbackState::Free)
+  {
+    // Dropping the frame keeps the emulation from waiting for the encoder.
+    if (m_dropped_frames++ == 0)
+      OSD::AddMessage("Frame dumping can't keep up, frames are being dropped.");
+    WARN_LOG_FMT(VIDEO, "Dropped frame {} from the frame dump, the encoder is behind.",
+                 frame_number);
+    return;
+  }
+
   int source_width = src_rect.GetWidth();
   int source_height = src_rect.GetHeight();
   int target_width = target_rect.GetWidth();
@@ -61,13 +74,14 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  if (!CheckFrameDumpReadbackTexture(slot.texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  slot.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, slot.texture->GetRect());
+  slot.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  slot.readback_state = ReadbackState::Copying;
+  m_copying_slots.push_back(m_next_readback_slot);
+  m_next_readback_slot = (m_next_readback_slot + 1) % NUM_READBACK_TEXTURES;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -98,9 +112,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                                u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -117,83 +131,118 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_copying_slots.empty())
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  ReclaimEncodedFrames();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Single screenshots are queued right away, there's no later frame to overlap the copy with.
+  const bool dumping_frames = Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES);
+  QueueCopiedFrames(dumping_frames ? READBACK_LATENCY : 0);
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
+}
+
+void FrameDumper::QueueCopiedFrames(std::size_t frames_in_flight)
+{
+  while (m_copying_slots.size() > frames_in_flight)
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    const u32 slot_index = m_copying_slots.front();
+    m_copying_slots.pop_front();
+
+    // The copy has most likely finished by now, so this doesn't wait for the GPU.
+    ReadbackSlot& slot = m_readback_slots[slot_index];
+    slot.texture->Flush();
+    if (!slot.texture->Map())
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+      slot.readback_state = ReadbackState::Free;
+      continue;
+    }
+
+    slot.readback_state = ReadbackState::Encoding;
+    const AbstractStagingTexture& texture = *slot.texture;
+    FrameData frame{reinterpret_cast<const u8*>(texture.GetMappedPointer()),
+                    static_cast<int>(texture.GetConfig().width),
+                    static_cast<int>(texture.GetConfig().height),
+                    static_cast<int>(texture.GetMappedStride()), slot.state};
+
+    if (!m_frame_dump_thread_running.IsSet())
+    {
+      if (m_frame_dump_thread.joinable())
+        m_frame_dump_thread.join();
+      m_frame_dump_thread_running.Set();
+      m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
+    }
+
+    {
+      std::lock_guard lk(m_frame_queue_lock);
+      m_frame_queue.push_back({slot_index, frame});
+    }
+    m_frame_queue_changed.notify_all();
   }
-  else
+}
+
+void FrameDumper::ReclaimEncodedFrames()
+{
+  std::vector<u32> encoded_slots;
   {
-    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    std::lock_guard lk(m_frame_queue_lock);
+    encoded_slots.swap(m_encoded_slots);
   }
 
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+  for (const u32 slot_index : encoded_slots)
+  {
+    ReadbackSlot& slot = m_readback_slots[slot_index];
+    slot.texture->Unmap();
+    slot.readback_state = ReadbackState::Free;
+  }
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure the last queued readbacks have been sent to the encoder.
+  QueueCopiedFrames(0);
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
+  // Ensure the queued frames have been encoded.
   FinishFrameData();
 
   // Wake thread up, and wait for it to exit.
-  m_frame_dump_thread_running.Clear();
-  m_frame_dump_start.Set();
+  {
+    std::lock_guard lk(m_frame_queue_lock);
+    m_frame_dump_thread_running.Clear();
+  }
+  m_frame_queue_changed.notify_all();
   if (m_frame_dump_thread.joinable())
     m_frame_dump_thread.join();
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
-}
-
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
-{
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  for (ReadbackSlot& slot : m_readback_slots)
+    slot.texture.reset();
+  m_next_readback_slot = 0;
 
-  if (!m_frame_dump_thread_running.IsSet())
+  if (m_dropped_frames != 0)
   {
-    if (m_frame_dump_thread.joinable())
-      m_frame_dump_thread.join();
-    m_frame_dump_thread_running.Set();
-    m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
+    NOTICE_LOG_FMT(VIDEO, "Dropped {} frames from the frame dump.", m_dropped_frames);
+    OSD::AddMessage(fmt::format("Dropped {} frames from the frame dump.", m_dropped_frames));
+    m_dropped_frames = 0;
   }
-
-  // Wake worker thread up.
-  m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
 void FrameDumper::FinishFrameData()
 {
-  if (!m_frame_dump_frame_running)
-    return;
-
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  {
+    std::unique_lock lk(m_frame_queue_lock);
+    m_frame_queue_changed.wait(lk, [this] { return m_frame_queue.empty(); });
+  }
 
-  m_frame_dump_output_texture->Unmap();
+  ReclaimEncodedFrames();
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -215,11 +264,20 @@ void FrameDumper::FrameDumpThreadFunc()
 
   while (true)
   {
-    m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
+    QueuedFrame queued_frame;
+    {
+      std::unique_lock lk(m_frame_queue_lock);
+      m_frame_queue_changed.wait(lk, [this] {
+        return !m_frame_queue.empty() || !m_frame_dump_thread_running.IsSet();
+      });
+      if (m_frame_queue.empty())
+        break;
+
+      // The frame stays in the queue until it's encoded, so that FinishFrameData waits for it.
+      queued_frame = m_frame_queue.front();
+    }
 
-    auto frame = m_frame_dump_data;
+    const FrameData& frame = queued_frame.data;
 
     // Save screenshot
     if (m_screenshot_request.TestAndClear())
@@ -258,7 +316,12 @@ void FrameDumper::FrameDumpThreadFunc()
       }
     }
 
-    m_frame_dump_done.Set();
+    {
+      std::lock_guard lk(m_frame_queue_lock);
+      m_frame_queue.pop_front();
+      m_encoded_slots.push_back(queued_frame.slot);
+    }
+    m_frame_queue_changed.notify_all();
   }
 
   if (frame_dump_started)
@@ -3,6 +3,13 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -22,10 +29,11 @@ public:
   FrameDumper();
   ~FrameDumper();
 
-  // Ensures all rendered frames are queued for encoding.
+  // Queues the frames whose readback has finished for encoding.
   void FlushFrameDump();
 
-  // Fills the frame dump staging texture with the current XFB texture.
+  // Copies the current XFB texture to a free frame dump staging texture. The frame is dropped if
+  // the encoder is too far behind for a staging texture to be free.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect,
                         const MathUtil::Rectangle<int>& target_rect, u64 ticks, int frame_number);
@@ -38,6 +46,32 @@ public:
   void DoState(PointerWrap& p);
 
 private:
+  // Number of frames that can be read back or waiting for the encoder at once.
+  static constexpr u32 NUM_READBACK_TEXTURES = 4;
+  // Number of frames whose copy is left in flight when flushing, so that the GPU has finished a
+  // copy by the time it's mapped.
+  static constexpr u32 READBACK_LATENCY = 1;
+
+  enum class ReadbackState
+  {
+    Free,
+    Copying,
+    Encoding,
+  };
+
+  struct ReadbackSlot
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    FrameState state;
+    ReadbackState readback_state = ReadbackState::Free;
+  };
+
+  struct QueuedFrame
+  {
+    u32 slot = 0;
+    FrameData data;
+  };
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameData&);
@@ -53,40 +87,39 @@ private:
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
   // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& texture,
+                                     u32 target_width, u32 target_height);
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Maps the copied frames, leaving the newest frames_in_flight copies in flight, and queues them
+  // for encoding.
+  void QueueCopiedFrames(std::size_t frames_in_flight);
 
-  // Ensures all encoded frames have been written to the output file.
+  // Unmaps the staging textures of the frames the encoder has finished with.
+  void ReclaimEncodedFrames();
+
+  // Ensures all queued frames have been written to the output file.
   void FinishFrameData();
 
   std::thread m_frame_dump_thread;
   Common::Flag m_frame_dump_thread_running;
 
-  // Used to kick frame dump thread.
-  Common::Event m_frame_dump_start;
-
-  // Set by frame dump thread on frame completion.
-  Common::Event m_frame_dump_done;
-
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
-
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Ring of staging textures. Only accessed on the video thread.
+  std::array<ReadbackSlot, NUM_READBACK_TEXTURES> m_readback_slots;
+  u32 m_next_readback_slot = 0;
+  // Slots with a copy in flight, oldest first.
+  std::deque<u32> m_copying_slots;
+  // Frames dropped because no staging texture was free.
+  u32 m_dropped_frames = 0;
+
+  // Communication of frames between video and dump threads.
+  std::mutex m_frame_queue_lock;
+  std::condition_variable m_frame_queue_changed;
+  std::deque<QueuedFrame> m_frame_queue;
+  std::vector<u32> m_encoded_slots;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
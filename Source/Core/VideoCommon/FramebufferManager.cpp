@@ -5,6 +5,7 @@
 
 #include <fmt/format.h>
 #include <memory>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
@@ -486,6 +487,7 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
     PopulateEFBCache(false, tile_index);
 
   m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
+  RecordEFBPeek(false, tile_index);
 
   if (m_efb_color_cache.needs_flush)
   {
@@ -509,6 +511,7 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
     PopulateEFBCache(true, tile_index);
 
   m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
+  RecordEFBPeek(true, tile_index);
 
   if (m_efb_depth_cache.needs_flush)
   {
@@ -615,8 +618,67 @@ void FramebufferManager::EndOfFrame()
   for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
   {
     m_efb_color_cache.tiles[i].frame_access_mask <<= 1;
+    m_efb_color_cache.tiles[i].peek_draw_counter = EFB_CACHE_TILE_NOT_PEEKED;
     m_efb_depth_cache.tiles[i].frame_access_mask <<= 1;
+    m_efb_depth_cache.tiles[i].peek_draw_counter = EFB_CACHE_TILE_NOT_PEEKED;
   }
+
+  // Games usually peek at the same points of every frame, so this frame's peeks predict the next.
+  std::swap(m_efb_peek_predictions, m_efb_peeks_this_frame);
+  m_efb_peeks_this_frame.clear();
+  m_next_efb_peek_prediction = 0;
+}
+
+void FramebufferManager::RecordEFBPeek(bool depth, u32 tile_index)
+{
+  if (!g_ActiveConfig.bEFBAccessPredictive)
+    return;
+
+  // Only the first peek of a tile after each draw is recorded, as the tile stays present until the
+  // next draw invalidates it.
+  EFBCacheTile& tile = (depth ? m_efb_depth_cache : m_efb_color_cache).tiles[tile_index];
+  const u32 draw_counter = g_vertex_manager->GetDrawCounter();
+  if (tile.peek_draw_counter == draw_counter)
+    return;
+
+  tile.peek_draw_counter = draw_counter;
+  m_efb_peeks_this_frame.push_back({draw_counter, tile_index, depth});
+}
+
+void FramebufferManager::PrefetchPredictedPeeks(u32 draw_counter)
+{
+  // Predictions of draws that were skipped (e.g. the frame has fewer draws than the last one) are
+  // dropped, the peeks fall back to synchronous readbacks.
+  while (m_next_efb_peek_prediction < m_efb_peek_predictions.size() &&
+         m_efb_peek_predictions[m_next_efb_peek_prediction].draw_counter < draw_counter)
+  {
+    m_next_efb_peek_prediction++;
+  }
+
+  bool flush_command_buffer = false;
+  for (; m_next_efb_peek_prediction < m_efb_peek_predictions.size() &&
+         m_efb_peek_predictions[m_next_efb_peek_prediction].draw_counter == draw_counter;
+       m_next_efb_peek_prediction++)
+  {
+    const EFBPeekPrediction& prediction = m_efb_peek_predictions[m_next_efb_peek_prediction];
+    EFBCacheData& data = prediction.depth ? m_efb_depth_cache : m_efb_color_cache;
+    if (prediction.tile_index >= data.tiles.size() || data.tiles[prediction.tile_index].present)
+      continue;
+
+    PopulateEFBCache(prediction.depth, prediction.tile_index, true);
+    flush_command_buffer = true;
+  }
+
+  // Kick the copies to the GPU now, so they're done by the time the CPU peeks.
+  if (flush_command_buffer)
+    g_gfx->Flush();
+}
+
+void FramebufferManager::ResetEFBPeekPredictions()
+{
+  m_efb_peeks_this_frame.clear();
+  m_efb_peek_predictions.clear();
+  m_next_efb_peek_prediction = 0;
 }
 
 bool FramebufferManager::CompileReadbackPipelines()
@@ -763,9 +825,10 @@ bool FramebufferManager::CreateReadbackFramebuffer()
   }
 
   m_efb_color_cache.tiles.resize(total_tiles);
-  std::ranges::fill(m_efb_color_cache.tiles, EFBCacheTile{false, 0});
+  std::ranges::fill(m_efb_color_cache.tiles, EFBCacheTile{false, 0, EFB_CACHE_TILE_NOT_PEEKED});
   m_efb_depth_cache.tiles.resize(total_tiles);
-  std::ranges::fill(m_efb_depth_cache.tiles, EFBCacheTile{false, 0});
+  std::ranges::fill(m_efb_depth_cache.tiles, EFBCacheTile{false, 0, EFB_CACHE_TILE_NOT_PEEKED});
+  ResetEFBPeekPredictions();
 
   return true;
 }
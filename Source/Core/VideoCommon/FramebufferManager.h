@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumFormatter.h"
@@ -123,6 +124,10 @@ public:
   void FlagPeekCacheAsOutOfDate();
   void EndOfFrame();
 
+  // Call after a draw has flagged the peek cache as out of date. Starts downloading the tiles that
+  // were peeked after the same draw last frame, so the peeks don't have to wait for the GPU.
+  void PrefetchPredictedPeeks(u32 draw_counter);
+
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
   void PokeEFBColor(u32 x, u32 y, u32 color);
   void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -139,10 +144,23 @@ protected:
   };
   static_assert(std::is_standard_layout<EFBPokeVertex>::value, "EFBPokeVertex is standard-layout");
 
+  // Draw counter of tiles which haven't been peeked this frame.
+  static constexpr u32 EFB_CACHE_TILE_NOT_PEEKED = UINT32_MAX;
+
   struct EFBCacheTile
   {
     bool present;
     u8 frame_access_mask;
+    // Draw counter at the last peek of this frame, or EFB_CACHE_TILE_NOT_PEEKED.
+    u32 peek_draw_counter;
+  };
+
+  // A peek of a tile after the given draw, used to prefetch the tile at the same draw next frame.
+  struct EFBPeekPrediction
+  {
+    u32 draw_counter;
+    u32 tile_index;
+    bool depth;
   };
 
   // EFB cache - for CPU EFB access
@@ -182,6 +200,8 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void RecordEFBPeek(bool depth, u32 tile_index);
+  void ResetEFBPeekPredictions();
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -227,6 +247,12 @@ protected:
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
 
+  // Predictive EFB access. The peeks of this frame are recorded in draw order, and replayed as
+  // asynchronous readbacks next frame.
+  std::vector<EFBPeekPrediction> m_efb_peeks_this_frame;
+  std::vector<EFBPeekPrediction> m_efb_peek_predictions;
+  size_t m_next_efb_peek_prediction = 0;
+
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
   std::array<std::array<std::array<std::unique_ptr<AbstractPipeline>, 2>, 2>, 2> m_clear_pipelines;
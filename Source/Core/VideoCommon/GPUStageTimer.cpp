@@ -0,0 +1,99 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUStageTimer.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace VideoCommon
+{
+namespace
+{
+std::atomic<bool> s_enabled = false;
+std::array<std::atomic<u64>, GPUStageTimes{}.size()> s_times{};
+
+// Innermost running timer of the current thread.
+thread_local ScopedGPUStageTimer* s_current_timer = nullptr;
+
+u64 NowNs()
+{
+  return static_cast<u64>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+          .count());
+}
+}  // namespace
+
+namespace GPUStageTimer
+{
+void SetEnabled(bool enabled)
+{
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsEnabled()
+{
+  return s_enabled.load(std::memory_order_relaxed);
+}
+
+GPUStageTimes GetTimes()
+{
+  GPUStageTimes times;
+  for (std::size_t i = 0; i < s_times.size(); ++i)
+    times[static_cast<GPUStage>(i)] = s_times[i].load(std::memory_order_relaxed);
+  return times;
+}
+
+void Reset()
+{
+  for (auto& time : s_times)
+    time.store(0, std::memory_order_relaxed);
+}
+
+const char* GetStageName(GPUStage stage)
+{
+  static constexpr Common::EnumMap<const char*, GPUStage::BackendSubmit> names = {
+      "Opcode decode",
+      "Vertex loading",
+      "Texture cache lookup",
+      "Texture decode",
+      "Backend submission",
+  };
+  return names[stage];
+}
+}  // namespace GPUStageTimer
+
+ScopedGPUStageTimer::ScopedGPUStageTimer(GPUStage stage) : m_stage(stage)
+{
+  if (!GPUStageTimer::IsEnabled())
+    return;
+
+  const u64 now = NowNs();
+  m_active = true;
+  m_parent = s_current_timer;
+  if (m_parent)
+    m_parent->Pause(now);
+
+  s_current_timer = this;
+  m_start = now;
+}
+
+ScopedGPUStageTimer::~ScopedGPUStageTimer()
+{
+  if (!m_active)
+    return;
+
+  const u64 now = NowNs();
+  Pause(now);
+
+  s_current_timer = m_parent;
+  if (m_parent)
+    m_parent->Resume(now);
+}
+
+void ScopedGPUStageTimer::Pause(u64 now)
+{
+  s_times[static_cast<std::size_t>(m_stage)].fetch_add(now - m_start, std::memory_order_relaxed);
+}
+}  // namespace VideoCommon
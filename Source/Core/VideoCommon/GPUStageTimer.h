@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+
+namespace VideoCommon
+{
+// Coarse buckets of work done by the GPU thread. Time spent in a nested stage is only counted
+// towards the innermost stage, so the buckets add up to the total instrumented time.
+enum class GPUStage : u8
+{
+  OpcodeDecode,
+  VertexLoading,
+  TextureCacheLookup,
+  TextureDecode,
+  BackendSubmit,
+};
+
+using GPUStageTimes = Common::EnumMap<u64, GPUStage::BackendSubmit>;
+
+namespace GPUStageTimer
+{
+// Timing is disabled by default, as reading the clock on every scope is not free.
+void SetEnabled(bool enabled);
+bool IsEnabled();
+
+// Returns the accumulated exclusive time of each stage in nanoseconds.
+GPUStageTimes GetTimes();
+void Reset();
+
+const char* GetStageName(GPUStage stage);
+}  // namespace GPUStageTimer
+
+class ScopedGPUStageTimer
+{
+public:
+  explicit ScopedGPUStageTimer(GPUStage stage);
+  ~ScopedGPUStageTimer();
+
+  ScopedGPUStageTimer(const ScopedGPUStageTimer&) = delete;
+  ScopedGPUStageTimer& operator=(const ScopedGPUStageTimer&) = delete;
+
+private:
+  void Pause(u64 now);
+  void Resume(u64 now) { m_start = now; }
+
+  GPUStage m_stage;
+  bool m_active = false;
+  u64 m_start = 0;
+  ScopedGPUStageTimer* m_parent = nullptr;
+};
+}  // namespace VideoCommon
@@ -88,6 +88,13 @@ struct SerializedGXUberPipelineUid
   u32 depth_state_bits = 0;
   u32 blending_state_bits = 0;
 };
+// How a specialized pipeline was used in earlier sessions, see ShaderCache::PipelineCacheEntry.
+struct SerializedGXPipelineUsage
+{
+  SerializedGXPipelineUid uid;
+  u32 earliest_first_use = 0;
+  u32 num_sessions_used = 0;
+};
 #pragma pack(pop)
 
 }  // namespace VideoCommon
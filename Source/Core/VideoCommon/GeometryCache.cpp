@@ -0,0 +1,267 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GeometryCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <span>
+
+#include <xxhash.h>
+
+#include "Common/Swap.h"
+#include "Core/HW/Memmap.h"
+#include "Core/System.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VertexLoader_Color.h"
+#include "VideoCommon/VertexLoader_Normal.h"
+#include "VideoCommon/VertexLoader_Position.h"
+#include "VideoCommon/VertexLoader_TextCoord.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr int MIN_CACHED_VERTICES = 16;
+constexpr size_t MAX_CACHE_SIZE = 64 * 1024 * 1024;
+
+// Returns the highest index used by an indexed component, or std::nullopt if a vertex is skipped
+// through an index of 0xff/0xffff.
+std::optional<u32> GetMaxIndex(VertexComponentFormat format, const u8* src, u32 offset,
+                               u32 vertex_size, int count)
+{
+  u32 max_index = 0;
+  if (format == VertexComponentFormat::Index8)
+  {
+    for (int i = 0; i < count; ++i, src += vertex_size)
+    {
+      const u8 index = src[offset];
+      if (index == 0xff)
+        return std::nullopt;
+      max_index = std::max<u32>(max_index, index);
+    }
+  }
+  else
+  {
+    for (int i = 0; i < count; ++i, src += vertex_size)
+    {
+      const u16 index = Common::swap16(&src[offset]);
+      if (index == 0xffff)
+        return std::nullopt;
+      max_index = std::max<u32>(max_index, index);
+    }
+  }
+  return max_index;
+}
+}  // namespace
+
+bool GeometryCache::ShouldCache(int count)
+{
+  return count >= MIN_CACHED_VERTICES;
+}
+
+bool GeometryCache::GatherInputs(const VertexLoaderBase& loader, int vtx_attr_group, const u8* src,
+                                 int count)
+{
+  const TVtxDesc& vtx_desc = g_main_cp_state.vtx_desc;
+  const VAT& vtx_attr = g_main_cp_state.vtx_attr[vtx_attr_group];
+
+  m_inputs.format.assign({vtx_desc.low.Hex, vtx_desc.high.Hex, vtx_attr.g0.Hex, vtx_attr.g1.Hex,
+                          vtx_attr.g2.Hex});
+  m_inputs.data.assign({std::span<const u8>(src, size_t(loader.m_vertex_size) * count)});
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  bool cacheable = true;
+
+  // Adds the part of an array that the indices of this primitive refer to. element_size is the
+  // number of bytes read starting at an index.
+  const auto add_array = [&](CPArray array, VertexComponentFormat format,
+                              std::initializer_list<u32> offsets, u32 element_size) {
+    if (!IsIndexed(format))
+      return;
+
+    u32 max_index = 0;
+    for (const u32 offset : offsets)
+    {
+      const std::optional<u32> index = GetMaxIndex(format, src, offset, loader.m_vertex_size, count);
+      if (!index)
+      {
+        cacheable = false;
+        return;
+      }
+      max_index = std::max(max_index, *index);
+    }
+
+    const u32 stride = g_main_cp_state.array_strides[array];
+    const std::span<u8> span = memory.GetSpanForAddress(g_main_cp_state.array_bases[array]);
+    const size_t size = std::min<size_t>(span.size(), size_t(stride) * max_index + element_size);
+    m_inputs.format.push_back(stride);
+    m_inputs.data.push_back(span.first(size));
+  };
+
+  // The order of the components matches VertexLoaderBase::GetVertexSize.
+  u32 offset = 0;
+  if (vtx_desc.low.PosMatIdx)
+    offset++;
+  for (auto texmtxidx : vtx_desc.low.TexMatIdx)
+  {
+    if (texmtxidx)
+      offset++;
+  }
+
+  add_array(CPArray::Position, vtx_desc.low.Position, {offset},
+            VertexLoader_Position::GetSize(VertexComponentFormat::Direct, vtx_attr.g0.PosFormat,
+                                           vtx_attr.g0.PosElements));
+  offset += VertexLoader_Position::GetSize(vtx_desc.low.Position, vtx_attr.g0.PosFormat,
+                                           vtx_attr.g0.PosElements);
+
+  // In 3-index mode, the tangent and binormal are read at an offset from their own index, but
+  // never past the size of a directly specified normal, tangent and binormal.
+  const u32 norm_direct_size =
+      VertexLoader_Normal::GetSize(VertexComponentFormat::Direct, vtx_attr.g0.NormalFormat,
+                                   vtx_attr.g0.NormalElements, vtx_attr.g0.NormalIndex3);
+  if (vtx_attr.g0.NormalIndex3 && IsIndexed(vtx_desc.low.Normal) &&
+      vtx_attr.g0.NormalElements == NormalComponentCount::NTB)
+  {
+    const u32 index_size = vtx_desc.low.Normal == VertexComponentFormat::Index16 ? 2 : 1;
+    add_array(CPArray::Normal, vtx_desc.low.Normal,
+              {offset, offset + index_size, offset + 2 * index_size}, norm_direct_size);
+  }
+  else
+  {
+    add_array(CPArray::Normal, vtx_desc.low.Normal, {offset}, norm_direct_size);
+  }
+  offset += VertexLoader_Normal::GetSize(vtx_desc.low.Normal, vtx_attr.g0.NormalFormat,
+                                         vtx_attr.g0.NormalElements, vtx_attr.g0.NormalIndex3);
+
+  for (u32 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    add_array(CPArray::Color0 + i, vtx_desc.low.Color[i], {offset},
+              VertexLoader_Color::GetSize(VertexComponentFormat::Direct,
+                                          vtx_attr.GetColorFormat(i)));
+    offset += VertexLoader_Color::GetSize(vtx_desc.low.Color[i], vtx_attr.GetColorFormat(i));
+  }
+
+  for (u32 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    add_array(CPArray::TexCoord0 + i, vtx_desc.high.TexCoord[i], {offset},
+              VertexLoader_TextCoord::GetSize(VertexComponentFormat::Direct,
+                                              vtx_attr.GetTexFormat(i),
+                                              vtx_attr.GetTexElements(i)));
+    offset += VertexLoader_TextCoord::GetSize(vtx_desc.high.TexCoord[i], vtx_attr.GetTexFormat(i),
+                                              vtx_attr.GetTexElements(i));
+  }
+
+  // Skipped vertices leave parts of the zfreeze caches untouched, which an entry can't restore.
+  if (!cacheable)
+    return false;
+
+  u64 hash = XXH3_64bits(m_inputs.format.data(), m_inputs.format.size() * sizeof(u32));
+  for (const std::span<const u8> data : m_inputs.data)
+    hash = XXH3_64bits_withSeed(data.data(), data.size(), hash);
+  m_inputs.hash = hash;
+  return true;
+}
+
+bool GeometryCache::MatchesInputs(const Entry& entry) const
+{
+  if (entry.format != m_inputs.format)
+    return false;
+
+  size_t offset = 0;
+  for (const std::span<const u8> data : m_inputs.data)
+  {
+    if (entry.data.size() - offset < data.size() ||
+        std::memcmp(entry.data.data() + offset, data.data(), data.size()) != 0)
+    {
+      return false;
+    }
+    offset += data.size();
+  }
+  return offset == entry.data.size();
+}
+
+int GeometryCache::RunVertices(VertexLoaderBase* loader, int vtx_attr_group, const u8* src,
+                               u8* dst, int count)
+{
+  if (!GatherInputs(*loader, vtx_attr_group, src, count))
+    return loader->RunVertices(src, dst, count);
+
+  const auto it = m_entry_map.find(m_inputs.hash);
+  if (it != m_entry_map.end() && it->second->count == count && MatchesInputs(*it->second))
+  {
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    const Entry& entry = *it->second;
+
+    std::memcpy(dst, entry.vertices.data(), entry.vertices.size());
+
+    // Only restore the caches the loader would have written.
+    const u32 components = loader->m_native_components;
+    VertexLoaderManager::position_cache = entry.position_cache;
+    if (components & VB_HAS_POSMTXIDX)
+      VertexLoaderManager::position_matrix_index_cache = entry.position_matrix_index_cache;
+    if (components & VB_HAS_NORMAL)
+      VertexLoaderManager::normal_cache = entry.normal_cache;
+    if (components & VB_HAS_TANGENT)
+      VertexLoaderManager::tangent_cache = entry.tangent_cache;
+    if (components & VB_HAS_BINORMAL)
+      VertexLoaderManager::binormal_cache = entry.binormal_cache;
+
+    loader->m_numLoadedVertices += count;
+    INCSTAT(g_stats.this_frame.num_geometry_cache_hits);
+    return entry.num_loaded;
+  }
+
+  const int num_loaded = loader->RunVertices(src, dst, count);
+  Insert(count, num_loaded, dst, size_t(num_loaded) * loader->m_native_vtx_decl.stride);
+  INCSTAT(g_stats.this_frame.num_geometry_cache_misses);
+  return num_loaded;
+}
+
+void GeometryCache::Insert(int count, int num_loaded, const u8* vertices, size_t size)
+{
+  const u64 key = m_inputs.hash;
+  if (const auto it = m_entry_map.find(key); it != m_entry_map.end())
+  {
+    m_size -= it->second->vertices.size() + it->second->data.size();
+    m_entries.erase(it->second);
+    m_entry_map.erase(it);
+  }
+
+  Entry& entry = m_entries.emplace_front();
+  entry.key = key;
+  entry.count = count;
+  entry.num_loaded = num_loaded;
+  entry.vertices.assign(vertices, vertices + size);
+  entry.format = m_inputs.format;
+  for (const std::span<const u8> data : m_inputs.data)
+    entry.data.insert(entry.data.end(), data.begin(), data.end());
+  entry.position_matrix_index_cache = VertexLoaderManager::position_matrix_index_cache;
+  entry.position_cache = VertexLoaderManager::position_cache;
+  entry.normal_cache = VertexLoaderManager::normal_cache;
+  entry.tangent_cache = VertexLoaderManager::tangent_cache;
+  entry.binormal_cache = VertexLoaderManager::binormal_cache;
+  m_entry_map.emplace(key, m_entries.begin());
+  m_size += entry.vertices.size() + entry.data.size();
+
+  while (m_size > MAX_CACHE_SIZE && m_entries.size() > 1)
+  {
+    const Entry& oldest = m_entries.back();
+    m_size -= oldest.vertices.size() + oldest.data.size();
+    m_entry_map.erase(oldest.key);
+    m_entries.pop_back();
+  }
+}
+
+void GeometryCache::Clear()
+{
+  m_entries.clear();
+  m_entry_map.clear();
+  m_size = 0;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+class VertexLoaderBase;
+
+namespace VideoCommon
+{
+// Keeps the output of the vertex loaders for primitives drawn from display lists. Games tend to
+// call the same display lists every frame, so most of these primitives convert to exactly the same
+// vertices as in the previous frame.
+//
+// An entry is keyed by a hash of everything the vertex loader reads: the vertex descriptor and
+// attribute table, the raw vertex data, and the strides and referenced contents of all indexed
+// arrays. Changing any of them (e.g. the CPU updating a vertex array) results in a different key,
+// so entries never have to be invalidated explicitly; unused ones are evicted once the cache is
+// full. Entries keep a copy of these inputs, which is compared on a hit so that hash collisions
+// can't return the wrong vertices.
+class GeometryCache
+{
+public:
+  // Whether the primitive is worth looking up. Hashing tiny primitives costs about as much as
+  // loading them.
+  static bool ShouldCache(int count);
+
+  // Loads count vertices from src to dst, either from the cache or by running the loader.
+  // Returns the number of vertices written, like VertexLoaderBase::RunVertices.
+  int RunVertices(VertexLoaderBase* loader, int vtx_attr_group, const u8* src, u8* dst,
+                  int count);
+
+  void Clear();
+
+private:
+  // Everything the vertex loader reads for a primitive
+  struct Inputs
+  {
+    // The vertex descriptor and attribute table, followed by the stride of each indexed array
+    std::vector<u32> format;
+    // The raw vertex data, followed by the referenced part of each indexed array
+    std::vector<std::span<const u8>> data;
+    u64 hash = 0;
+  };
+
+  struct Entry
+  {
+    u64 key = 0;
+    int count = 0;
+    int num_loaded = 0;
+    std::vector<u8> vertices;
+    std::vector<u32> format;
+    std::vector<u8> data;
+
+    // Side effects of the vertex loaders, see VertexLoaderManager.h
+    std::array<u32, 3> position_matrix_index_cache{};
+    std::array<std::array<float, 4>, 3> position_cache{};
+    std::array<float, 4> normal_cache{};
+    std::array<float, 4> tangent_cache{};
+    std::array<float, 4> binormal_cache{};
+  };
+
+  // Returns false if the primitive can't be cached.
+  bool GatherInputs(const VertexLoaderBase& loader, int vtx_attr_group, const u8* src, int count);
+  bool MatchesInputs(const Entry& entry) const;
+
+  void Insert(int count, int num_loaded, const u8* vertices, size_t size);
+
+  // Most recently used first
+  std::list<Entry> m_entries;
+  std::unordered_map<u64, std::list<Entry>::iterator> m_entry_map;
+  size_t m_size = 0;
+
+  // Reused by every lookup to avoid allocations
+  Inputs m_inputs;
+};
+}  // namespace VideoCommon
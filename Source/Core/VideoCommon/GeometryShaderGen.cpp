@@ -89,7 +89,7 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
     }
   }
 
-  out.Write("{}", s_lighting_struct);
+  out.Append(s_lighting_struct);
 
   // uniforms
   if (api_type == APIType::OpenGL || api_type == APIType::Vulkan)
@@ -97,7 +97,7 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
   else
     out.Write("cbuffer GSBlock {{\n");
 
-  out.Write("{}", s_geometry_shader_uniforms);
+  out.Append(s_geometry_shader_uniforms);
   out.Write("}};\n");
 
   out.Write("struct VS_OUTPUT {{\n");
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -26,6 +27,8 @@
 #include "Core/System.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TextureArchive.h"
+#include "VideoCommon/Assets/TextureArchiveAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -35,44 +38,70 @@ static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_te
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+static auto s_archive_library = std::make_shared<VideoCommon::TextureArchiveAssetLibrary>();
 
 namespace
 {
-std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
+struct TextureLookup
 {
-  if (s_hires_texture_id_to_arbmipmap.empty())
-    return {"", false};
-
-  const auto texture_name_details = texture_info.CalculateTextureName();
-  // look for an exact match first
-  const std::string full_name = texture_name_details.GetFullName();
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(full_name);
+  std::string name;
+  bool has_arbitrary_mipmaps;
+  std::shared_ptr<VideoCommon::CustomAssetLibrary> library;
+};
+
+// Loose files take priority over archives, so single textures of a packed texture pack can be
+// replaced.
+std::optional<TextureLookup> FindTexture(std::string name)
+{
+  if (auto iter = s_hires_texture_id_to_arbmipmap.find(name);
       iter != s_hires_texture_id_to_arbmipmap.end())
   {
-    return {full_name, iter->second};
+    return TextureLookup{std::move(name), iter->second, s_file_library};
   }
 
+  if (const auto texture = s_archive_library->FindTexture(name))
+    return TextureLookup{std::move(name), texture->has_arbitrary_mipmaps, s_archive_library};
+
+  return std::nullopt;
+}
+
+std::optional<TextureLookup> LookupTexture(const TextureInfo& texture_info)
+{
+  if (s_hires_texture_id_to_arbmipmap.empty() && s_archive_library->IsEmpty())
+    return std::nullopt;
+
+  const auto texture_name_details = texture_info.CalculateTextureName();
+  // look for an exact match first
+  if (auto texture = FindTexture(texture_name_details.GetFullName()))
+    return texture;
+
   // Single wildcard ignoring the tlut hash
-  const std::string texture_name_single_wildcard_tlut =
-      fmt::format("{}_{}_$_{}", texture_name_details.base_name, texture_name_details.texture_name,
-                  texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tlut);
-      iter != s_hires_texture_id_to_arbmipmap.end())
+  if (auto texture = FindTexture(fmt::format("{}_{}_$_{}", texture_name_details.base_name,
+                                             texture_name_details.texture_name,
+                                             texture_name_details.format_name)))
   {
-    return {texture_name_single_wildcard_tlut, iter->second};
+    return texture;
   }
 
   // Single wildcard ignoring the texture hash
-  const std::string texture_name_single_wildcard_tex =
-      fmt::format("{}_${}_{}", texture_name_details.base_name, texture_name_details.tlut_name,
-                  texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tex);
-      iter != s_hires_texture_id_to_arbmipmap.end())
+  return FindTexture(fmt::format("{}_${}_{}", texture_name_details.base_name,
+                                 texture_name_details.tlut_name,
+                                 texture_name_details.format_name));
+}
+
+// Archives named after the game directly in the texture folder are found without searching any
+// directories.
+std::vector<std::string> GetTextureArchivesWithGameId(const std::string& root_directory,
+                                                      const std::string& game_id)
+{
+  for (const std::string& name : {game_id, game_id.substr(0, 3)})
   {
-    return {texture_name_single_wildcard_tex, iter->second};
+    std::string path =
+        fmt::format("{}{}{}", root_directory, name, VideoCommon::TextureArchive::FILE_EXTENSION);
+    if (File::Exists(path))
+      return {std::move(path)};
   }
-
-  return {"", false};
+  return {};
 }
 }  // namespace
 
@@ -90,9 +119,16 @@ void HiresTexture::Update()
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
+  const std::string& root_directory = File::GetUserPath(D_HIRESTEXTURES_IDX);
+  const std::vector<std::string> extensions{
+      ".png", ".dds", std::string(VideoCommon::TextureArchive::FILE_EXTENSION)};
+
+  // An archive named after the game replaces the texture folders, so that the texture folder
+  // tree isn't walked at all. Lookups only probe the index of the archive.
+  std::vector<std::string> archive_paths = GetTextureArchivesWithGameId(root_directory, game_id);
   const std::set<std::string> texture_directories =
-      GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
-  const std::vector<std::string> extensions{".png", ".dds"};
+      archive_paths.empty() ? GetTextureDirectoriesWithGameId(root_directory, game_id) :
+                              std::set<std::string>{};
 
   for (const auto& texture_directory : texture_directories)
   {
@@ -106,7 +142,15 @@ void HiresTexture::Update()
     for (auto& path : texture_paths)
     {
       std::string filename;
-      SplitPath(path, nullptr, &filename, nullptr);
+      std::string extension;
+      SplitPath(path, nullptr, &filename, &extension);
+
+      Common::ToLower(&extension);
+      if (extension == VideoCommon::TextureArchive::FILE_EXTENSION)
+      {
+        archive_paths.push_back(path);
+        continue;
+      }
 
       if (filename.substr(0, s_format_prefix.length()) == s_format_prefix)
       {
@@ -130,9 +174,9 @@ void HiresTexture::Update()
 
           if (g_ActiveConfig.bCacheHiresTextures)
           {
-            auto hires_texture =
-                std::make_shared<HiresTexture>(has_arbitrary_mipmaps, std::move(filename));
-            static_cast<void>(hires_texture->LoadTexture());
+            auto hires_texture = std::make_shared<HiresTexture>(
+                has_arbitrary_mipmaps, std::move(filename), s_file_library);
+            hires_texture->Prefetch();
             s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
           }
         }
@@ -146,15 +190,37 @@ void HiresTexture::Update()
     }
   }
 
+  // The archives are only opened here and searched on lookup, their textures aren't listed.
+  auto archive_library = std::make_shared<VideoCommon::TextureArchiveAssetLibrary>();
+  for (const std::string& path : archive_paths)
+  {
+    if (archive_library->AddArchive(path))
+      INFO_LOG_FMT(VIDEO, "Using custom texture archive '{}'", path);
+  }
+  s_archive_library = std::move(archive_library);
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
+    s_archive_library->ForEachTexture([](const VideoCommon::TextureArchive::Texture& texture) {
+      std::string name(texture.name);
+      if (s_hires_texture_id_to_arbmipmap.contains(name) || s_hires_texture_cache.contains(name))
+        return;
+
+      auto hires_texture = std::make_shared<HiresTexture>(texture.has_arbitrary_mipmaps,
+                                                          std::move(name), s_archive_library);
+      hires_texture->Prefetch();
+      s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
+    });
+
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
                     10000);
   }
   else
   {
-    OSD::AddMessage(
-        fmt::format("Found '{}' custom textures", s_hires_texture_id_to_arbmipmap.size()), 10000);
+    OSD::AddMessage(fmt::format("Found '{}' custom textures",
+                                s_hires_texture_id_to_arbmipmap.size() +
+                                    s_archive_library->GetTextureCount()),
+                    10000);
   }
 }
 
@@ -163,21 +229,23 @@ void HiresTexture::Clear()
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+  s_archive_library = std::make_shared<VideoCommon::TextureArchiveAssetLibrary>();
 }
 
 std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
 {
-  auto [base_filename, has_arb_mipmaps] = GetNameArbPair(texture_info);
-  if (base_filename == "")
+  auto texture = LookupTexture(texture_info);
+  if (!texture)
     return nullptr;
 
-  if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
+  if (auto iter = s_hires_texture_cache.find(texture->name); iter != s_hires_texture_cache.end())
   {
     return iter->second;
   }
   else
   {
-    auto hires_texture = std::make_shared<HiresTexture>(has_arb_mipmaps, std::move(base_filename));
+    auto hires_texture = std::make_shared<HiresTexture>(
+        texture->has_arbitrary_mipmaps, std::move(texture->name), std::move(texture->library));
     if (g_ActiveConfig.bCacheHiresTextures)
     {
       s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
@@ -186,8 +254,10 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   }
 }
 
-HiresTexture::HiresTexture(bool has_arbitrary_mipmaps, std::string id)
-    : m_has_arbitrary_mipmaps(has_arbitrary_mipmaps), m_id(std::move(id))
+HiresTexture::HiresTexture(bool has_arbitrary_mipmaps, std::string id,
+                           std::shared_ptr<VideoCommon::CustomAssetLibrary> library)
+    : m_has_arbitrary_mipmaps(has_arbitrary_mipmaps), m_id(std::move(id)),
+      m_library(std::move(library))
 {
 }
 
@@ -195,7 +265,14 @@ VideoCommon::CustomResourceManager::TextureTimePair HiresTexture::LoadTexture()
 {
   auto& system = Core::System::GetInstance();
   auto& custom_resource_manager = system.GetCustomResourceManager();
-  return custom_resource_manager.GetTextureDataFromAsset(m_id, s_file_library);
+  return custom_resource_manager.GetTextureDataFromAsset(m_id, m_library);
+}
+
+void HiresTexture::Prefetch() const
+{
+  auto& system = Core::System::GetInstance();
+  auto& custom_resource_manager = system.GetCustomResourceManager();
+  custom_resource_manager.PrefetchTextureDataAsset(m_id, m_library);
 }
 
 std::set<std::string> GetTextureDirectoriesWithGameId(const std::string& root_directory,
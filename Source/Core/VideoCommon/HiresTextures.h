@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
 #include "VideoCommon/Assets/CustomResourceManager.h"
 #include "VideoCommon/Assets/CustomTextureData.h"
 #include "VideoCommon/TextureConfig.h"
@@ -27,13 +28,17 @@ public:
   static void Shutdown();
   static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info);
 
-  HiresTexture(bool has_arbitrary_mipmaps, std::string id);
+  HiresTexture(bool has_arbitrary_mipmaps, std::string id,
+               std::shared_ptr<VideoCommon::CustomAssetLibrary> library);
 
   bool HasArbitraryMipmaps() const { return m_has_arbitrary_mipmaps; }
   VideoCommon::CustomResourceManager::TextureTimePair LoadTexture() const;
+  // Loads the texture in the background, if it fits in the custom texture memory budget
+  void Prefetch() const;
   const std::string& GetId() const { return m_id; }
 
 private:
   bool m_has_arbitrary_mipmaps = false;
   std::string m_id;
+  std::shared_ptr<VideoCommon::CustomAssetLibrary> m_library;
 };
@@ -14,16 +14,21 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <optional>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
+#include "Common/TimelineTrace.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
+#include "VideoCommon/CommandStream.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/GPUStageTimer.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -187,11 +192,13 @@ public:
         {
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
+          VertexLoaderManager::g_in_display_list = true;
 
           Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
           // un-swap
+          VertexLoaderManager::g_in_display_list = false;
           g_stats.SwapDL();
         }
       }
@@ -260,6 +267,13 @@ public:
 template <bool is_preprocess>
 u8* RunFifo(DataReader src, u32* cycles)
 {
+  TIMELINE_TRACE_SCOPE(is_preprocess ? "FIFO preprocess" : "FIFO decode");
+
+  // Only the GPU thread's pass counts towards decode time, not preprocessing on the CPU thread.
+  std::optional<VideoCommon::ScopedGPUStageTimer> decode_timer;
+  if constexpr (!is_preprocess)
+    decode_timer.emplace(VideoCommon::GPUStage::OpcodeDecode);
+
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
@@ -274,4 +288,189 @@ u8* RunFifo(DataReader src, u32* cycles)
 template u8* RunFifo<true>(DataReader src, u32* cycles);
 template u8* RunFifo<false>(DataReader src, u32* cycles);
 
+// Decode half of the pipelined GPU thread. The decode thread owns the CP state that the vertex
+// loaders use (vertex descriptors, attribute tables and arrays); everything else is recorded for
+// the GPU thread.
+class DecodeCallback final : public Callback
+{
+public:
+  DecodeCallback(VideoCommon::CommandStream& stream, bool use_geometry_cache)
+      : m_stream(stream), m_use_geometry_cache(use_geometry_cache)
+  {
+  }
+
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+  {
+    m_cycles += 18 + 6 * count;
+    m_stream.LoadXF(address, count, data);
+  }
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+  {
+    m_cycles += 12;
+    const u8 sub_command = command & CP_COMMAND_MASK;
+
+    // The vertex loaders don't use the matrix indices, but the vertex shader manager does.
+    if (sub_command == MATINDEX_A || sub_command == MATINDEX_B)
+    {
+      m_stream.LoadCP(command, value);
+      return;
+    }
+
+    if (sub_command == VCD_LO || sub_command == VCD_HI)
+    {
+      VertexLoaderManager::g_main_vat_dirty = BitSet8::AllTrue(CP_NUM_VAT_REG);
+      VertexLoaderManager::g_bases_dirty = true;
+    }
+    else if (sub_command == CP_VAT_REG_A || sub_command == CP_VAT_REG_B ||
+             sub_command == CP_VAT_REG_C)
+    {
+      VertexLoaderManager::g_main_vat_dirty[command & CP_VAT_MASK] = true;
+    }
+    else if (sub_command == ARRAY_BASE)
+    {
+      VertexLoaderManager::g_bases_dirty = true;
+    }
+
+    INCSTAT(g_stats.this_frame.num_cp_loads);
+    GetCPState().LoadCPReg(command, value);
+  }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+  {
+    m_cycles += 12;
+    m_stream.LoadBP(command, value, m_cycles);
+
+    // The CPU waits for these before it reuses memory or changes the FIFO, so nothing after them
+    // may be decoded before the GPU thread signalled them.
+    if (command == BPMEM_SETDRAWDONE || command == BPMEM_PE_TOKEN_ID ||
+        command == BPMEM_PE_TOKEN_INT_ID)
+    {
+      m_stream.RequestSync();
+    }
+  }
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+  {
+    m_cycles += 6;
+
+    auto& memory = Core::System::GetInstance().GetMemory();
+    const u8* data = memory.GetPointerForRange(
+        g_main_cp_state.array_bases[array] + g_main_cp_state.array_strides[array] * index,
+        size * sizeof(u32));
+    if (data != nullptr)
+      m_stream.LoadIndexedXF(address, size, data);
+  }
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices, const u8* vertex_data))
+  {
+    const u32 size = vertex_size * num_vertices;
+
+    const u32 bytes = VertexLoaderManager::LoadVerticesForSubmission(
+        vat, primitive, num_vertices, vertex_data, m_stream,
+        m_use_geometry_cache && m_in_display_list);
+
+    ASSERT(bytes == size);
+
+    // 4 GPU ticks per vertex, 3 CPU ticks per GPU tick
+    m_cycles += num_vertices * 4 * 3 + 6;
+  }
+  OPCODE_CALLBACK_NOINLINE(void OnDisplayList(u32 address, u32 size))
+  {
+    m_cycles += 6;
+
+    if (m_in_display_list)
+    {
+      WARN_LOG_FMT(VIDEO, "recursive display list detected");
+      return;
+    }
+
+    auto& memory = Core::System::GetInstance().GetMemory();
+    const u8* const start_address = memory.GetPointerForRange(address, size);
+    if (start_address != nullptr)
+    {
+      // Unlike RunCallback, the DL statistics aren't swapped in, as the GPU thread updates the
+      // same statistics concurrently.
+      m_in_display_list = true;
+      Run(start_address, size, *this);
+      m_in_display_list = false;
+      INCSTAT(g_stats.this_frame.num_dlists_called);
+    }
+  }
+  OPCODE_CALLBACK(void OnNop(u32 count)) { m_cycles += 6 * count; }
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+  {
+    if (static_cast<Opcode>(opcode) == Opcode::GX_CMD_UNKNOWN_METRICS ||
+        static_cast<Opcode>(opcode) == Opcode::GX_CMD_INVL_VC)
+    {
+      m_cycles += 6;
+    }
+    else
+    {
+      Core::System::GetInstance().GetCommandProcessor().HandleUnknownOpcode(opcode, data, false);
+      m_cycles += 1;
+    }
+  }
+  // The FIFO isn't pipelined while it is being recorded.
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size)) {}
+
+  OPCODE_CALLBACK(CPState& GetCPState()) { return g_main_cp_state; }
+
+  OPCODE_CALLBACK(u32 GetVertexSize(u8 vat))
+  {
+    return VertexLoaderManager::RefreshLoader(vat)->m_vertex_size;
+  }
+
+  u32 m_cycles = 0;
+
+private:
+  VideoCommon::CommandStream& m_stream;
+  bool m_use_geometry_cache;
+  bool m_in_display_list = false;
+};
+
+u8* DecodeFifo(DataReader src, u32* cycles, VideoCommon::CommandStream& stream,
+               bool use_geometry_cache)
+{
+  VideoCommon::ScopedGPUStageTimer decode_timer(VideoCommon::GPUStage::OpcodeDecode);
+
+  auto callback = DecodeCallback{stream, use_geometry_cache};
+  u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
+
+  if (cycles != nullptr)
+    *cycles = callback.m_cycles;
+
+  src.Skip(size);
+  return src.GetPointer();
+}
+
+void ReplayCommands(const VideoCommon::CommandStream& stream)
+{
+  using Type = VideoCommon::CommandStream::Type;
+
+  RunCallback<false> callback;
+  for (const VideoCommon::CommandStream::Command& command : stream.GetCommands())
+  {
+    switch (command.type)
+    {
+    case Type::LoadCP:
+      callback.OnCP(command.reg, command.value);
+      break;
+    case Type::LoadBP:
+      LoadBPReg(command.reg, command.value, command.cycles);
+      INCSTAT(g_stats.this_frame.num_bp_loads);
+      break;
+    case Type::LoadXF:
+      callback.OnXF(command.address, command.size, stream.GetData(command));
+      break;
+    case Type::LoadIndexedXF:
+      LoadIndexedXF(command.address, command.size, stream.GetData(command));
+      break;
+    case Type::Draw:
+    {
+      const VideoCommon::LoadedDraw& draw = stream.GetDraw(command);
+      VertexLoaderManager::SubmitLoadedVertices(draw, stream.GetVertexData(draw));
+      break;
+    }
+    }
+  }
+}
+
 }  // namespace OpcodeDecoder
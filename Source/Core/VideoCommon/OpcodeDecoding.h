@@ -16,6 +16,11 @@
 struct CPState;
 class DataReader;
 
+namespace VideoCommon
+{
+class CommandStream;
+}
+
 namespace OpcodeDecoder
 {
 // Global flag to signal if FifoRecorder is active.
@@ -281,6 +286,13 @@ DOLPHIN_FORCE_INLINE u32 Run(const u8* data, u32 available,
 template <bool is_preprocess = false>
 u8* RunFifo(DataReader src, u32* cycles);
 
+// Pipelined GPU thread: DecodeFifo runs on the decode thread instead of RunFifo. It applies CP
+// state and loads vertices itself, and records BP/XF loads and draws in stream for ReplayCommands,
+// which applies them on the GPU thread.
+u8* DecodeFifo(DataReader src, u32* cycles, VideoCommon::CommandStream& stream,
+               bool use_geometry_cache);
+void ReplayCommands(const VideoCommon::CommandStream& stream);
+
 }  // namespace OpcodeDecoder
 
 template <>
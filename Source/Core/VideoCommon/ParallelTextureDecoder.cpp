@@ -0,0 +1,116 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/ParallelTextureDecoder.h"
+
+#include <algorithm>
+
+namespace VideoCommon
+{
+// Small enough to balance the work between the threads, large enough that fetching the next band
+// doesn't matter. This is 16 rows of a 1024 texels wide texture.
+static constexpr int BAND_TEXELS = 16 * 1024;
+
+ParallelTextureDecoder::ParallelTextureDecoder() = default;
+
+ParallelTextureDecoder::~ParallelTextureDecoder() = default;
+
+void ParallelTextureDecoder::SetNumWorkerThreads(u32 num_threads)
+{
+  if (num_threads == m_num_worker_threads)
+    return;
+
+  m_workers.clear();
+  m_num_worker_threads = num_threads;
+}
+
+void ParallelTextureDecoder::Decode(std::span<const Level> levels, TextureFormat format,
+                                    const u8* tlut, TLUTFormat tlut_format)
+{
+  int total_texels = 0;
+  for (const Level& level : levels)
+    total_texels += level.width * level.height;
+
+  if (m_num_worker_threads == 0 || total_texels < MIN_PARALLEL_TEXELS)
+  {
+    for (const Level& level : levels)
+      TexDecoder_Decode(level.dst, level.src, level.width, level.height, format, tlut, tlut_format);
+    return;
+  }
+
+  if (m_workers.empty())
+    StartWorkerThreads();
+
+  m_bands.clear();
+  for (const Level& level : levels)
+    SplitIntoBands(level, format);
+  m_format = format;
+  m_tlut = tlut;
+  m_tlut_format = tlut_format;
+  m_next_band.store(0, std::memory_order_relaxed);
+
+  // Don't wake up threads that would have no band left to decode.
+  const u32 num_bands = static_cast<u32>(m_bands.size());
+  const u32 num_workers = std::min<u32>(static_cast<u32>(m_workers.size()), num_bands - 1);
+  m_busy_workers.store(num_workers, std::memory_order_relaxed);
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers[i]->Push(i + 1);
+
+  DecodeBands();
+
+  // The workers may still be writing their last band.
+  if (num_workers != 0)
+    m_workers_done.Wait();
+
+  // The overlay spans several bands, so it can only be drawn once the whole level is decoded.
+  for (const Level& level : levels)
+    TexDecoder_DrawOverlay(level.dst, level.width, level.height, format);
+}
+
+void ParallelTextureDecoder::SplitIntoBands(const Level& level, TextureFormat format)
+{
+  // Rows of blocks are stored one after another in both the source and the decoded texture, so a
+  // band starting at a block row is decoded like a texture of its own.
+  const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+  const int band_height =
+      std::max(block_height, BAND_TEXELS / level.width / block_height * block_height);
+
+  for (int y = 0; y < level.height; y += band_height)
+  {
+    m_bands.push_back({
+        .dst = reinterpret_cast<u32*>(level.dst) + y * level.width,
+        .src = level.src + TexDecoder_GetTextureSizeInBytes(level.width, y, format),
+        .width = level.width,
+        .height = std::min(band_height, level.height - y),
+    });
+  }
+}
+
+void ParallelTextureDecoder::StartWorkerThreads()
+{
+  for (u32 i = 0; i < m_num_worker_threads; ++i)
+  {
+    m_workers.push_back(std::make_unique<Common::WorkQueueThreadSP<u32>>(
+        "Texture Decode Worker", [this](u32) {
+          DecodeBands();
+          if (m_busy_workers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            m_workers_done.Set();
+        }));
+  }
+}
+
+void ParallelTextureDecoder::DecodeBands()
+{
+  const u32 num_bands = static_cast<u32>(m_bands.size());
+  while (true)
+  {
+    const u32 index = m_next_band.fetch_add(1, std::memory_order_relaxed);
+    if (index >= num_bands)
+      break;
+
+    const Band& band = m_bands[index];
+    _TexDecoder_DecodeImpl(band.dst, band.src, band.width, band.height, m_format, m_tlut,
+                           m_tlut_format);
+  }
+}
+}  // namespace VideoCommon
@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/WorkQueueThread.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace VideoCommon
+{
+// Decodes large textures and their mip chains on worker threads. The levels are split into bands
+// of whole block rows, which are independent textures of the same width, and the calling thread
+// decodes bands together with the workers. Small textures are decoded on the calling thread only,
+// as waking up the workers would take longer than decoding them.
+class ParallelTextureDecoder
+{
+public:
+  // A texture level to decode. The width and height must be expanded to whole blocks.
+  struct Level
+  {
+    u8* dst;
+    const u8* src;
+    int width;
+    int height;
+  };
+
+  // Textures with fewer texels than this, summed over all levels, are decoded on one thread.
+  static constexpr int MIN_PARALLEL_TEXELS = 256 * 512;
+
+  ParallelTextureDecoder();
+  ~ParallelTextureDecoder();
+
+  // 0 decodes everything on the calling thread. The threads are started on first use.
+  void SetNumWorkerThreads(u32 num_threads);
+
+  // Same as calling TexDecoder_Decode on every level.
+  void Decode(std::span<const Level> levels, TextureFormat format, const u8* tlut,
+              TLUTFormat tlut_format);
+
+private:
+  struct Band
+  {
+    u32* dst;
+    const u8* src;
+    int width;
+    int height;
+  };
+
+  void SplitIntoBands(const Level& level, TextureFormat format);
+  void StartWorkerThreads();
+  void DecodeBands();
+
+  u32 m_num_worker_threads = 0;
+
+  // The job that is currently being decoded
+  std::vector<Band> m_bands;
+  TextureFormat m_format{};
+  const u8* m_tlut = nullptr;
+  TLUTFormat m_tlut_format{};
+
+  std::atomic<u32> m_next_band = 0;
+  std::atomic<u32> m_busy_workers = 0;
+  Common::Event m_workers_done;
+  // Declared last so the threads are stopped before anything they use is destroyed
+  std::vector<std::unique_ptr<Common::WorkQueueThreadSP<u32>>> m_workers;
+};
+}  // namespace VideoCommon
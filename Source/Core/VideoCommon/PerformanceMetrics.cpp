@@ -4,11 +4,20 @@
 #include "VideoCommon/PerformanceMetrics.h"
 
 #include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <string>
 
+#include <fmt/chrono.h>
+#include <fmt/format.h>
 #include <imgui.h>
 #include <implot.h>
+#include <picojson.h>
 
+#include "Common/FileUtil.h"
+#include "Common/TimeUtil.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/ConfigManager.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
@@ -23,6 +32,17 @@ void PerformanceMetrics::Reset()
 
   m_speed = 0;
   m_max_speed = 0;
+
+  m_shader_compile_stalls = {};
+  m_texture_decode_stalls = {};
+  m_present_latency_histogram = {};
+  m_snapshot_time = {};
+
+  // Every session starts a new log.
+  m_metrics_log_file.close();
+
+  std::lock_guard lk(m_snapshot_mutex);
+  m_snapshot = {};
 }
 
 void PerformanceMetrics::CountFrame()
@@ -35,10 +55,14 @@ void PerformanceMetrics::CountVBlank()
   m_vps_counter.Count();
 }
 
-void PerformanceMetrics::OnEmulationStateChanged([[maybe_unused]] Core::State state)
+void PerformanceMetrics::OnEmulationStateChanged(Core::State state)
 {
   m_fps_counter.InvalidateLastTime();
   m_vps_counter.InvalidateLastTime();
+
+  // The GPU thread has stopped by the time emulation is uninitialized.
+  if (state == Core::State::Uninitialized)
+    m_metrics_log_file.close();
 }
 
 void PerformanceMetrics::CountThrottleSleep(DT sleep)
@@ -78,6 +102,91 @@ void PerformanceMetrics::CountPerformanceMarker(s64 core_ticks, u32 ticks_per_se
   m_max_speed.store(elapsed_core_time / (work_time - oldest.work_time), std::memory_order_relaxed);
 }
 
+std::size_t PerformanceMetrics::GetPresentLatencyBucket(DT latency)
+{
+  const auto bucket = std::ranges::lower_bound(PRESENT_LATENCY_BUCKETS_MS, DT_ms(latency).count());
+  return bucket - PRESENT_LATENCY_BUCKETS_MS.begin();
+}
+
+void PerformanceMetrics::CountPresentLatency(DT latency)
+{
+  ++m_present_latency_histogram[GetPresentLatencyBucket(latency)];
+}
+
+void PerformanceMetrics::CountShaderCompileStall(DT duration)
+{
+  ++m_shader_compile_stalls.count;
+  m_shader_compile_stalls.time += duration;
+}
+
+void PerformanceMetrics::CountTextureDecodeStall(DT duration)
+{
+  ++m_texture_decode_stalls.count;
+  m_texture_decode_stalls.time += duration;
+}
+
+void PerformanceMetrics::UpdateStats()
+{
+  m_vps_counter.UpdateStats();
+  m_fps_counter.UpdateStats();
+
+  const TimePoint now = Clock::now();
+  if (m_snapshot_time == TimePoint{})
+  {
+    m_snapshot_time = now;
+    return;
+  }
+
+  const DT_s elapsed = now - m_snapshot_time;
+  if (elapsed < std::chrono::seconds(1))
+    return;
+
+  const double seconds = elapsed.count();
+  const Snapshot snapshot{
+      .unix_time = static_cast<s64>(std::time(nullptr)),
+      .fps = GetFPS(),
+      .vps = GetVPS(),
+      .speed = GetSpeed(),
+      .max_speed = GetMaxSpeed(),
+      .frame_times = m_fps_counter.GetDtPercentiles(),
+      .vblank_times = m_vps_counter.GetDtPercentiles(),
+      .present_latency_histogram = m_present_latency_histogram,
+      .shader_compile_stalls_per_second = m_shader_compile_stalls.count / seconds,
+      .shader_compile_stall_ms_per_second = DT_ms(m_shader_compile_stalls.time).count() / seconds,
+      .texture_decode_stalls_per_second = m_texture_decode_stalls.count / seconds,
+      .texture_decode_stall_ms_per_second = DT_ms(m_texture_decode_stalls.time).count() / seconds,
+  };
+
+  m_shader_compile_stalls = {};
+  m_texture_decode_stalls = {};
+  m_present_latency_histogram = {};
+  m_snapshot_time = now;
+
+  {
+    std::lock_guard lk(m_snapshot_mutex);
+    m_snapshot = snapshot;
+  }
+
+  if (!g_ActiveConfig.bLogPerformanceMetricsToFile)
+    return;
+
+  if (!m_metrics_log_file.is_open())
+  {
+    // Every session gets its own log. Appending keeps the log of an earlier session that started
+    // in the same second.
+    std::string path = File::GetUserPath(D_LOGS_IDX) + "performance_metrics";
+    if (const auto local_time = Common::LocalTime(static_cast<std::time_t>(snapshot.unix_time)))
+    {
+      path += fmt::format("_{}_{:%Y-%m-%d_%H-%M-%S}", SConfig::GetInstance().GetGameID(),
+                          *local_time);
+    }
+    File::OpenFStream(m_metrics_log_file, path + ".json", std::ios_base::out | std::ios_base::app);
+  }
+
+  // One JSON object per line, so that the file can be read while it's being written.
+  m_metrics_log_file << SnapshotToJSON(snapshot) << std::endl;
+}
+
 double PerformanceMetrics::GetFPS() const
 {
   return m_fps_counter.GetHzAvg();
@@ -98,6 +207,52 @@ double PerformanceMetrics::GetMaxSpeed() const
   return m_max_speed.load(std::memory_order_relaxed);
 }
 
+PerformanceMetrics::Snapshot PerformanceMetrics::GetSnapshot() const
+{
+  std::lock_guard lk(m_snapshot_mutex);
+  return m_snapshot;
+}
+
+std::string PerformanceMetrics::SnapshotToJSON(const Snapshot& snapshot)
+{
+  const auto percentiles_to_json = [](const PerformanceTracker::DtPercentiles& percentiles) {
+    picojson::object json;
+    json["p50"] = picojson::value(DT_ms(percentiles.p50).count());
+    json["p95"] = picojson::value(DT_ms(percentiles.p95).count());
+    json["p99"] = picojson::value(DT_ms(percentiles.p99).count());
+    return picojson::value(json);
+  };
+
+  picojson::array latency_bounds;
+  for (const double bound : PRESENT_LATENCY_BUCKETS_MS)
+    latency_bounds.emplace_back(bound);
+  picojson::array latency_counts;
+  for (const u64 count : snapshot.present_latency_histogram)
+    latency_counts.emplace_back(static_cast<double>(count));
+  picojson::object latency;
+  latency["bucket_upper_bounds_ms"] = picojson::value(latency_bounds);
+  latency["counts"] = picojson::value(latency_counts);
+
+  picojson::object json;
+  json["unix_time"] = picojson::value(static_cast<double>(snapshot.unix_time));
+  json["fps"] = picojson::value(snapshot.fps);
+  json["vps"] = picojson::value(snapshot.vps);
+  json["speed"] = picojson::value(snapshot.speed);
+  json["max_speed"] = picojson::value(snapshot.max_speed);
+  json["frame_time_ms"] = percentiles_to_json(snapshot.frame_times);
+  json["vblank_time_ms"] = percentiles_to_json(snapshot.vblank_times);
+  json["vi_to_present_latency"] = picojson::value(latency);
+  json["shader_compile_stalls_per_second"] =
+      picojson::value(snapshot.shader_compile_stalls_per_second);
+  json["shader_compile_stall_ms_per_second"] =
+      picojson::value(snapshot.shader_compile_stall_ms_per_second);
+  json["texture_decode_stalls_per_second"] =
+      picojson::value(snapshot.texture_decode_stalls_per_second);
+  json["texture_decode_stall_ms_per_second"] =
+      picojson::value(snapshot.texture_decode_stall_ms_per_second);
+  return picojson::value(json).serialize();
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   m_vps_counter.UpdateStats();
@@ -293,6 +448,8 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
                            DT_ms(m_fps_counter.GetDtAvg()).count());
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), " ±:%6.2lfms",
                            DT_ms(m_fps_counter.GetDtStd()).count());
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "99%%:%5.2lfms",
+                           DT_ms(GetSnapshot().frame_times.p99).count());
       }
     }
     ImGui::End();
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
 
 #include "Common/CommonTypes.h"
 #include "Core/Core.h"
@@ -26,6 +30,31 @@ public:
   PerformanceMetrics(PerformanceMetrics&&) = delete;
   PerformanceMetrics& operator=(PerformanceMetrics&&) = delete;
 
+  // Upper bounds of the VI-to-present latency histogram buckets in milliseconds. The last bucket
+  // counts the presents that took longer than the last bound.
+  static constexpr std::array<double, 7> PRESENT_LATENCY_BUCKETS_MS = {2, 4, 8, 16, 33, 50, 100};
+  static constexpr std::size_t NUM_PRESENT_LATENCY_BUCKETS = PRESENT_LATENCY_BUCKETS_MS.size() + 1;
+
+  // Returns the index of the histogram bucket that counts the given latency.
+  static std::size_t GetPresentLatencyBucket(DT latency);
+
+  // The metrics of the last second, updated by UpdateStats.
+  struct Snapshot
+  {
+    s64 unix_time = 0;
+    double fps = 0;
+    double vps = 0;
+    double speed = 0;
+    double max_speed = 0;
+    PerformanceTracker::DtPercentiles frame_times;
+    PerformanceTracker::DtPercentiles vblank_times;
+    std::array<u64, NUM_PRESENT_LATENCY_BUCKETS> present_latency_histogram{};
+    double shader_compile_stalls_per_second = 0;
+    double shader_compile_stall_ms_per_second = 0;
+    double texture_decode_stalls_per_second = 0;
+    double texture_decode_stall_ms_per_second = 0;
+  };
+
   void Reset();
 
   void CountFrame();
@@ -37,11 +66,21 @@ public:
   void AdjustClockSpeed(s64 ticks, u32 new_ppc_clock, u32 old_ppc_clock);
   void CountPerformanceMarker(s64 ticks, u32 ticks_per_second);
 
+  // Call from GPU thread.
+  void CountPresentLatency(DT latency);
+  void CountShaderCompileStall(DT duration);
+  void CountTextureDecodeStall(DT duration);
+  // Called after every present, including when headless. Takes a new snapshot every second and
+  // writes it to the metrics log if it's enabled.
+  void UpdateStats();
+
   // Getter Functions. May be called from any thread.
   double GetFPS() const;
   double GetVPS() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
+  Snapshot GetSnapshot() const;
+  static std::string SnapshotToJSON(const Snapshot& snapshot);
 
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
@@ -64,6 +103,23 @@ private:
 
   std::deque<PerfSample> m_samples;
   DT m_time_sleeping{};
+
+  struct StallCounter
+  {
+    u64 count = 0;
+    DT time{};
+  };
+
+  // Counted since the last snapshot.
+  StallCounter m_shader_compile_stalls;
+  StallCounter m_texture_decode_stalls;
+  std::array<u64, NUM_PRESENT_LATENCY_BUCKETS> m_present_latency_histogram{};
+  TimePoint m_snapshot_time{};
+
+  mutable std::mutex m_snapshot_mutex;
+  Snapshot m_snapshot;
+
+  std::ofstream m_metrics_log_file;
 };
 
 extern PerformanceMetrics g_perf_metrics;
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iomanip>
+#include <vector>
 
 #include <implot.h>
 
@@ -172,6 +173,25 @@ void PerformanceTracker::ImPlotPlotLines(const char* label) const
   ImPlot::PlotLine(label, x.data(), y.data(), static_cast<int>(point_index));
 }
 
+PerformanceTracker::DtPercentiles PerformanceTracker::GetDtPercentiles() const
+{
+  return CalculateDtPercentiles(std::vector<DT>(m_dt_queue.begin(), m_dt_queue.end()));
+}
+
+PerformanceTracker::DtPercentiles PerformanceTracker::CalculateDtPercentiles(std::vector<DT> dts)
+{
+  if (dts.empty())
+    return {};
+
+  const auto get_percentile = [&](double percentile) {
+    const auto it = dts.begin() + static_cast<std::ptrdiff_t>((dts.size() - 1) * percentile);
+    std::nth_element(dts.begin(), it, dts.end());
+    return *it;
+  };
+
+  return {.p50 = get_percentile(0.50), .p95 = get_percentile(0.95), .p99 = get_percentile(0.99)};
+}
+
 void PerformanceTracker::PushFront(DT value)
 {
   m_dt_queue.push_front(value);
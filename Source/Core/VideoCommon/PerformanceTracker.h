@@ -7,6 +7,7 @@
 #include <deque>
 #include <fstream>
 #include <optional>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/SPSCQueue.h"
@@ -14,6 +15,13 @@
 class PerformanceTracker
 {
 public:
+  struct DtPercentiles
+  {
+    DT p50 = DT::zero();
+    DT p95 = DT::zero();
+    DT p99 = DT::zero();
+  };
+
   PerformanceTracker(const std::optional<std::string> log_name = std::nullopt,
                      const std::optional<DT> sample_window_duration = std::nullopt);
   ~PerformanceTracker() = default;
@@ -29,6 +37,10 @@ public:
   // UpdateStats is expected to be called regularly to empty the SPSC queue.
   void UpdateStats();
   void ImPlotPlotLines(const char* label) const;
+  DtPercentiles GetDtPercentiles() const;
+
+  // Uses the nearest-rank method, rounding the rank down.
+  static DtPercentiles CalculateDtPercentiles(std::vector<DT> dts);
 
   // May call from any thread, but not concurrently, not that you'd want to..
   void Count();
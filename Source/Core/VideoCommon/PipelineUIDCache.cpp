@@ -0,0 +1,153 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+
+#include "Common/IOFile.h"
+
+namespace VideoCommon
+{
+namespace
+{
+// The serialized UIDs have no padding and are zeroed before they are filled in, so comparing the
+// bytes is enough.
+struct SerializedUidLess
+{
+  bool operator()(const SerializedGXPipelineUid& lhs, const SerializedGXPipelineUid& rhs) const
+  {
+    return std::memcmp(&lhs, &rhs, sizeof(SerializedGXPipelineUid)) < 0;
+  }
+};
+
+template <typename T>
+std::optional<PipelineUIDCacheError> ReadRecords(const std::string& path, u32 expected_magic,
+                                                 std::vector<T>* records)
+{
+  File::IOFile file(path, "rb");
+  if (!file.IsOpen())
+    return PipelineUIDCacheError::OpenFailed;
+
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)))
+    return PipelineUIDCacheError::Truncated;
+  if (magic != expected_magic)
+    return PipelineUIDCacheError::WrongMagic;
+  if (version != GX_PIPELINE_UID_VERSION)
+    return PipelineUIDCacheError::WrongVersion;
+
+  const u64 data_size = file.GetSize() - PIPELINE_UID_CACHE_HEADER_SIZE;
+  if (data_size % sizeof(T) != 0)
+    return PipelineUIDCacheError::Truncated;
+
+  records->resize(static_cast<size_t>(data_size / sizeof(T)));
+  if (!file.ReadArray(records->data(), records->size()))
+  {
+    records->clear();
+    return PipelineUIDCacheError::Truncated;
+  }
+
+  return std::nullopt;
+}
+
+template <typename T>
+bool WriteRecords(const std::string& path, u32 magic, std::span<const T> records)
+{
+  File::IOFile file(path, "wb");
+  return file.WriteBytes(&magic, sizeof(magic)) &&
+         file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION)) &&
+         file.WriteArray(records.data(), records.size());
+}
+}  // namespace
+
+std::string_view GetPipelineUIDCacheErrorString(PipelineUIDCacheError error)
+{
+  switch (error)
+  {
+  case PipelineUIDCacheError::OpenFailed:
+    return "could not be opened";
+  case PipelineUIDCacheError::WrongMagic:
+    return "is not a pipeline UID file";
+  case PipelineUIDCacheError::WrongVersion:
+    return "was written by a different version of Dolphin";
+  case PipelineUIDCacheError::Truncated:
+    return "is truncated or corrupted";
+  }
+  return "is invalid";
+}
+
+std::string GetPipelineUsageFilePath(std::string_view uid_cache_path)
+{
+  if (uid_cache_path.ends_with(PIPELINE_UID_CACHE_EXTENSION))
+    uid_cache_path.remove_suffix(PIPELINE_UID_CACHE_EXTENSION.size());
+  return std::string(uid_cache_path) + std::string(PIPELINE_USAGE_FILE_EXTENSION);
+}
+
+PipelineUIDCacheReadResult ReadPipelineUIDCacheFile(const std::string& path)
+{
+  PipelineUIDCacheReadResult result;
+  result.error = ReadRecords(path, PIPELINE_UID_CACHE_MAGIC, &result.uids);
+  return result;
+}
+
+bool WritePipelineUIDCacheFile(const std::string& path,
+                               std::span<const SerializedGXPipelineUid> uids)
+{
+  return WriteRecords(path, PIPELINE_UID_CACHE_MAGIC, uids);
+}
+
+PipelineUsageReadResult ReadPipelineUsageFile(const std::string& path)
+{
+  PipelineUsageReadResult result;
+  result.error = ReadRecords(path, PIPELINE_USAGE_FILE_MAGIC, &result.usages);
+  return result;
+}
+
+bool WritePipelineUsageFile(const std::string& path,
+                            std::span<const SerializedGXPipelineUsage> usages)
+{
+  return WriteRecords(path, PIPELINE_USAGE_FILE_MAGIC, usages);
+}
+
+void MergePipelineUIDs(std::vector<SerializedGXPipelineUid>* uids,
+                       std::span<const SerializedGXPipelineUid> other)
+{
+  std::set<SerializedGXPipelineUid, SerializedUidLess> seen(uids->begin(), uids->end());
+  for (const SerializedGXPipelineUid& uid : other)
+  {
+    if (seen.insert(uid).second)
+      uids->push_back(uid);
+  }
+}
+
+void MergePipelineUsage(std::vector<SerializedGXPipelineUsage>* usages,
+                        std::span<const SerializedGXPipelineUsage> other)
+{
+  std::map<SerializedGXPipelineUid, size_t, SerializedUidLess> indices;
+  for (size_t i = 0; i < usages->size(); ++i)
+    indices.emplace((*usages)[i].uid, i);
+
+  for (const SerializedGXPipelineUsage& usage : other)
+  {
+    const auto [it, inserted] = indices.emplace(usage.uid, usages->size());
+    if (inserted)
+    {
+      usages->push_back(usage);
+      continue;
+    }
+
+    // A first use of 0 means the pipeline was never used.
+    SerializedGXPipelineUsage& merged = (*usages)[it->second];
+    if (merged.earliest_first_use == 0)
+      merged.earliest_first_use = usage.earliest_first_use;
+    else if (usage.earliest_first_use != 0)
+      merged.earliest_first_use = std::min(merged.earliest_first_use, usage.earliest_first_use);
+    merged.num_sessions_used += usage.num_sessions_used;
+  }
+}
+}  // namespace VideoCommon
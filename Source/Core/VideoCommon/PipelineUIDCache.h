@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+// Reading and writing of the per-game pipeline UID files in the cache directory, shared by the
+// shader cache and DolphinTool. Both files start with a magic and GX_PIPELINE_UID_VERSION, and
+// contain little-endian packed records, so they can be copied between machines.
+namespace VideoCommon
+{
+constexpr u32 PIPELINE_UID_CACHE_MAGIC = 0x44495550;   // PUID
+constexpr u32 PIPELINE_USAGE_FILE_MAGIC = 0x45535550;  // PUSE
+constexpr size_t PIPELINE_UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+constexpr std::string_view PIPELINE_UID_CACHE_EXTENSION = ".uidcache";
+constexpr std::string_view PIPELINE_USAGE_FILE_EXTENSION = ".uidusage";
+
+enum class PipelineUIDCacheError
+{
+  OpenFailed,
+  WrongMagic,
+  // Written by a version of Dolphin with different UID structures. Compiling these UIDs would
+  // produce the wrong shaders.
+  WrongVersion,
+  Truncated,
+};
+
+std::string_view GetPipelineUIDCacheErrorString(PipelineUIDCacheError error);
+
+// The usage file that belongs to a UID cache, e.g. GALE01.uidusage for GALE01.uidcache.
+std::string GetPipelineUsageFilePath(std::string_view uid_cache_path);
+
+struct PipelineUIDCacheReadResult
+{
+  std::vector<SerializedGXPipelineUid> uids;
+  std::optional<PipelineUIDCacheError> error;
+};
+
+struct PipelineUsageReadResult
+{
+  std::vector<SerializedGXPipelineUsage> usages;
+  std::optional<PipelineUIDCacheError> error;
+};
+
+// Reads a whole <GameID>.uidcache file. Nothing is returned for files that fail validation.
+PipelineUIDCacheReadResult ReadPipelineUIDCacheFile(const std::string& path);
+bool WritePipelineUIDCacheFile(const std::string& path,
+                               std::span<const SerializedGXPipelineUid> uids);
+
+// Reads a whole <GameID>.uidusage file. Nothing is returned for files that fail validation.
+PipelineUsageReadResult ReadPipelineUsageFile(const std::string& path);
+bool WritePipelineUsageFile(const std::string& path,
+                            std::span<const SerializedGXPipelineUsage> usages);
+
+// Appends the UIDs of other that aren't in uids yet, keeping the order in which they were first
+// seen. Duplicates within other are dropped too.
+void MergePipelineUIDs(std::vector<SerializedGXPipelineUid>* uids,
+                       std::span<const SerializedGXPipelineUid> other);
+
+// Combines the usage of the same pipelines recorded on different machines: the sessions are added
+// up and the earliest first use is kept.
+void MergePipelineUsage(std::vector<SerializedGXPipelineUsage>* usages,
+                        std::span<const SerializedGXPipelineUsage> other);
+}  // namespace VideoCommon
@@ -326,8 +326,8 @@ void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& hos
   uid_data->bounding_box &= host_config.bounding_box && host_config.backend_bbox;
 }
 
-void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
-                                  const ShaderHostConfig& host_config, bool bounding_box)
+void GeneratePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
+                                     const ShaderHostConfig& host_config, bool bounding_box)
 {
   // dot product for integer vectors
   out.Write("int idot(int3 x, int3 y)\n"
@@ -400,11 +400,11 @@ void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
 
   if (host_config.per_pixel_lighting)
   {
-    out.Write("{}", s_lighting_struct);
+    out.Append(s_lighting_struct);
 
     out.Write("UBO_BINDING(std140, 2) uniform VSBlock {{\n");
 
-    out.Write("{}", s_shader_uniforms);
+    out.Append(s_shader_uniforms);
     out.Write("}};\n");
   }
 
@@ -734,6 +734,31 @@ uint WrapCoord(int coord, uint wrap, int size) {{
   }
 }
 
+void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
+                                  const ShaderHostConfig& host_config, bool bounding_box)
+{
+  // The header is the same for all shaders of a configuration, and larger than most of their
+  // bodies.
+  struct HeaderKey
+  {
+    APIType api_type;
+    u32 host_config_bits;
+    bool bounding_box;
+    bool supports_texture_query_levels;
+    bool supports_coarse_derivatives;
+
+    auto operator<=>(const HeaderKey&) const = default;
+  };
+  static PrerenderedShaderCode<HeaderKey> s_headers;
+
+  const HeaderKey key{api_type, host_config.bits, bounding_box,
+                      g_backend_info.bSupportsTextureQueryLevels,
+                      g_backend_info.bSupportsCoarseDerivatives};
+  s_headers.Write(out, key, [&](ShaderCode& code) {
+    GeneratePixelShaderCommonHeader(code, api_type, host_config, bounding_box);
+  });
+}
+
 static void WriteStage(ShaderCode& out, const pixel_shader_uid_data* uid_data, int n,
                        APIType api_type, bool stereo);
 static void WriteTevRegular(ShaderCode& out, std::string_view components, TevBias bias, TevOp op,
@@ -169,6 +169,9 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
                                    CustomPixelContents custom_contents);
 void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
                                   const ShaderHostConfig& host_config, bool bounding_box);
+// Generates the header instead of copying the one WritePixelShaderCommonHeader pre-rendered.
+void GeneratePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
+                                     const ShaderHostConfig& host_config, bool bounding_box);
 void WriteFragmentBody(APIType api_type, const ShaderHostConfig& host_config,
                        const pixel_shader_uid_data* uid_data, ShaderCode& out);
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
@@ -36,7 +36,7 @@ public:
   virtual ~Presenter();
 
   void ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks,
-              TimePoint presentation_time);
+              TimePoint presentation_time, TimePoint vi_time);
   void ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
 
   void Present(std::optional<TimePoint> presentation_time = std::nullopt);
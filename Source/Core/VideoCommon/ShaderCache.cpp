@@ -3,6 +3,10 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
@@ -15,7 +19,11 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/PipelineUIDCache.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Spirv.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -60,11 +68,17 @@ void ShaderCache::InitializeShaderCache()
   {
     LoadCaches();
     LoadPipelineUIDCache();
+    LoadPipelineUsage();
+    SPIRV::TrimDiskCache(SPIRV::GetDiskCacheDirectory(), SPIRV::MAX_DISK_CACHE_SIZE);
   }
 
   // Queue ubershader precompiling if required.
   if (g_ActiveConfig.UsingUberShaders())
+  {
     QueueUberShaderPipelines();
+    if (m_host_config.specialized_ubershaders)
+      QueueSpecializedUberShaderPipelines();
+  }
 
   // Compile all known UIDs.
   CompileMissingPipelines();
@@ -77,6 +91,9 @@ void ShaderCache::InitializeShaderCache()
 
 void ShaderCache::Reload()
 {
+  // The pending work was queued for the old configuration. Only the work that is already
+  // compiling is waited for, and its results are dropped along with the caches.
+  m_async_shader_compiler->CancelPendingWork();
   WaitForAsyncCompiler();
   ClosePipelineUIDCache();
   ClearCaches();
@@ -102,6 +119,29 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+
+  const AsyncShaderCompiler::Statistics compiler_stats = m_async_shader_compiler->GetStatistics();
+  SETSTAT(g_stats.num_async_compiles_pending,
+          compiler_stats.pending_items + compiler_stats.busy_workers);
+  SETSTAT(g_stats.num_async_compiles_expired, compiler_stats.expired_items);
+  SETSTAT(g_stats.num_async_compiles_wasted,
+          compiler_stats.cancelled_items + compiler_stats.wasted_items);
+  g_stats.async_compile_latency_ms = {compiler_stats.latency_p50_ms, compiler_stats.latency_p90_ms,
+                                      compiler_stats.latency_p99_ms};
+
+  // The SPIR-V is compiled on the worker threads, which can't update the statistics themselves.
+  const SPIRV::DiskCacheStatistics spirv_cache_stats = SPIRV::GetDiskCacheStatistics();
+  SETSTAT(g_stats.num_spirv_cache_hits, spirv_cache_stats.hits);
+  SETSTAT(g_stats.num_spirv_cache_misses, spirv_cache_stats.misses);
+
+  if (m_num_precompile_pipelines == 0)
+    return;
+
+  OSD::AddTypedMessage(OSD::MessageType::ShaderPrecompilation,
+                       fmt::format("Compiling shaders: {}/{}", m_num_precompiled_pipelines,
+                                   m_num_precompile_pipelines));
+  if (m_num_precompiled_pipelines >= m_num_precompile_pipelines)
+    m_num_precompile_pipelines = 0;
 }
 
 void ShaderCache::Shutdown()
@@ -117,16 +157,22 @@ void ShaderCache::Shutdown()
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
   auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_pipeline_cache.end() && !it->second.pending)
+  {
+    RecordGXPipelineUse(it->second);
+    return it->second.pipeline.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  const TimePoint compile_start = Clock::now();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  g_perf_metrics.CountShaderCompileStall(Clock::now() - compile_start);
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
+  RecordGXPipelineUse(m_gx_pipeline_cache[uid]);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
@@ -135,31 +181,58 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
-    // .second is the pending flag, i.e. compiling in the background.
-    if (!it->second.second)
-      return it->second.first.get();
+    RecordGXPipelineUse(it->second);
+    if (!it->second.pending)
+      return it->second.pipeline.get();
     else
       return {};
   }
 
   AppendGXPipelineUID(uid);
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  RecordGXPipelineUse(m_gx_pipeline_cache[uid]);
   return {};
 }
 
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
   auto it = m_gx_uber_pipeline_cache.find(uid);
-  if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_uber_pipeline_cache.end() && !it->second.pending)
+    return it->second.pipeline.get();
 
+  const TimePoint compile_start = Clock::now();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  g_perf_metrics.CountShaderCompileStall(Clock::now() - compile_start);
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid,
+                                        const GXPipelineUid& specialized_uid)
+{
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    if (!it->second.pending)
+      return it->second.pipeline.get();
+    else
+      return {};
+  }
+
+  auto specialized_it = m_gx_pipeline_cache.find(specialized_uid);
+  if (specialized_it != m_gx_pipeline_cache.end() &&
+      (specialized_it->second.pending || specialized_it->second.pipeline))
+  {
+    return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE);
+  return {};
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   bool running = true;
@@ -306,8 +379,8 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
       }
 
       auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
+      entry.pipeline = std::move(pipeline);
+      entry.pending = false;
     }
 
   private:
@@ -344,8 +417,8 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   // Set the pending flag to false, and destroy the pipeline.
   for (auto& it : cache)
   {
-    it.second.first.reset();
-    it.second.second = false;
+    it.second.pipeline.reset();
+    it.second.pending = false;
   }
 }
 
@@ -375,6 +448,10 @@ void ShaderCache::LoadCaches()
   {
     LoadPipelineCache<GXPipelineUid, SerializedGXPipelineUid>(
         m_gx_pipeline_cache, m_gx_pipeline_disk_cache, m_api_type, "specialized-pipeline", true);
+    SETSTAT(g_stats.num_pipelines_loaded,
+            std::ranges::count_if(m_gx_pipeline_cache,
+                                  [](const auto& it) { return it.second.pipeline != nullptr; }));
+    SETSTAT(g_stats.num_pipelines_precompiled, g_stats.num_pipelines_loaded);
     LoadPipelineCache<GXUberPipelineUid, SerializedGXUberPipelineUid>(
         m_gx_uber_pipeline_cache, m_gx_uber_pipeline_disk_cache, m_api_type, "uber-pipeline",
         false);
@@ -413,20 +490,48 @@ void ShaderCache::ClearCaches()
   SETSTAT(g_stats.num_pixel_shaders_alive, 0);
   SETSTAT(g_stats.num_vertex_shaders_created, 0);
   SETSTAT(g_stats.num_vertex_shaders_alive, 0);
+  SETSTAT(g_stats.num_pipelines_precompiled, 0);
+  SETSTAT(g_stats.num_pipelines_loaded, 0);
 }
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
-  for (auto& it : m_gx_pipeline_cache)
+  // Queue all uids with a null pipeline for compilation. Specialized pipelines are compiled in the
+  // order they were first needed in earlier sessions, so the ones needed right after booting are
+  // ready first. Pipelines without usage information are compiled last.
+  using GXPipelineCacheIterator = decltype(m_gx_pipeline_cache)::const_iterator;
+  std::vector<GXPipelineCacheIterator> missing_pipelines;
+  for (auto it = m_gx_pipeline_cache.cbegin(); it != m_gx_pipeline_cache.cend(); ++it)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    if (!it->second.pipeline)
+      missing_pipelines.push_back(it);
   }
+  std::ranges::stable_sort(missing_pipelines, [](GXPipelineCacheIterator a,
+                                                 GXPipelineCacheIterator b) {
+    const PipelineCacheEntry& lhs = a->second;
+    const PipelineCacheEntry& rhs = b->second;
+    return std::tuple(lhs.earliest_first_use == 0, lhs.earliest_first_use, rhs.num_sessions_used) <
+           std::tuple(rhs.earliest_first_use == 0, rhs.earliest_first_use, lhs.num_sessions_used);
+  });
+
+  // Each pipeline gets its own priority, so that the shader stages it queues are compiled before
+  // the ones of the pipelines that follow it.
+  u32 priority = COMPILE_PRIORITY_SHADERCACHE_PIPELINE;
+  for (const GXPipelineCacheIterator it : missing_pipelines)
+    QueuePipelineCompile(it->first, priority++);
+  m_num_precompile_pipelines = static_cast<u32>(missing_pipelines.size());
+  m_num_precompiled_pipelines = 0;
+
   for (auto& it : m_gx_uber_pipeline_cache)
   {
-    if (!it.second.first)
-      QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
+    if (it.second.pipeline)
+      continue;
+
+    const bool specialized = it.first.vs_uid.GetUidData()->specialized ||
+                             it.first.ps_uid.GetUidData()->specialized;
+    QueueUberPipelineCompile(it.first, specialized ?
+                                           COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE :
+                                           COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   }
 }
 
@@ -870,14 +975,16 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
                                                       std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = false;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
+    if (entry.first_use == 0)
+      INCSTAT(g_stats.num_pipelines_precompiled);
 
     if (g_ActiveConfig.bShaderCache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXPipelineUid disk_uid;
@@ -888,7 +995,7 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 const AbstractPipeline*
@@ -896,14 +1003,14 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
                                   std::unique_ptr<AbstractPipeline> pipeline)
 {
   auto& entry = m_gx_uber_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = false;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
     if (g_ActiveConfig.bShaderCache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXUberPipelineUid disk_uid;
@@ -914,15 +1021,13 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  std::string filename = File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() +
+                         std::string(PIPELINE_UID_CACHE_EXTENSION);
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -931,15 +1036,16 @@ void ShaderCache::LoadPipelineUIDCache()
     bool uid_file_valid = false;
     if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
         m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+        existing_magic == PIPELINE_UID_CACHE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
     {
       // Ensure the expected size matches the actual size of the file. If it doesn't, it means
       // the cache file may be corrupted, and we should not proceed with loading potentially
       // garbage or invalid UIDs.
       const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
-      const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
+      const size_t uid_count = static_cast<size_t>(file_size - PIPELINE_UID_CACHE_HEADER_SIZE) /
+                               sizeof(SerializedGXPipelineUid);
+      const size_t expected_size =
+          uid_count * sizeof(SerializedGXPipelineUid) + PIPELINE_UID_CACHE_HEADER_SIZE;
       uid_file_valid = file_size == expected_size;
       if (uid_file_valid)
       {
@@ -975,7 +1081,8 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
+      m_gx_pipeline_uid_cache_file.WriteBytes(&PIPELINE_UID_CACHE_MAGIC,
+                                              sizeof(PIPELINE_UID_CACHE_MAGIC));
       m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
                                               sizeof(GX_PIPELINE_UID_VERSION));
 
@@ -992,10 +1099,86 @@ void ShaderCache::LoadPipelineUIDCache()
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  // The UID cache is only open once per session, so the usage is only counted once.
+  if (m_gx_pipeline_uid_cache_file.IsOpen())
+    SavePipelineUsage();
+
   m_gx_pipeline_uid_cache_file.Close();
 }
 
+static std::string GetPipelineUsageFileName()
+{
+  return File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() +
+         std::string(PIPELINE_USAGE_FILE_EXTENSION);
+}
+
+void ShaderCache::LoadPipelineUsage()
+{
+  const std::string filename = GetPipelineUsageFileName();
+  const auto [usages, error] = ReadPipelineUsageFile(filename);
+  if (error)
+  {
+    if (*error != PipelineUIDCacheError::OpenFailed)
+      WARN_LOG_FMT(VIDEO, "Ignoring {}: {}", filename, GetPipelineUIDCacheErrorString(*error));
+    return;
+  }
+
+  for (const SerializedGXPipelineUsage& usage : usages)
+  {
+    GXPipelineUid real_uid;
+    UnserializePipelineUid(usage.uid, real_uid);
+
+    // Pipelines that aren't in the UID cache yet are compiled too.
+    auto& entry = m_gx_pipeline_cache[real_uid];
+    entry.earliest_first_use = usage.earliest_first_use;
+    entry.num_sessions_used = usage.num_sessions_used;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read usage of {} pipelines from {}", usages.size(), filename);
+}
+
+void ShaderCache::SavePipelineUsage()
+{
+  std::vector<SerializedGXPipelineUsage> usages;
+  for (const auto& [uid, entry] : m_gx_pipeline_cache)
+  {
+    if (entry.first_use == 0 && entry.num_sessions_used == 0)
+      continue;
+
+    SerializedGXPipelineUsage& usage = usages.emplace_back();
+    SerializePipelineUid(uid, usage.uid);
+    if (entry.first_use == 0)
+    {
+      usage.earliest_first_use = entry.earliest_first_use;
+      usage.num_sessions_used = entry.num_sessions_used;
+    }
+    else
+    {
+      usage.earliest_first_use = entry.earliest_first_use == 0 ?
+                                     entry.first_use :
+                                     std::min(entry.earliest_first_use, entry.first_use);
+      usage.num_sessions_used = entry.num_sessions_used + 1;
+    }
+  }
+
+  const std::string filename = GetPipelineUsageFileName();
+  if (!WritePipelineUsageFile(filename, usages))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing pipeline usage to {} failed.", filename);
+  }
+}
+
+void ShaderCache::RecordGXPipelineUse(PipelineCacheEntry& entry)
+{
+  if (entry.first_use != 0)
+    return;
+
+  entry.first_use = ++m_num_used_gx_pipelines;
+  INCSTAT(g_stats.num_pipelines_used);
+  if (entry.pipeline)
+    INCSTAT(g_stats.num_precompiled_pipelines_used);
+}
+
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
@@ -1007,7 +1190,7 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  entry.pending = false;
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -1024,6 +1207,24 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   }
 }
 
+void ShaderCache::QueueCompileWorkItem(AsyncShaderCompiler::WorkItemPtr item, u32 priority)
+{
+  // On demand compiles that haven't started after this time are most likely for a scene that has
+  // already ended, so they move behind the ones that were requested since.
+  constexpr auto ONDEMAND_COMPILE_DEADLINE = std::chrono::milliseconds(500);
+
+  if (priority == COMPILE_PRIORITY_ONDEMAND_PIPELINE)
+  {
+    m_async_shader_compiler->QueueWorkItem(
+        std::move(item), priority, AsyncShaderCompiler::Clock::now() + ONDEMAND_COMPILE_DEADLINE,
+        COMPILE_PRIORITY_EXPIRED_ONDEMAND_PIPELINE);
+  }
+  else
+  {
+    m_async_shader_compiler->QueueWorkItem(std::move(item), priority);
+  }
+}
+
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -1050,7 +1251,7 @@ void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 prior
 
   m_vs_cache.shader_map[uid].pending = true;
   auto wi = m_async_shader_compiler->CreateWorkItem<VertexShaderWorkItem>(this, uid);
-  m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+  QueueCompileWorkItem(std::move(wi), priority);
 }
 
 void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid, u32 priority)
@@ -1079,7 +1280,7 @@ void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid
 
   m_uber_vs_cache.shader_map[uid].pending = true;
   auto wi = m_async_shader_compiler->CreateWorkItem<VertexUberShaderWorkItem>(this, uid);
-  m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+  QueueCompileWorkItem(std::move(wi), priority);
 }
 
 void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority)
@@ -1108,7 +1309,7 @@ void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priorit
 
   m_ps_cache.shader_map[uid].pending = true;
   auto wi = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(this, uid);
-  m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+  QueueCompileWorkItem(std::move(wi), priority);
 }
 
 void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid& uid, u32 priority)
@@ -1137,7 +1338,7 @@ void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid&
 
   m_uber_ps_cache.shader_map[uid].pending = true;
   auto wi = m_async_shader_compiler->CreateWorkItem<PixelUberShaderWorkItem>(this, uid);
-  m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+  QueueCompileWorkItem(std::move(wi), priority);
 }
 
 void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
@@ -1188,13 +1389,15 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       if (stages_ready)
       {
         shader_cache->InsertGXPipeline(uid, std::move(pipeline));
+        if (priority >= COMPILE_PRIORITY_SHADERCACHE_PIPELINE)
+          shader_cache->m_num_precompiled_pipelines++;
       }
       else
       {
         // Re-queue for next frame.
         auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             shader_cache, uid, priority);
-        shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+        shader_cache->QueueCompileWorkItem(std::move(wi), priority);
       }
     }
 
@@ -1208,8 +1411,8 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
-  m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_pipeline_cache[uid].second = true;
+  QueueCompileWorkItem(std::move(wi), priority);
+  m_gx_pipeline_cache[uid].pending = true;
 }
 
 void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
@@ -1269,7 +1472,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
         // Re-queue for next frame.
         auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(
             shader_cache, uid, priority);
-        shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
+        shader_cache->QueueCompileWorkItem(std::move(wi), priority);
       }
     }
 
@@ -1283,8 +1486,8 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(this, uid, priority);
-  m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_uber_pipeline_cache[uid].second = true;
+  QueueCompileWorkItem(std::move(wi), priority);
+  m_gx_uber_pipeline_cache[uid].pending = true;
 }
 
 void ShaderCache::QueueUberShaderPipelines()
@@ -1322,7 +1525,7 @@ void ShaderCache::QueueUberShaderPipelines()
           return;
 
         auto& entry = m_gx_uber_pipeline_cache[config];
-        entry.second = false;
+        entry.pending = false;
       };
 
   // Populate the pipeline configs with empty entries, these will be compiled afterwards.
@@ -1384,6 +1587,33 @@ void ShaderCache::QueueUberShaderPipelines()
   });
 }
 
+void ShaderCache::QueueSpecializedUberShaderPipelines()
+{
+  // There are too many combinations to compile them all, so only the ones for the pipelines of the
+  // UID cache are queued. In hybrid mode, the ones of pipelines that are already compiled are
+  // never drawn with.
+  const bool exclusive = g_ActiveConfig.iShaderCompilationMode ==
+                         ShaderCompilationMode::SynchronousUberShaders;
+  for (const auto& [uid, entry] : m_gx_pipeline_cache)
+  {
+    if (entry.pipeline && !exclusive)
+      continue;
+
+    GXUberPipelineUid config;
+    config.vertex_format =
+        VertexLoaderManager::GetUberVertexFormat(uid.vertex_format->GetVertexDeclaration());
+    config.vs_uid = UberShader::GetVertexShaderUid(*uid.vs_uid.GetUidData());
+    config.gs_uid = uid.gs_uid;
+    config.ps_uid = UberShader::GetPixelShaderUid(*uid.ps_uid.GetUidData());
+    config.rasterization_state = uid.rasterization_state;
+    config.depth_state = uid.depth_state;
+    config.blending_state = uid.blending_state;
+
+    // Empty entries are compiled by CompileMissingPipelines.
+    m_gx_uber_pipeline_cache.try_emplace(config);
+  }
+}
+
 const AbstractPipeline*
 ShaderCache::GetEFBCopyToVRAMPipeline(const TextureConversionShaderGen::TCShaderUid& uid)
 {
@@ -69,6 +69,10 @@ public:
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
   std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
+  // Specialized ubershaders only stand in for the specialized pipeline of the same state, so they
+  // aren't queued once that pipeline is compiling or compiled.
+  std::optional<const AbstractPipeline*>
+  GetUberPipelineForUidAsync(const GXUberPipelineUid& uid, const GXPipelineUid& specialized_uid);
 
   // Shared shaders
   const AbstractShader* GetScreenQuadVertexShader() const
@@ -117,6 +121,21 @@ public:
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
+  struct PipelineCacheEntry
+  {
+    std::unique_ptr<AbstractPipeline> pipeline;
+    // Compiling in the background
+    bool pending = false;
+
+    // Usage of specialized pipelines, which decides the order they are precompiled in.
+    // first_use is the order in which the pipeline was first used in this session, 0 if it wasn't
+    // used yet. The earliest first use and the number of sessions it was used in before are read
+    // from the usage file.
+    u32 first_use = 0;
+    u32 earliest_first_use = 0;
+    u32 num_sessions_used = 0;
+  };
+
   void WaitForAsyncCompiler();
   void LoadCaches();
   void ClearCaches();
@@ -124,6 +143,7 @@ private:
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
+  void QueueSpecializedUberShaderPipelines();
   bool CompileSharedPipelines();
 
   // GX shader compiler methods
@@ -161,8 +181,12 @@ private:
                                                std::unique_ptr<AbstractPipeline> pipeline);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  void RecordGXPipelineUse(PipelineCacheEntry& entry);
+  void LoadPipelineUsage();
+  void SavePipelineUsage();
 
   // ASync Compiler Methods
+  void QueueCompileWorkItem(AsyncShaderCompiler::WorkItemPtr item, u32 priority);
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
   void QueueVertexUberShaderCompile(const UberShader::VertexShaderUid& uid, u32 priority);
   void QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priority);
@@ -184,11 +208,15 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Specialized ubershaders
+  // come after the generic ones, which they fall back to until they are ready. On demand shaders
+  // that miss their deadline go behind the ones that were requested since.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
+    COMPILE_PRIORITY_EXPIRED_ONDEMAND_PIPELINE = 150,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
+    COMPILE_PRIORITY_SPECIALIZED_UBERSHADER_PIPELINE = 250,
     COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
   };
 
@@ -224,13 +252,17 @@ private:
   ShaderModuleCache<UberShader::VertexShaderUid> m_uber_vs_cache;
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
-  // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
-      m_gx_uber_pipeline_cache;
+  // GX Pipeline Caches
+  std::map<GXPipelineUid, PipelineCacheEntry> m_gx_pipeline_cache;
+  std::map<GXUberPipelineUid, PipelineCacheEntry> m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
+  u32 m_num_used_gx_pipelines = 0;
+
+  // Progress of the specialized pipelines queued by CompileMissingPipelines
+  u32 m_num_precompile_pipelines = 0;
+  u32 m_num_precompiled_pipelines = 0;
 
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
@@ -3,6 +3,8 @@
 
 #include "VideoCommon/ShaderGenCommon.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
@@ -12,6 +14,23 @@
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
+void ShaderCode::WriteUnescaped(std::string_view format)
+{
+  // fmt validates the format string at compile time, so every brace in it is doubled.
+  while (true)
+  {
+    const size_t brace = std::min(format.find('{'), format.find('}'));
+    if (brace == std::string_view::npos)
+    {
+      m_buffer.append(format);
+      return;
+    }
+
+    m_buffer.append(format.substr(0, brace + 1));
+    format.remove_prefix(brace + 2);
+  }
+}
+
 ShaderHostConfig ShaderHostConfig::GetCurrent()
 {
   ShaderHostConfig bits = {};
@@ -47,6 +66,7 @@ ShaderHostConfig ShaderHostConfig::GetCurrent()
   bits.backend_dynamic_vertex_loader = g_backend_info.bSupportsDynamicVertexLoader;
   bits.backend_vs_point_line_expand = g_ActiveConfig.UseVSForLinePointExpand();
   bits.backend_gl_layer_in_fs = g_backend_info.bSupportsGLLayerInFS;
+  bits.specialized_ubershaders = g_ActiveConfig.bSpecializeUberShaders;
   return bits;
 }
 
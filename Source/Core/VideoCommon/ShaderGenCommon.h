@@ -6,6 +6,8 @@
 #include <cstring>
 #include <functional>
 #include <iterator>
+#include <map>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -112,11 +114,61 @@ public:
   template <typename... Args>
   void Write(fmt::format_string<Args...> format, Args&&... args)
   {
-    fmt::format_to(std::back_inserter(m_buffer), format, std::forward<Args>(args)...);
+    // Most of a shader is written without arguments, and doesn't need to go through fmt.
+    if constexpr (sizeof...(Args) == 0)
+    {
+      const fmt::string_view text = format;
+      WriteUnescaped(std::string_view(text.data(), text.size()));
+    }
+    else
+    {
+      fmt::format_to(std::back_inserter(m_buffer), format, std::forward<Args>(args)...);
+    }
   }
 
+  // Appends text that is already formatted, e.g. another shader's buffer.
+  void Append(std::string_view text) { m_buffer.append(text); }
+
 protected:
   std::string m_buffer;
+
+private:
+  // Appends a format string that has no replacement fields, turning "{{" and "}}" into braces.
+  void WriteUnescaped(std::string_view format);
+};
+
+/**
+ * Shader code that only depends on the configuration and not on the UID, like the helper functions
+ * at the top of every pixel shader. Each variant is generated once when it's first needed, and
+ * then copied into the shaders. Shaders are generated on several threads, so this is thread-safe.
+ */
+template <typename Key>
+class PrerenderedShaderCode
+{
+public:
+  template <typename Generator>
+  void Write(ShaderCode& out, const Key& key, Generator&& generate)
+  {
+    const std::string* text;
+    {
+      std::lock_guard lk(m_mutex);
+      auto [it, inserted] = m_variants.try_emplace(key);
+      if (inserted)
+      {
+        ShaderCode code;
+        generate(code);
+        it->second = code.GetBuffer();
+      }
+      text = &it->second;
+    }
+
+    // Variants are never modified or removed after being generated.
+    out.Append(*text);
+  }
+
+private:
+  std::mutex m_mutex;
+  std::map<Key, std::string> m_variants;
 };
 
 /**
@@ -179,6 +231,7 @@ union ShaderHostConfig
   BitField<27, 1, bool, u32> backend_dynamic_vertex_loader;
   BitField<28, 1, bool, u32> backend_vs_point_line_expand;
   BitField<29, 1, bool, u32> backend_gl_layer_in_fs;
+  BitField<30, 1, bool, u32> specialized_ubershaders;
 
   static ShaderHostConfig GetCurrent();
 };
@@ -3,12 +3,23 @@
 
 #include "VideoCommon/Spirv.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#include <fmt/format.h>
 #include <glslang/SPIRV/GlslangToSpv.h>
 #include <glslang/SPIRV/disassemble.h>
+#include <xxhash.h>
 
+#include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Random.h"
 #include "Common/StringUtil.h"
 #include "Common/Version.h"
 
@@ -17,6 +28,9 @@
 
 namespace
 {
+std::atomic<u32> s_disk_cache_hits = 0;
+std::atomic<u32> s_disk_cache_misses = 0;
+
 bool InitializeGlslang()
 {
   static bool glslang_initialized = false;
@@ -272,6 +286,90 @@ CompileShaderToSPV(EShLanguage stage, APIType api_type,
 
   return out_code;
 }
+
+// Everything apart from the source code that changes the generated SPIR-V. The messages only
+// depend on the API type through the Vulkan rules, so Vulkan and Metal share their entries.
+struct DiskCacheOptions
+{
+  u32 format_version;
+  s32 glslang_major;
+  s32 glslang_minor;
+  s32 glslang_patch;
+  u32 stage;
+  u32 vulkan_rules;
+  u32 language_version;
+  u32 debug_info;
+};
+
+// Precedes the code in each entry, so that truncated or corrupted files are detected.
+struct DiskCacheEntryHeader
+{
+  u32 magic;
+  u32 code_size;
+  u64 key_high;
+  u64 key_low;
+  u64 code_checksum;
+};
+
+constexpr u32 DISK_CACHE_ENTRY_MAGIC = 0x56505344;  // DSPV
+
+u64 GetDiskCacheEntryChecksum(const SPIRV::DiskCacheKey& key, const SPIRV::CodeVector& code)
+{
+  return XXH3_64bits_withSeed(code.data(), code.size() * sizeof(SPIRV::CodeType),
+                              key.high ^ key.low);
+}
+
+SPIRV::DiskCacheKey GetDiskCacheKey(EShLanguage stage, APIType api_type,
+                                    glslang::EShTargetLanguageVersion language_version,
+                                    std::string_view source)
+{
+  const glslang::Version glslang_version = glslang::GetVersion();
+
+  DiskCacheOptions options;
+  std::memset(&options, 0, sizeof(options));
+  options.format_version = 2;
+  options.glslang_major = glslang_version.major;
+  options.glslang_minor = glslang_version.minor;
+  options.glslang_patch = glslang_version.patch;
+  options.stage = static_cast<u32>(stage);
+  options.vulkan_rules = api_type == APIType::Vulkan || api_type == APIType::Metal;
+  options.language_version = static_cast<u32>(language_version);
+  options.debug_info = g_ActiveConfig.bEnableValidationLayer;
+
+  const u64 seed = XXH3_64bits(&options, sizeof(options));
+  const XXH128_hash_t hash = XXH3_128bits_withSeed(source.data(), source.size(), seed);
+  return {hash.high64, hash.low64};
+}
+
+std::optional<SPIRV::CodeVector>
+CompileShaderToSPVWithDiskCache(EShLanguage stage, APIType api_type,
+                                glslang::EShTargetLanguageVersion language_version,
+                                const char* stage_filename, std::string_view source,
+                                glslang::TShader::Includer* shader_includer)
+{
+  // Shaders that include other files can't be identified by their source alone.
+  if (!g_ActiveConfig.bShaderCache || shader_includer)
+  {
+    return CompileShaderToSPV(stage, api_type, language_version, stage_filename, source,
+                              shader_includer);
+  }
+
+  const SPIRV::DiskCacheKey key = GetDiskCacheKey(stage, api_type, language_version, source);
+  const std::string path = SPIRV::GetDiskCacheEntryPath(SPIRV::GetDiskCacheDirectory(), key);
+  if (auto code = SPIRV::ReadDiskCacheEntry(path, key))
+  {
+    s_disk_cache_hits++;
+    return code;
+  }
+
+  s_disk_cache_misses++;
+  auto code = CompileShaderToSPV(stage, api_type, language_version, stage_filename, source,
+                                 shader_includer);
+  if (code)
+    SPIRV::WriteDiskCacheEntry(path, key, *code);
+
+  return code;
+}
 }  // namespace
 
 namespace SPIRV
@@ -280,31 +378,159 @@ std::optional<CodeVector> CompileVertexShader(std::string_view source_code, APIT
                                               glslang::EShTargetLanguageVersion language_version,
                                               glslang::TShader::Includer* shader_includer)
 {
-  return CompileShaderToSPV(EShLangVertex, api_type, language_version, "vs", source_code,
-                            shader_includer);
+  return CompileShaderToSPVWithDiskCache(EShLangVertex, api_type, language_version, "vs",
+                                         source_code, shader_includer);
 }
 
 std::optional<CodeVector> CompileGeometryShader(std::string_view source_code, APIType api_type,
                                                 glslang::EShTargetLanguageVersion language_version,
                                                 glslang::TShader::Includer* shader_includer)
 {
-  return CompileShaderToSPV(EShLangGeometry, api_type, language_version, "gs", source_code,
-                            shader_includer);
+  return CompileShaderToSPVWithDiskCache(EShLangGeometry, api_type, language_version, "gs",
+                                         source_code, shader_includer);
 }
 
 std::optional<CodeVector> CompileFragmentShader(std::string_view source_code, APIType api_type,
                                                 glslang::EShTargetLanguageVersion language_version,
                                                 glslang::TShader::Includer* shader_includer)
 {
-  return CompileShaderToSPV(EShLangFragment, api_type, language_version, "ps", source_code,
-                            shader_includer);
+  return CompileShaderToSPVWithDiskCache(EShLangFragment, api_type, language_version, "ps",
+                                         source_code, shader_includer);
 }
 
 std::optional<CodeVector> CompileComputeShader(std::string_view source_code, APIType api_type,
                                                glslang::EShTargetLanguageVersion language_version,
                                                glslang::TShader::Includer* shader_includer)
 {
-  return CompileShaderToSPV(EShLangCompute, api_type, language_version, "cs", source_code,
-                            shader_includer);
+  return CompileShaderToSPVWithDiskCache(EShLangCompute, api_type, language_version, "cs",
+                                         source_code, shader_includer);
+}
+
+DiskCacheStatistics GetDiskCacheStatistics()
+{
+  return {s_disk_cache_hits.load(), s_disk_cache_misses.load()};
+}
+
+std::string GetDiskCacheDirectory()
+{
+  return File::GetUserPath(D_SHADERCACHE_IDX) + "SPIRV" DIR_SEP;
+}
+
+// The SPIR-V of each shader is stored in its own file, named after its key, so a lookup only
+// reads the one file and nothing has to be loaded at startup.
+std::string GetDiskCacheEntryPath(const std::string& directory, const DiskCacheKey& key)
+{
+  return fmt::format("{}{:016x}{:016x}.spv", directory, key.high, key.low);
+}
+
+std::optional<CodeVector> ReadDiskCacheEntry(const std::string& path, const DiskCacheKey& key)
+{
+  File::IOFile file(path, "rb");
+  if (!file.IsOpen())
+    return std::nullopt;
+
+  constexpr CodeType SPIRV_MAGIC = 0x07230203;
+  DiskCacheEntryHeader header;
+  CodeVector code;
+  if (file.ReadArray(&header, 1) && header.magic == DISK_CACHE_ENTRY_MAGIC &&
+      header.key_high == key.high && header.key_low == key.low && header.code_size != 0 &&
+      file.GetSize() == sizeof(header) + u64{header.code_size} * sizeof(CodeType))
+  {
+    code.resize(header.code_size);
+    if (file.ReadArray(code.data(), code.size()) && code[0] == SPIRV_MAGIC &&
+        GetDiskCacheEntryChecksum(key, code) == header.code_checksum)
+    {
+      // Entries are evicted in the order they were last used.
+      file.Close();
+      std::error_code error;
+      std::filesystem::last_write_time(StringToPath(path),
+                                       std::filesystem::file_time_type::clock::now(), error);
+      return code;
+    }
+  }
+
+  WARN_LOG_FMT(VIDEO, "Ignoring invalid SPIR-V cache entry {}", path);
+  return std::nullopt;
+}
+
+bool WriteDiskCacheEntry(const std::string& path, const DiskCacheKey& key, const CodeVector& code)
+{
+  // The same shader can be compiled on several threads or by several Dolphin instances at once,
+  // so each writer needs its own temporary file. Readers only ever see complete files.
+  const std::string temp_path = fmt::format("{}{:016x}", File::GetTempFilenameForAtomicWrite(path),
+                                            Common::Random::GenerateValue<u64>());
+
+  if (!File::CreateFullPath(path))
+    return false;
+
+  const DiskCacheEntryHeader header{.magic = DISK_CACHE_ENTRY_MAGIC,
+                                    .code_size = static_cast<u32>(code.size()),
+                                    .key_high = key.high,
+                                    .key_low = key.low,
+                                    .code_checksum = GetDiskCacheEntryChecksum(key, code)};
+  {
+    File::IOFile file(temp_path, "wb");
+    if (!file.WriteArray(&header, 1) || !file.WriteArray(code.data(), code.size()))
+    {
+      file.Close();
+      File::Delete(temp_path);
+      return false;
+    }
+  }
+
+  if (!File::Rename(temp_path, path))
+  {
+    File::Delete(temp_path);
+    return false;
+  }
+
+  return true;
+}
+
+void TrimDiskCache(const std::string& directory, u64 max_size)
+{
+  struct Entry
+  {
+    std::filesystem::path path;
+    std::filesystem::file_time_type last_used;
+    u64 size;
+  };
+
+  std::vector<Entry> entries;
+  u64 total_size = 0;
+  std::error_code error;
+  for (const auto& it : std::filesystem::directory_iterator(StringToPath(directory), error))
+  {
+    // Temporary files are left alone, since another instance may still be writing them.
+    if (!it.is_regular_file(error) || it.path().extension() != ".spv")
+      continue;
+
+    const u64 size = it.file_size(error);
+    const auto last_used = it.last_write_time(error);
+    if (error)
+      continue;
+
+    entries.push_back({it.path(), last_used, size});
+    total_size += size;
+  }
+
+  if (total_size <= max_size)
+    return;
+
+  std::ranges::sort(entries, {}, &Entry::last_used);
+  u32 num_deleted = 0;
+  for (const Entry& entry : entries)
+  {
+    if (total_size <= max_size)
+      break;
+
+    if (std::filesystem::remove(entry.path, error))
+    {
+      total_size -= entry.size;
+      ++num_deleted;
+    }
+  }
+
+  INFO_LOG_FMT(VIDEO, "Deleted {} least recently used SPIR-V cache entries", num_deleted);
 }
 }  // namespace SPIRV
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -38,4 +39,36 @@ std::optional<CodeVector> CompileFragmentShader(std::string_view source_code, AP
 std::optional<CodeVector> CompileComputeShader(std::string_view source_code, APIType api_type,
                                                glslang::EShTargetLanguageVersion language_version,
                                                glslang::TShader::Includer* shader_includer);
+
+// While shader caching is enabled, the compiled SPIR-V is also stored in the SPIRV folder of the
+// shader cache, keyed by the source, the glslang version and the compile options. This skips the
+// glslang front-end whenever the backend's own cache misses, e.g. after a driver update.
+struct DiskCacheStatistics
+{
+  u32 hits;
+  u32 misses;
+};
+
+// Hash of the source and the compile options of a shader.
+struct DiskCacheKey
+{
+  u64 high;
+  u64 low;
+};
+
+// The SPIR-V disk cache is trimmed to this size whenever the shader cache is initialized.
+constexpr u64 MAX_DISK_CACHE_SIZE = 256 * 1024 * 1024;
+
+// Lookups in the SPIR-V disk cache since Dolphin was started.
+DiskCacheStatistics GetDiskCacheStatistics();
+
+std::string GetDiskCacheDirectory();
+std::string GetDiskCacheEntryPath(const std::string& directory, const DiskCacheKey& key);
+
+// Returns nullopt if the entry doesn't exist, belongs to another key or is corrupted.
+std::optional<CodeVector> ReadDiskCacheEntry(const std::string& path, const DiskCacheKey& key);
+bool WriteDiskCacheEntry(const std::string& path, const DiskCacheKey& key, const CodeVector& code);
+
+// Deletes the least recently used entries until the cache is at most max_size bytes.
+void TrimDiskCache(const std::string& directory, u64 max_size);
 }  // namespace SPIRV
@@ -91,14 +91,43 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  if (g_ActiveConfig.bHiresTextures)
+  {
+    draw_statistic("Custom textures RAM", "%llu kB",
+                   static_cast<unsigned long long>(custom_texture_ram_bytes / 1024));
+    draw_statistic("Custom textures VRAM", "%llu kB",
+                   static_cast<unsigned long long>(custom_texture_vram_bytes / 1024));
+    draw_statistic("Custom texture misses", "%d", num_custom_texture_misses);
+  }
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
+  draw_statistic("Pipelines precompiled", "%d (%d loaded)", num_pipelines_precompiled,
+                 num_pipelines_loaded);
+  draw_statistic("Pipelines used", "%d (%d precompiled)", num_pipelines_used,
+                 num_precompiled_pipelines_used);
+  if (const int lookups = num_spirv_cache_hits + num_spirv_cache_misses; lookups != 0)
+  {
+    draw_statistic("SPIR-V cache hits", "%d/%d (%d%%)", num_spirv_cache_hits, lookups,
+                   num_spirv_cache_hits * 100 / lookups);
+  }
+  draw_statistic("Compiles pending", "%d", num_async_compiles_pending);
+  draw_statistic("Compile latency", "%.1f/%.1f/%.1f ms", async_compile_latency_ms[0],
+                 async_compile_latency_ms[1], async_compile_latency_ms[2]);
+  draw_statistic("Compiles expired/wasted", "%d/%d", num_async_compiles_expired,
+                 num_async_compiles_wasted);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
+  if (g_ActiveConfig.bGeometryCache)
+  {
+    const int lookups = this_frame.num_geometry_cache_hits + this_frame.num_geometry_cache_misses;
+    draw_statistic("Geometry cache hits", "%d/%d (%d%%)", this_frame.num_geometry_cache_hits,
+                   lookups, lookups ? this_frame.num_geometry_cache_hits * 100 / lookups : 0);
+  }
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
-  draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  draw_statistic("Draw calls", "%d (%d before merging)", this_frame.num_draw_calls,
+                 this_frame.num_draw_calls + this_frame.num_draw_calls_merged);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
@@ -110,6 +139,8 @@ void Statistics::Display() const
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
+  draw_statistic("Uniform skipped", "%i kB (%d uploads)", this_frame.bytes_uniform_skipped / 1024,
+                 this_frame.num_uniform_uploads_skipped);
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
@@ -6,6 +6,7 @@
 #include <array>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/BPFunctions.h"
 
 struct Statistics
@@ -15,10 +16,33 @@ struct Statistics
   int num_vertex_shaders_created = 0;
   int num_vertex_shaders_alive = 0;
 
+  // Specialized pipelines that were ready before their first use, and how many of them were used
+  int num_pipelines_precompiled = 0;
+  // Precompiled pipelines that were loaded from the pipeline cache instead of being compiled
+  int num_pipelines_loaded = 0;
+  int num_pipelines_used = 0;
+  int num_precompiled_pipelines_used = 0;
+
+  // Lookups in the SPIR-V disk cache, see SPIRV::GetDiskCacheStatistics
+  int num_spirv_cache_hits = 0;
+  int num_spirv_cache_misses = 0;
+
+  // Background compiles, see AsyncShaderCompiler::GetStatistics. Wasted compiles were cancelled
+  // before or while compiling. The latency percentiles are p50, p90 and p99.
+  int num_async_compiles_pending = 0;
+  int num_async_compiles_expired = 0;
+  int num_async_compiles_wasted = 0;
+  std::array<float, 3> async_compile_latency_ms{};
+
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
 
+  // Textures that were created from the game's data because their custom texture wasn't loaded yet
+  int num_custom_texture_misses = 0;
+  u64 custom_texture_ram_bytes = 0;
+  u64 custom_texture_vram_bytes = 0;
+
   int num_vertex_loaders = 0;
 
   std::array<float, 6> proj{};
@@ -55,12 +79,17 @@ struct Statistics
 
     int num_primitive_joins = 0;
     int num_draw_calls = 0;
+    int num_draw_calls_merged = 0;
 
     int num_dlists_called = 0;
+    int num_geometry_cache_hits = 0;
+    int num_geometry_cache_misses = 0;
 
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
     int bytes_uniform_streamed = 0;
+    int bytes_uniform_skipped = 0;
+    int num_uniform_uploads_skipped = 0;
 
     int num_triangles_clipped = 0;
     int num_triangles_in = 0;
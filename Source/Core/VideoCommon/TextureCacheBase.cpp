@@ -42,10 +42,12 @@
 #include "VideoCommon/Assets/TextureAssetUtils.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUStageTimer.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/ShaderCache.h"
@@ -62,6 +64,9 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// Alignment of the decoding buffer, so that the stores of the AVX2 texture decoders don't cross
+// cache lines.
+static const size_t TEMP_ALIGNMENT = 32;
 
 static int xfb_count = 0;
 
@@ -88,7 +93,7 @@ void TextureCacheBase::CheckTempSize(size_t required_size)
 
   m_temp_size = required_size;
   Common::FreeAlignedMemory(m_temp);
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, TEMP_ALIGNMENT));
 }
 
 TextureCacheBase::TextureCacheBase()
@@ -96,10 +101,11 @@ TextureCacheBase::TextureCacheBase()
   SetBackupConfig(g_ActiveConfig);
 
   m_temp_size = 2048 * 2048 * 4;
-  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, 16));
+  m_temp = static_cast<u8*>(Common::AllocateAlignedMemory(m_temp_size, TEMP_ALIGNMENT));
 
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
+  m_parallel_decoder.SetNumWorkerThreads(g_ActiveConfig.GetWorkerThreads());
 
   TMEM::InvalidateAll();
 }
@@ -171,6 +177,7 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  m_parallel_decoder.SetNumWorkerThreads(config.GetWorkerThreads());
   SetBackupConfig(config);
 }
 
@@ -214,6 +221,8 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
+  LimitCustomTextureMemory(_frameCount);
+
   TexPool::iterator iter2 = m_texture_pool.begin();
   TexPool::iterator tcend2 = m_texture_pool.end();
   while (iter2 != tcend2)
@@ -233,6 +242,56 @@ void TextureCacheBase::Cleanup(int _frameCount)
   }
 }
 
+static u64 GetTextureMemorySize(const AbstractTexture& texture)
+{
+  const TextureConfig& config = texture.GetConfig();
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(config.format);
+  u64 size = 0;
+  for (u32 level = 0; level < config.levels; ++level)
+  {
+    const u32 width = std::max(config.width >> level, 1u);
+    const u32 height = std::max(config.height >> level, 1u);
+    const u32 num_rows = (height + block_size - 1) / block_size;
+    size += u64{AbstractTexture::CalculateStrideForFormat(config.format, width)} * num_rows;
+  }
+  return size * config.layers;
+}
+
+void TextureCacheBase::LimitCustomTextureMemory(int frame_count)
+{
+  u64 vram_used = 0;
+  for (const auto& [address, entry] : m_textures_by_address)
+  {
+    if (entry->is_custom_tex)
+      vram_used += GetTextureMemorySize(*entry->texture);
+  }
+
+  const u64 vram_budget = u64(g_ActiveConfig.iHiresTexturesVRAMBudget) * 1024 * 1024;
+  if (vram_budget != 0 && vram_used > vram_budget)
+  {
+    std::vector<TexAddrCache::iterator> unused_textures;
+    for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end(); ++iter)
+    {
+      if (iter->second->is_custom_tex && iter->second->frameCount != frame_count)
+        unused_textures.push_back(iter);
+    }
+    std::ranges::sort(unused_textures, {}, [](TexAddrCache::iterator iter) {
+      return iter->second->frameCount;
+    });
+
+    // The texture data usually is still in RAM, so recreating an evicted texture is only an upload.
+    for (const TexAddrCache::iterator iter : unused_textures)
+    {
+      if (vram_used <= vram_budget)
+        break;
+      vram_used -= GetTextureMemorySize(*iter->second->texture);
+      InvalidateTexture(iter);
+    }
+  }
+
+  g_stats.custom_texture_vram_bytes = vram_used;
+}
+
 bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
 {
   if (addr + size_in_bytes <= range_address)
@@ -704,7 +763,6 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
     auto tex = DeserializeTexture(p);
     auto entry =
         std::make_shared<TCacheEntry>(std::move(tex->texture), std::move(tex->framebuffer));
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
     entry->DoState(p);
     if (entry->texture && commit_state)
       id_map.emplace(i, entry);
@@ -749,7 +807,10 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+    {
+      m_textures_by_hash.emplace(hash, entry);
+      entry->textures_by_hash_key = hash;
+    }
   }
 
   // Clear bound textures
@@ -1233,6 +1294,8 @@ private:
 
 TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
+  VideoCommon::ScopedGPUStageTimer lookup_timer(VideoCommon::GPUStage::TextureCacheLookup);
+
   if (auto entry = LoadImpl(texture_info, false))
   {
     if (!DidLinkedAssetsChange(*entry))
@@ -1337,10 +1400,36 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                                             MemoryUpdate::Type::TextureMap);
   }
 
+  // With write tracking, an existing entry for the same memory knows whether it's unchanged, and
+  // its hash can be reused without reading the memory.
+  std::optional<u64> tracked_base_hash;
+  if (g_ActiveConfig.bTextureCacheWriteTracking && !texture_info.IsFromTmem())
+  {
+    auto range = m_textures_by_address.equal_range(texture_info.GetRawAddress());
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      TCacheEntry& entry = *iter->second;
+      if (!entry.IsCopy() && entry.size_in_bytes == texture_info.GetTextureSize() &&
+          entry.memory_stride == entry.BytesPerRow() &&
+          entry.HashSampleSize() == textureCacheSafetyColorSampleSize)
+      {
+        tracked_base_hash = entry.CalculateHash();
+        break;
+      }
+    }
+  }
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (tracked_base_hash)
+  {
+    base_hash = *tracked_base_hash;
+  }
+  else
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1530,7 +1619,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
           (u32)textureCacheSafetyColorSampleSize * 8)
   {
     auto hash_range = m_textures_by_hash.equal_range(full_hash);
-    TexHashCache::iterator hash_iter = hash_range.first;
+    TexHashCache::key_iterator hash_iter = hash_range.first;
     while (hash_iter != hash_range.second)
     {
       RcTcacheEntry& entry = hash_iter->second;
@@ -1570,6 +1659,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
     {
       has_arbitrary_mipmaps = hires_texture->HasArbitraryMipmaps();
       std::tie(custom_texture_data, load_time) = hires_texture->LoadTexture();
+      if (!custom_texture_data)
+        INCSTAT(g_stats.num_custom_texture_misses);
       if (custom_texture_data && !VideoCommon::ValidateTextureData(
                                      hires_texture->GetId(), *custom_texture_data,
                                      texture_info.GetRawWidth(), texture_info.GetRawHeight()))
@@ -1644,6 +1735,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   }
   else
   {
+    VideoCommon::ScopedGPUStageTimer decode_timer(VideoCommon::GPUStage::TextureDecode);
+
     const u32 texLevels = no_mips ? 1 : texture_info.GetLevelCount();
     const u32 expanded_width = texture_info.GetExpandedWidth();
     const u32 expanded_height = texture_info.GetExpandedHeight();
@@ -1671,6 +1764,20 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
+    // The levels that are decoded in software are collected first and decoded together, so that
+    // large textures and their mip chains can be split across the texture decoding threads.
+    struct SoftwareLevel
+    {
+      u32 level;
+      u32 width;
+      u32 height;
+      u32 expanded_width;
+      u8* data;
+      size_t size;
+    };
+    std::vector<SoftwareLevel> software_levels;
+    std::vector<VideoCommon::ParallelTextureDecoder::Level> decoder_levels;
+
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
             entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1700,9 +1807,10 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       dst_buffer = m_temp;
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        decoder_levels.push_back({.dst = dst_buffer,
+                                  .src = texture_info.GetData(),
+                                  .width = static_cast<int>(expanded_width),
+                                  .height = static_cast<int>(expanded_height)});
       }
       else
       {
@@ -1711,9 +1819,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                                        expanded_height);
       }
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
-
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+      software_levels.push_back(
+          {0, width, height, expanded_width, dst_buffer, decoded_texture_size});
 
       dst_buffer += decoded_texture_size;
     }
@@ -1736,19 +1843,30 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
+        decoder_levels.push_back({.dst = dst_buffer,
+                                  .src = mip_level->GetData(),
+                                  .width = static_cast<int>(mip_level->GetExpandedWidth()),
+                                  .height = static_cast<int>(mip_level->GetExpandedHeight())});
+        software_levels.push_back({level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                   mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size});
 
         dst_buffer += decoded_mip_size;
       }
     }
 
+    const TimePoint decode_start = Clock::now();
+    m_parallel_decoder.Decode(decoder_levels, texture_info.GetTextureFormat(),
+                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+    if (!decoder_levels.empty())
+      g_perf_metrics.CountTextureDecodeStall(Clock::now() - decode_start);
+
+    for (const SoftwareLevel& level : software_levels)
+    {
+      entry->texture->Load(level.level, level.width, level.height, level.expanded_width,
+                           level.data, level.size);
+      arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, level.data);
+    }
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
@@ -1773,7 +1891,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
   {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+    m_textures_by_hash.emplace(creation_info.full_hash, entry);
+    entry->textures_by_hash_key = creation_info.full_hash;
   }
 
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
@@ -1853,6 +1972,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->is_custom_tex = false;
   entry->may_have_overlapping_textures = false;
   entry->frameCount = FRAMECOUNT_INVALID;
+  VideoCommon::ScopedGPUStageTimer decode_timer(VideoCommon::GPUStage::TextureDecode);
   if (!g_ActiveConfig.UseGPUTextureDecoding() ||
       !DecodeTextureOnGPU(entry, 0, src_data, total_size, entry->format.texfmt, width, height,
                           width, height, stride, s_tex_mem.data(), entry->format.tlutfmt))
@@ -2454,11 +2574,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
       // In this case, comparing the hash is not enough to check, if two textures are identical.
-      if (overlapping_entry->textures_by_hash_iter != m_textures_by_hash.end())
-      {
-        m_textures_by_hash.erase(overlapping_entry->textures_by_hash_iter);
-        overlapping_entry->textures_by_hash_iter = m_textures_by_hash.end();
-      }
+      RemoveFromHashCache(overlapping_entry.get());
     }
     ++iter.first;
   }
@@ -2638,7 +2754,6 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 
   auto cacheEntry =
       std::make_shared<TCacheEntry>(std::move(alloc->texture), std::move(alloc->framebuffer));
-  cacheEntry->textures_by_hash_iter = m_textures_by_hash.end();
   cacheEntry->id = m_last_entry_id++;
   return cacheEntry;
 }
@@ -2690,7 +2805,50 @@ TextureCacheBase::FindMatchingTextureFromPool(const TextureConfig& config)
   auto matching_iter = std::find_if(range.first, range.second, [](const auto& iter) {
     return iter.first.IsRenderTarget() || iter.second.frameCount != FRAMECOUNT_INVALID;
   });
-  return matching_iter != range.second ? matching_iter : m_texture_pool.end();
+  return matching_iter != range.second ? TexPool::iterator(matching_iter) : m_texture_pool.end();
+}
+
+TextureCacheBase::TexAddrCache::iterator
+TextureCacheBase::TexAddrCache::emplace(u32 address, RcTcacheEntry entry)
+{
+  // Elements with an equal key are inserted after the existing ones.
+  const iterator iter = m_map.emplace(address, std::move(entry));
+  if (!m_first_by_address.contains(address))
+    m_first_by_address.emplace(address, iter);
+  return iter;
+}
+
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::TexAddrCache::erase(iterator iter)
+{
+  const auto first = m_first_by_address.find(iter->first);
+  if (first->second == iter)
+  {
+    const iterator next = std::next(iter);
+    if (next != m_map.end() && next->first == iter->first)
+      first->second = next;
+    else
+      m_first_by_address.erase(first);
+  }
+  return m_map.erase(iter);
+}
+
+void TextureCacheBase::TexAddrCache::clear()
+{
+  m_map.clear();
+  m_first_by_address.clear();
+}
+
+std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
+TextureCacheBase::TexAddrCache::equal_range(u32 address)
+{
+  const auto first = m_first_by_address.find(address);
+  if (first == m_first_by_address.end())
+    return {m_map.end(), m_map.end()};
+
+  iterator last = first->second;
+  while (last != m_map.end() && last->first == address)
+    ++last;
+  return {first->second, last};
 }
 
 TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCacheEntry* entry)
@@ -2708,6 +2866,19 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+void TextureCacheBase::RemoveFromHashCache(TCacheEntry* entry)
+{
+  if (!entry->textures_by_hash_key)
+    return;
+
+  auto range = m_textures_by_hash.equal_range(*entry->textures_by_hash_key);
+  const auto iter = std::find_if(range.first, range.second,
+                                 [entry](const auto& it) { return it.second.get() == entry; });
+  if (iter != range.second)
+    m_textures_by_hash.erase(iter);
+  entry->textures_by_hash_key.reset();
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
@@ -2733,11 +2904,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
 
   RcTcacheEntry& entry = iter->second;
 
-  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
-  {
-    m_textures_by_hash.erase(entry->textures_by_hash_iter);
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
-  }
+  RemoveFromHashCache(entry.get());
 
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
@@ -3095,7 +3262,31 @@ int TCacheEntry::HashSampleSize() const
   return g_ActiveConfig.iSafeTextureCache_ColorSamples;
 }
 
-u64 TCacheEntry::CalculateHash() const
+u64 TCacheEntry::CalculateHash()
+{
+  if (!g_ActiveConfig.bTextureCacheWriteTracking)
+    return HashMemory();
+
+  auto& tracker = Core::System::GetInstance().GetMemory().GetWriteTracker();
+  const int sample_size = HashSampleSize();
+  if (tracked_hash && tracked_hash->address == addr && tracked_hash->size == size_in_bytes &&
+      tracked_hash->stride == memory_stride && tracked_hash->sample_size == sample_size &&
+      !tracker.WasWritten(addr, size_in_bytes, tracked_hash->write_sequence))
+  {
+    return tracked_hash->hash;
+  }
+
+  // The range has to be watched before reading it, so that no writes are missed.
+  const std::optional<u64> write_sequence = tracker.Watch(addr, size_in_bytes);
+  const u64 hash = HashMemory();
+  if (write_sequence)
+    tracked_hash = {addr, size_in_bytes, memory_stride, sample_size, *write_sequence, hash};
+  else
+    tracked_hash.reset();
+  return hash;
+}
+
+u64 TCacheEntry::HashMemory() const
 {
   const u32 bytes_per_row = BytesPerRow();
   const u32 hash_sample_size = HashSampleSize();
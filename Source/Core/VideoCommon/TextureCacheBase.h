@@ -19,12 +19,14 @@
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
+#include "Common/FlatHashMultiMap.h"
 #include "Common/MathUtil.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/HiresTextures.h"
+#include "VideoCommon/ParallelTextureDecoder.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -152,9 +154,22 @@ struct TCacheEntry
   // used to delete textures which haven't been used for TEXTURE_KILL_THRESHOLD frames
   int frameCount = FRAMECOUNT_INVALID;
 
-  // Keep an iterator to the entry in m_textures_by_hash, so it does not need to be searched when
-  // removing the cache entry
-  std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
+  // The key of the entry in m_textures_by_hash, if it is in there. The hash of EFB copies can
+  // change after they were added.
+  std::optional<u64> textures_by_hash_key;
+
+  // The last result of CalculateHash while the memory write tracker was watching the range. It can
+  // be reused until something writes to the memory.
+  struct TrackedHash
+  {
+    u32 address;
+    u32 size;
+    u32 stride;
+    int sample_size;
+    u64 write_sequence;
+    u64 hash;
+  };
+  std::optional<TrackedHash> tracked_hash;
 
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
@@ -228,7 +243,8 @@ struct TCacheEntry
   u32 NumBlocksY() const;
   u32 BytesPerRow() const;
 
-  u64 CalculateHash() const;
+  u64 CalculateHash();
+  u64 HashMemory() const;
 
   int HashSampleSize() const;
   u32 GetWidth() const { return texture->GetConfig().width; }
@@ -335,14 +351,39 @@ protected:
                                    float gamma, bool clamp_top, bool clamp_bottom,
                                    const std::array<u32, 3>& filter_coefficients);
 
-  alignas(16) u8* m_temp = nullptr;
+  u8* m_temp = nullptr;
   size_t m_temp_size = 0;
 
 private:
-  using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
-  using TexHashCache = std::multimap<u64, RcTcacheEntry>;
+  // Textures by start address. This has to be ordered for FindOverlappingTextures, but Load()
+  // only looks up exact addresses, so the first texture at each address is also kept in a flat
+  // hash table to avoid walking the tree.
+  class TexAddrCache
+  {
+  public:
+    using Map = std::multimap<u32, RcTcacheEntry>;
+    using iterator = Map::iterator;
+
+    iterator begin() { return m_map.begin(); }
+    iterator end() { return m_map.end(); }
+    size_t size() const { return m_map.size(); }
+
+    iterator emplace(u32 address, RcTcacheEntry entry);
+    iterator erase(iterator iter);
+    void clear();
 
-  using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
+    std::pair<iterator, iterator> equal_range(u32 address);
+    iterator lower_bound(u32 address) { return m_map.lower_bound(address); }
+    iterator upper_bound(u32 address) { return m_map.upper_bound(address); }
+
+  private:
+    Map m_map;
+    Common::FlatHashMultiMap<u32, iterator> m_first_by_address;
+  };
+
+  using TexHashCache = Common::FlatHashMultiMap<u64, RcTcacheEntry>;
+
+  using TexPool = Common::FlatHashMultiMap<TextureConfig, TexPoolEntry>;
 
   static bool DidLinkedAssetsChange(const TCacheEntry& entry);
 
@@ -369,10 +410,15 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  // Removes the least recently used custom textures until they fit in the VRAM budget. Textures
+  // used in the current frame are always kept.
+  void LimitCustomTextureMemory(int frame_count);
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
+  void RemoveFromHashCache(TCacheEntry* entry);
 
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
@@ -448,6 +494,9 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Splits the software decoding of large textures across worker threads.
+  VideoCommon::ParallelTextureDecoder m_parallel_decoder;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
@@ -202,7 +202,14 @@ void TexDecoder_DecodeTexelRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* sr
 void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 stride);
 
 void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
+// Draws the texture format over a decoded texture if the overlay is enabled. TexDecoder_Decode
+// already does this, only callers of _TexDecoder_DecodeImpl need to.
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat);
 
 /* Internal method, implemented by TextureDecoder_Generic and TextureDecoder_x64. */
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt);
+/* Reference implementation from TextureDecoder_Generic, which is built on all platforms so the
+ * optimized decoders can be compared against it. */
+void TexDecoder_DecodeImpl_Generic(u32* dst, const u8* src, int width, int height,
+                                   TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
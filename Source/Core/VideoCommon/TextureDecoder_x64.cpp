@@ -254,6 +254,111 @@ static void TexDecoder_DecodeImpl_C4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+// Decodes the colors of a palette up front, so the AVX2 decoders of the indexed formats only have
+// to look them up. Returns false for invalid TLUT formats, which aren't decoded at all.
+static bool DecodePalette(u32* palette, const u8* tlut_, TLUTFormat tlutfmt, int num_entries)
+{
+  const u16* tlut = (const u16*)tlut_;
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_IA8(tlut[i]);
+    return true;
+
+  case TLUTFormat::RGB565:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_RGB565(Common::swap16(tlut[i]));
+    return true;
+
+  case TLUTFormat::RGB5A3:
+    for (int i = 0; i < num_entries; i++)
+      palette[i] = DecodePixel_RGB5A3(Common::swap16(tlut[i]));
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[16];
+  if (!DecodePalette(palette, tlut, tlutfmt, 16))
+    return;
+
+  // All 16 colors fit in two registers. Both halves are looked up with the low 3 bits of the
+  // index, and bit 3 selects between the results.
+  const __m256i palette_lo = _mm256_load_si256((const __m256i*)palette);
+  const __m256i palette_hi = _mm256_load_si256((const __m256i*)palette + 1);
+  // Each byte holds two texels, the first one in the high nibble.
+  const __m256i shifts = _mm256_setr_epi32(4, 0, 12, 8, 20, 16, 28, 24);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000fL);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        u32 indices;
+        std::memcpy(&indices, src + 4 * xStep, sizeof(indices));
+        const __m256i index =
+            _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(indices), shifts), kMask_x0f);
+        const __m256 lo = _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(palette_lo, index));
+        const __m256 hi = _mm256_castsi256_ps(_mm256_permutevar8x32_epi32(palette_hi, index));
+        const __m256 select_hi = _mm256_castsi256_ps(_mm256_slli_epi32(index, 28));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_castps_si256(_mm256_blendv_ps(lo, hi, select_hi)));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m128i kMask_x0f = _mm_set1_epi32(0x0f0f0f0fL);
+  const __m128i kMask_xf0 = _mm_set1_epi32(0xf0f0f0f0L);
+
+  // Same as the SSSE3 version, but each shuffle produces a whole row of 8 texels, and 4 rows are
+  // expanded at once.
+  const __m256i mask_row0 =
+      _mm256_setr_epi8(0, 0, 0, 0, 8, 8, 8, 8, 1, 1, 1, 1, 9, 9, 9, 9,  //
+                       2, 2, 2, 2, 10, 10, 10, 10, 3, 3, 3, 3, 11, 11, 11, 11);
+  const __m256i mask_row1 =
+      _mm256_setr_epi8(4, 4, 4, 4, 12, 12, 12, 12, 5, 5, 5, 5, 13, 13, 13, 13,  //
+                       6, 6, 6, 6, 14, 14, 14, 14, 7, 7, 7, 7, 15, 15, 15, 15);
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0; iy < 8; iy += 4)
+      {
+        const __m128i r0 = _mm_loadu_si128((const __m128i*)(src + 32 * yStep + 4 * iy));
+        const __m128i i1 = _mm_and_si128(r0, kMask_xf0);
+        const __m128i i11 = _mm_or_si128(i1, _mm_srli_epi16(i1, 4));
+        const __m128i i2 = _mm_and_si128(r0, kMask_x0f);
+        const __m128i i22 = _mm_or_si128(i2, _mm_slli_epi16(i2, 4));
+
+        // (hi nibbles of rows 0 and 1, lo nibbles of rows 0 and 1) in both lanes
+        const __m256i base01 = _mm256_broadcastsi128_si256(_mm_unpacklo_epi64(i11, i22));
+        const __m256i base23 = _mm256_broadcastsi128_si256(_mm_unpackhi_epi64(i11, i22));
+
+        u32* row = dst + (y + iy) * width + x;
+        _mm256_storeu_si256((__m256i*)row, _mm256_shuffle_epi8(base01, mask_row0));
+        _mm256_storeu_si256((__m256i*)(row + width), _mm256_shuffle_epi8(base01, mask_row1));
+        _mm256_storeu_si256((__m256i*)(row + 2 * width), _mm256_shuffle_epi8(base23, mask_row0));
+        _mm256_storeu_si256((__m256i*)(row + 3 * width), _mm256_shuffle_epi8(base23, mask_row1));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I4_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -394,6 +499,28 @@ static void TexDecoder_DecodeImpl_I4(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_I8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Each lane expands one half of the row.
+  const __m256i mask = _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,  //
+                                        4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; ++iy, xStep++)
+      {
+        const __m256i r =
+            _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), _mm256_shuffle_epi8(r, mask));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_I8_SSSE3(u32* dst, const u8* src, int width, int height,
                                            TextureFormat texformat, const u8* tlut,
@@ -563,6 +690,30 @@ static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int hei
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[256];
+  if (!DecodePalette(palette, tlut, tlutfmt, 256))
+    return;
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i index =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_i32gather_epi32((const int*)palette, index, 4));
+      }
+    }
+  }
+}
+
 static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int height,
                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
                                       int Wsteps4, int Wsteps8)
@@ -579,6 +730,42 @@ static void TexDecoder_DecodeImpl_IA4(u32* dst, const u8* src, int width, int he
   }
 }
 
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_IA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                           TextureFormat texformat, const u8* tlut,
+                                           TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Expands a 16-bit "IA" to a 32-bit "AIII", after each texel got zero-extended to 32 bits.
+  const __m256i mask = _mm256_setr_epi8(1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12,  //
+                                        1, 1, 1, 0, 5, 5, 5, 4, 9, 9, 9, 8, 13, 13, 13, 12);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    // Decode the same row of two horizontally adjacent tiles at once.
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const u8* row = src + 8 * xStep;
+        const __m128i texels = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)row),
+                                                  _mm_loadl_epi64((const __m128i*)(row + 32)));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_shuffle_epi8(_mm256_cvtepu16_epi32(texels), mask));
+      }
+    }
+    if (x < width)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i texels = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        const __m256i rgba = _mm256_shuffle_epi8(_mm256_cvtepu16_epi32(texels), mask);
+        _mm_storeu_si128((__m128i*)(dst + (y + iy) * width + x), _mm256_castsi256_si128(rgba));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_IA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                             TextureFormat texformat, const u8* tlut,
@@ -774,6 +961,81 @@ static void TexDecoder_DecodeImpl_RGB565(u32* dst, const u8* src, int width, int
   }
 }
 
+// Decodes 8 RGB5A3 texels, which have been byte-swapped and zero-extended to 32 bits. Both
+// encodings are decoded for every texel, and the top bit selects the result.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeRGB5A3_AVX2(__m256i val)
+{
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001fL);
+  const __m256i kMask_x0f = _mm256_set1_epi32(0x0000000fL);
+  const __m256i kMask_x07 = _mm256_set1_epi32(0x00000007L);
+  const __m256i aVxff00 = _mm256_set1_epi32(0xFF000000L);
+
+  // RGB555: swizzle bits 00012345 -> 12345123
+  const __m256i tmpr5 = _mm256_and_si256(_mm256_srli_epi32(val, 10), kMask_x1f);
+  const __m256i r5 = _mm256_or_si256(_mm256_slli_epi32(tmpr5, 3), _mm256_srli_epi32(tmpr5, 2));
+  const __m256i tmpg5 = _mm256_and_si256(_mm256_srli_epi32(val, 5), kMask_x1f);
+  const __m256i g5 = _mm256_or_si256(_mm256_slli_epi32(tmpg5, 3), _mm256_srli_epi32(tmpg5, 2));
+  const __m256i tmpb5 = _mm256_and_si256(val, kMask_x1f);
+  const __m256i b5 = _mm256_or_si256(_mm256_slli_epi32(tmpb5, 3), _mm256_srli_epi32(tmpb5, 2));
+  const __m256i rgb555 = _mm256_or_si256(_mm256_or_si256(r5, _mm256_slli_epi32(g5, 8)),
+                                         _mm256_or_si256(_mm256_slli_epi32(b5, 16), aVxff00));
+
+  // RGBA4443: swizzle bits 00001234 -> 12341234, and alpha 00000123 -> 12312312
+  const __m256i tmpr4 = _mm256_and_si256(_mm256_srli_epi32(val, 8), kMask_x0f);
+  const __m256i r4 = _mm256_or_si256(_mm256_slli_epi32(tmpr4, 4), tmpr4);
+  const __m256i tmpg4 = _mm256_and_si256(_mm256_srli_epi32(val, 4), kMask_x0f);
+  const __m256i g4 = _mm256_or_si256(_mm256_slli_epi32(tmpg4, 4), tmpg4);
+  const __m256i tmpb4 = _mm256_and_si256(val, kMask_x0f);
+  const __m256i b4 = _mm256_or_si256(_mm256_slli_epi32(tmpb4, 4), tmpb4);
+  const __m256i tmpa3 = _mm256_and_si256(_mm256_srli_epi32(val, 12), kMask_x07);
+  const __m256i a3 =
+      _mm256_or_si256(_mm256_slli_epi32(tmpa3, 5),
+                      _mm256_or_si256(_mm256_slli_epi32(tmpa3, 2), _mm256_srli_epi32(tmpa3, 1)));
+  const __m256i rgba4443 =
+      _mm256_or_si256(_mm256_or_si256(r4, _mm256_slli_epi32(g4, 8)),
+                      _mm256_or_si256(_mm256_slli_epi32(b4, 16), _mm256_slli_epi32(a3, 24)));
+
+  const __m256i is_rgb555 = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(rgba4443, rgb555, is_rgb555);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  const __m128i bswap16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    // Decode the same row of two horizontally adjacent tiles at once. Unlike the SSE versions,
+    // this doesn't need to fall back to scalar code when a row mixes both encodings.
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const u8* row = src + 8 * xStep;
+        const __m128i texels = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)row),
+                                                  _mm_loadl_epi64((const __m128i*)(row + 32)));
+        const __m256i val = _mm256_cvtepu16_epi32(_mm_shuffle_epi8(texels, bswap16));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), DecodeRGB5A3_AVX2(val));
+      }
+    }
+    if (x < width)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m128i texels = _mm_loadl_epi64((const __m128i*)(src + 8 * xStep));
+        const __m256i val = _mm256_cvtepu16_epi32(_mm_shuffle_epi8(texels, bswap16));
+        _mm_storeu_si128((__m128i*)(dst + (y + iy) * width + x),
+                         _mm256_castsi256_si128(DecodeRGB5A3_AVX2(val)));
+      }
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGB5A3_SSSE3(u32* dst, const u8* src, int width, int height,
                                                TextureFormat texformat, const u8* tlut,
@@ -1001,6 +1263,58 @@ static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int
   }
 }
 
+// Decodes a 4x4 RGBA8 tile to (row 0, row 2) and (row 1, row 3).
+FUNCTION_TARGET_AVX2
+static inline void DecodeRGBA8Tile_AVX2(const u8* tile, __m256i* rows02, __m256i* rows13)
+{
+  const __m256i mask0312 =
+      _mm256_setr_epi8(2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12,  //
+                       2, 1, 3, 0, 6, 5, 7, 4, 10, 9, 11, 8, 14, 13, 15, 12);
+  const __m256i ar = _mm256_loadu_si256((const __m256i*)tile);
+  const __m256i gb = _mm256_loadu_si256((const __m256i*)tile + 1);
+  *rows02 = _mm256_shuffle_epi8(_mm256_unpacklo_epi8(ar, gb), mask0312);
+  *rows13 = _mm256_shuffle_epi8(_mm256_unpackhi_epi8(ar, gb), mask0312);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGBA8_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    int x = 0;
+    int yStep = (y / 4) * Wsteps4;
+    // Decode two horizontally adjacent tiles at once, so that each store writes a row of 8 texels.
+    for (; x + 8 <= width; x += 8, yStep += 2)
+    {
+      __m256i rows02_0, rows13_0, rows02_1, rows13_1;
+      DecodeRGBA8Tile_AVX2(src + 64 * yStep, &rows02_0, &rows13_0);
+      DecodeRGBA8Tile_AVX2(src + 64 * (yStep + 1), &rows02_1, &rows13_1);
+
+      u32* row = dst + y * width + x;
+      _mm256_storeu_si256((__m256i*)row, _mm256_permute2x128_si256(rows02_0, rows02_1, 0x20));
+      _mm256_storeu_si256((__m256i*)(row + width),
+                          _mm256_permute2x128_si256(rows13_0, rows13_1, 0x20));
+      _mm256_storeu_si256((__m256i*)(row + 2 * width),
+                          _mm256_permute2x128_si256(rows02_0, rows02_1, 0x31));
+      _mm256_storeu_si256((__m256i*)(row + 3 * width),
+                          _mm256_permute2x128_si256(rows13_0, rows13_1, 0x31));
+    }
+    if (x < width)
+    {
+      __m256i rows02, rows13;
+      DecodeRGBA8Tile_AVX2(src + 64 * yStep, &rows02, &rows13);
+
+      u32* row = dst + y * width + x;
+      _mm_storeu_si128((__m128i*)row, _mm256_castsi256_si128(rows02));
+      _mm_storeu_si128((__m128i*)(row + width), _mm256_castsi256_si128(rows13));
+      _mm_storeu_si128((__m128i*)(row + 2 * width), _mm256_extracti128_si256(rows02, 1));
+      _mm_storeu_si128((__m128i*)(row + 3 * width), _mm256_extracti128_si256(rows13, 1));
+    }
+  }
+}
+
 FUNCTION_TARGET_SSSE3
 static void TexDecoder_DecodeImpl_RGBA8_SSSE3(u32* dst, const u8* src, int width, int height,
                                               TextureFormat texformat, const u8* tlut,
@@ -1413,6 +1727,104 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// Blends one channel of the two colors of each DXT block, returning color 2 in the lanes of color1
+// and color 3 in the lanes of color2: (own * 5 + other * 3) / 8 if color1 > color2, otherwise the
+// average of both colors.
+FUNCTION_TARGET_AVX2
+static inline __m256i DXTBlend_AVX2(__m256i own, __m256i c1_greater)
+{
+  const __m256i other = _mm256_shuffle_epi32(own, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m256i sum = _mm256_add_epi32(own, other);
+  // own * 5 + other * 3 == own * 2 + sum * 3
+  const __m256i dxt = _mm256_srli_epi32(
+      _mm256_add_epi32(_mm256_slli_epi32(own, 1),
+                       _mm256_add_epi32(_mm256_slli_epi32(sum, 1), sum)),
+      3);
+  return _mm256_blendv_epi8(_mm256_srli_epi32(sum, 1), dxt, c1_greater);
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Decodes all four DXT blocks of an 8x8 tile at once. The palette of each block is built with
+  // one 32-bit lane per color, and the texels are then looked up 8 at a time with a permute
+  // instead of one at a time from memory.
+
+  // Byte-swapped color1 and color2 of each block, zero-extended to 32 bits.
+  const __m256i color_mask =
+      _mm256_setr_epi8(1, 0, -128, -128, 3, 2, -128, -128, 9, 8, -128, -128, 11, 10, -128, -128,  //
+                       1, 0, -128, -128, 3, 2, -128, -128, 9, 8, -128, -128, 11, 10, -128, -128);
+  // The 32-bit lanes holding the lines of the left and right block of the top and bottom half.
+  const __m256i top_lines = _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3);
+  const __m256i bottom_lines = _mm256_setr_epi32(5, 5, 5, 5, 7, 7, 7, 7);
+  // The first texel of a line is in the top 2 bits.
+  const __m256i index_shifts = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i right_block = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  const __m256i kMask_x03 = _mm256_set1_epi32(0x00000003L);
+  const __m256i kMask_x1f = _mm256_set1_epi32(0x0000001fL);
+  const __m256i kMask_x3f = _mm256_set1_epi32(0x0000003fL);
+  const __m256i aVxff00 = _mm256_set1_epi32(0xFF000000L);
+  // Color 3 is transparent if color1 <= color2.
+  const __m256i transparent_mask = _mm256_setr_epi32(-1, 0x00FFFFFF, -1, 0x00FFFFFF,  //
+                                                     -1, 0x00FFFFFF, -1, 0x00FFFFFF);
+
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      const __m256i blocks = _mm256_loadu_si256((const __m256i*)(src + 32 * yStep));
+
+      // (color1, color2) of each block, and the same with the colors of each block swapped.
+      const __m256i c = _mm256_shuffle_epi8(blocks, color_mask);
+      const __m256i c_other = _mm256_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1));
+      const __m256i c1_greater =
+          _mm256_shuffle_epi32(_mm256_cmpgt_epi32(c, c_other), _MM_SHUFFLE(2, 2, 0, 0));
+
+      const __m256i tmpr = _mm256_and_si256(_mm256_srli_epi32(c, 11), kMask_x1f);
+      const __m256i r = _mm256_or_si256(_mm256_slli_epi32(tmpr, 3), _mm256_srli_epi32(tmpr, 2));
+      const __m256i tmpg = _mm256_and_si256(_mm256_srli_epi32(c, 5), kMask_x3f);
+      const __m256i g = _mm256_or_si256(_mm256_slli_epi32(tmpg, 2), _mm256_srli_epi32(tmpg, 4));
+      const __m256i tmpb = _mm256_and_si256(c, kMask_x1f);
+      const __m256i b = _mm256_or_si256(_mm256_slli_epi32(tmpb, 3), _mm256_srli_epi32(tmpb, 2));
+      const __m256i colors01 = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                                               _mm256_or_si256(_mm256_slli_epi32(b, 16), aVxff00));
+
+      const __m256i r23 = DXTBlend_AVX2(r, c1_greater);
+      const __m256i g23 = DXTBlend_AVX2(g, c1_greater);
+      const __m256i b23 = DXTBlend_AVX2(b, c1_greater);
+      const __m256i colors23 =
+          _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(r23, _mm256_slli_epi32(g23, 8)),
+                                           _mm256_or_si256(_mm256_slli_epi32(b23, 16), aVxff00)),
+                           _mm256_or_si256(transparent_mask, c1_greater));
+
+      // Palettes of (top left, bottom left) and (top right, bottom right).
+      const __m256i palettes_left = _mm256_unpacklo_epi64(colors01, colors23);
+      const __m256i palettes_right = _mm256_unpackhi_epi64(colors01, colors23);
+      const __m256i palettes_top = _mm256_permute2x128_si256(palettes_left, palettes_right, 0x20);
+      const __m256i palettes_bottom =
+          _mm256_permute2x128_si256(palettes_left, palettes_right, 0x31);
+
+      const __m256i lines_top = _mm256_permutevar8x32_epi32(blocks, top_lines);
+      const __m256i lines_bottom = _mm256_permutevar8x32_epi32(blocks, bottom_lines);
+      for (int iy = 0; iy < 4; iy++)
+      {
+        const __m256i shifts = _mm256_add_epi32(index_shifts, _mm256_set1_epi32(8 * iy));
+        const __m256i index_top = _mm256_or_si256(
+            _mm256_and_si256(_mm256_srlv_epi32(lines_top, shifts), kMask_x03), right_block);
+        const __m256i index_bottom = _mm256_or_si256(
+            _mm256_and_si256(_mm256_srlv_epi32(lines_bottom, shifts), kMask_x03), right_block);
+
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x),
+                            _mm256_permutevar8x32_epi32(palettes_top, index_top));
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy + 4) * width + x),
+                            _mm256_permutevar8x32_epi32(palettes_bottom, index_bottom));
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1422,11 +1834,18 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1434,7 +1853,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_I8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                      Wsteps8);
     else
@@ -1442,7 +1864,11 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
@@ -1450,7 +1876,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_IA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                     Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                       Wsteps8);
     else
@@ -1469,7 +1898,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1478,7 +1910,10 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGBA8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                         Wsteps8);
     else
@@ -1487,7 +1922,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
@@ -75,7 +75,7 @@ void WriteLightingFunction(ShaderCode& out)
 void WriteVertexLighting(ShaderCode& out, APIType api_type, std::string_view world_pos_var,
                          std::string_view normal_var, std::string_view in_color_0_var,
                          std::string_view in_color_1_var, std::string_view out_color_0_var,
-                         std::string_view out_color_1_var)
+                         std::string_view out_color_1_var, bool lighting_enabled)
 {
   out.Write("// Lighting\n");
   out.Write("for (uint chan = 0u; chan < {}u; chan++) {{\n", NUM_XF_COLOR_CHANNELS);
@@ -96,54 +96,61 @@ void WriteVertexLighting(ShaderCode& out, APIType api_type, std::string_view wor
             "    mat.w = " I_MATERIALS " [chan + 2u].w;\n"
             "\n");
 
-  out.Write("  if ({} != 0u) {{\n", BitfieldExtract<&LitChannel::enablelighting>("colorreg"));
-  out.Write("    if ({} != 0u)\n", BitfieldExtract<&LitChannel::ambsource>("colorreg"));
-  out.Write("      lacc.xyz = int3(round(((chan == 0u) ? {}.xyz : {}.xyz) * 255.0));\n",
-            in_color_0_var, in_color_1_var);
-  out.Write("    else\n"
-            "      lacc.xyz = " I_MATERIALS " [chan].xyz;\n"
-            "\n");
-  out.Write("    uint light_mask = {} | ({} << 4u);\n",
-            BitfieldExtract<&LitChannel::lightMask0_3>("colorreg"),
-            BitfieldExtract<&LitChannel::lightMask4_7>("colorreg"));
-  out.Write("    uint attnfunc = {};\n", BitfieldExtract<&LitChannel::attnfunc>("colorreg"));
-  out.Write("    uint diffusefunc = {};\n", BitfieldExtract<&LitChannel::diffusefunc>("colorreg"));
-  out.Write(
-      "    for (uint light_index = 0u; light_index < 8u; light_index++) {{\n"
-      "      if ((light_mask & (1u << light_index)) != 0u)\n"
-      "        lacc.xyz += CalculateLighting(light_index, attnfunc, diffusefunc, {}, {}).xyz;\n",
-      world_pos_var, normal_var);
-  out.Write("    }}\n"
-            "  }}\n"
-            "\n");
+  // Without lighting, lacc stays at 255 and the color is the material color.
+  if (lighting_enabled)
+  {
+    out.Write("  if ({} != 0u) {{\n", BitfieldExtract<&LitChannel::enablelighting>("colorreg"));
+    out.Write("    if ({} != 0u)\n", BitfieldExtract<&LitChannel::ambsource>("colorreg"));
+    out.Write("      lacc.xyz = int3(round(((chan == 0u) ? {}.xyz : {}.xyz) * 255.0));\n",
+              in_color_0_var, in_color_1_var);
+    out.Write("    else\n"
+              "      lacc.xyz = " I_MATERIALS " [chan].xyz;\n"
+              "\n");
+    out.Write("    uint light_mask = {} | ({} << 4u);\n",
+              BitfieldExtract<&LitChannel::lightMask0_3>("colorreg"),
+              BitfieldExtract<&LitChannel::lightMask4_7>("colorreg"));
+    out.Write("    uint attnfunc = {};\n", BitfieldExtract<&LitChannel::attnfunc>("colorreg"));
+    out.Write("    uint diffusefunc = {};\n",
+              BitfieldExtract<&LitChannel::diffusefunc>("colorreg"));
+    out.Write(
+        "    for (uint light_index = 0u; light_index < 8u; light_index++) {{\n"
+        "      if ((light_mask & (1u << light_index)) != 0u)\n"
+        "        lacc.xyz += CalculateLighting(light_index, attnfunc, diffusefunc, {}, {}).xyz;\n",
+        world_pos_var, normal_var);
+    out.Write("    }}\n"
+              "  }}\n"
+              "\n");
 
-  out.Write("  if ({} != 0u) {{\n", BitfieldExtract<&LitChannel::enablelighting>("alphareg"));
-  out.Write("    if ({} != 0u) {{\n", BitfieldExtract<&LitChannel::ambsource>("alphareg"));
-  out.Write("      if ((components & ({}u << chan)) != 0u) // VB_HAS_COL0\n",
-            Common::ToUnderlying(VB_HAS_COL0));
-  out.Write("        lacc.w = int(round(((chan == 0u) ? {}.w : {}.w) * 255.0));\n", in_color_0_var,
-            in_color_1_var);
-  out.Write("      else if ((components & {}u) != 0u) // VB_HAS_COLO0\n",
-            Common::ToUnderlying(VB_HAS_COL0));
-  out.Write("        lacc.w = int(round({}.w * 255.0));\n", in_color_0_var);
-  out.Write("      else\n"
-            "        lacc.w = 255;\n"
-            "    }} else {{\n"
-            "      lacc.w = " I_MATERIALS " [chan].w;\n"
-            "    }}\n"
-            "\n");
-  out.Write("    uint light_mask = {} | ({} << 4u);\n",
-            BitfieldExtract<&LitChannel::lightMask0_3>("alphareg"),
-            BitfieldExtract<&LitChannel::lightMask4_7>("alphareg"));
-  out.Write("    uint attnfunc = {};\n", BitfieldExtract<&LitChannel::attnfunc>("alphareg"));
-  out.Write("    uint diffusefunc = {};\n", BitfieldExtract<&LitChannel::diffusefunc>("alphareg"));
-  out.Write("    for (uint light_index = 0u; light_index < 8u; light_index++) {{\n\n"
-            "      if ((light_mask & (1u << light_index)) != 0u)\n\n"
-            "        lacc.w += CalculateLighting(light_index, attnfunc, diffusefunc, {}, {}).w;\n",
-            world_pos_var, normal_var);
-  out.Write("    }}\n"
-            "  }}\n"
-            "\n");
+    out.Write("  if ({} != 0u) {{\n", BitfieldExtract<&LitChannel::enablelighting>("alphareg"));
+    out.Write("    if ({} != 0u) {{\n", BitfieldExtract<&LitChannel::ambsource>("alphareg"));
+    out.Write("      if ((components & ({}u << chan)) != 0u) // VB_HAS_COL0\n",
+              Common::ToUnderlying(VB_HAS_COL0));
+    out.Write("        lacc.w = int(round(((chan == 0u) ? {}.w : {}.w) * 255.0));\n",
+              in_color_0_var, in_color_1_var);
+    out.Write("      else if ((components & {}u) != 0u) // VB_HAS_COLO0\n",
+              Common::ToUnderlying(VB_HAS_COL0));
+    out.Write("        lacc.w = int(round({}.w * 255.0));\n", in_color_0_var);
+    out.Write("      else\n"
+              "        lacc.w = 255;\n"
+              "    }} else {{\n"
+              "      lacc.w = " I_MATERIALS " [chan].w;\n"
+              "    }}\n"
+              "\n");
+    out.Write("    uint light_mask = {} | ({} << 4u);\n",
+              BitfieldExtract<&LitChannel::lightMask0_3>("alphareg"),
+              BitfieldExtract<&LitChannel::lightMask4_7>("alphareg"));
+    out.Write("    uint attnfunc = {};\n", BitfieldExtract<&LitChannel::attnfunc>("alphareg"));
+    out.Write("    uint diffusefunc = {};\n",
+              BitfieldExtract<&LitChannel::diffusefunc>("alphareg"));
+    out.Write(
+        "    for (uint light_index = 0u; light_index < 8u; light_index++) {{\n\n"
+        "      if ((light_mask & (1u << light_index)) != 0u)\n\n"
+        "        lacc.w += CalculateLighting(light_index, attnfunc, diffusefunc, {}, {}).w;\n",
+        world_pos_var, normal_var);
+    out.Write("    }}\n"
+              "  }}\n"
+              "\n");
+  }
 
   out.Write("  lacc = clamp(lacc, 0, 255);\n"
             "\n"
@@ -16,5 +16,5 @@ void WriteLightingFunction(ShaderCode& out);
 void WriteVertexLighting(ShaderCode& out, APIType api_type, std::string_view world_pos_var,
                          std::string_view normal_var, std::string_view in_color_0_var,
                          std::string_view in_color_1_var, std::string_view out_color_0_var,
-                         std::string_view out_color_1_var);
+                         std::string_view out_color_1_var, bool lighting_enabled);
 }  // namespace UberShader
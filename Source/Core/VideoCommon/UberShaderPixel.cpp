@@ -3,6 +3,8 @@
 
 #include "VideoCommon/UberShaderPixel.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 
 #include "VideoCommon/BPMemory.h"
@@ -33,6 +35,35 @@ PixelShaderUid GetPixelShaderUid()
       (bpmem.zmode.test_enable && bpmem.genMode.zfreeze);
   uid_data->uint_output = bpmem.blendmode.UseLogicOp();
 
+  if (g_ActiveConfig.bSpecializeUberShaders)
+  {
+    uid_data->specialized = 1;
+    uid_data->num_tev_stages = bpmem.genMode.numtevstages;
+    uid_data->alpha_test = bpmem.alpha_test.TestResult() != AlphaTestResult::Pass;
+    // Lighting is only done in the pixel shader with per-pixel lighting.
+    uid_data->lighting = g_ActiveConfig.bEnablePixelLighting &&
+                         (std::ranges::any_of(xfmem.color, &LitChannel::enablelighting) ||
+                          std::ranges::any_of(xfmem.alpha, &LitChannel::enablelighting));
+  }
+
+  return out;
+}
+
+PixelShaderUid GetPixelShaderUid(const pixel_shader_uid_data& specialized_uid)
+{
+  PixelShaderUid out;
+
+  pixel_ubershader_uid_data* const uid_data = out.GetUidData();
+  uid_data->num_texgens = specialized_uid.genMode_numtexgens;
+  uid_data->early_depth = specialized_uid.ztest == EmulatedZ::ForcedEarly;
+  uid_data->per_pixel_depth = specialized_uid.per_pixel_depth;
+  uid_data->uint_output = specialized_uid.uint_output;
+  uid_data->specialized = 1;
+  uid_data->num_tev_stages = specialized_uid.genMode_numtevstages;
+  uid_data->alpha_test = specialized_uid.Pretest != AlphaTestResult::Pass;
+  // Only set with per-pixel lighting, which is the only case where the pixel shader needs it.
+  uid_data->lighting = specialized_uid.lighting.enablelighting != 0;
+
   return out;
 }
 
@@ -53,6 +84,20 @@ void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& hos
   // uint output when logic op is not supported (i.e. driver/device does not support D3D11.1).
   if (api_type != APIType::D3D || !host_config.backend_logic_op)
     uid_data->uint_output = 0;
+
+  if (!host_config.specialized_ubershaders)
+    ClearPixelShaderUidSpecialization(uid);
+  else if (!host_config.per_pixel_lighting)
+    uid_data->lighting = 0;
+}
+
+void ClearPixelShaderUidSpecialization(PixelShaderUid* uid)
+{
+  pixel_ubershader_uid_data* const uid_data = uid->GetUidData();
+  uid_data->specialized = 0;
+  uid_data->num_tev_stages = 0;
+  uid_data->alpha_test = 0;
+  uid_data->lighting = 0;
 }
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
@@ -68,6 +113,9 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   const bool per_pixel_depth = uid_data->per_pixel_depth != 0;
   const bool bounding_box = host_config.bounding_box;
   const u32 numTexgen = uid_data->num_texgens;
+  const bool specialized = uid_data->specialized != 0;
+  const bool alpha_test = !specialized || uid_data->alpha_test;
+  const bool lighting = !specialized || uid_data->lighting;
   ShaderCode out;
 
   ASSERT_MSG(VIDEO, !(use_dual_source && use_framebuffer_fetch),
@@ -573,8 +621,16 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   out.Write("void main()\n{{\n");
   out.Write("  float4 rawpos = gl_FragCoord;\n");
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  // A constant stage count lets the driver unroll the TEV loop.
+  if (specialized)
+  {
+    out.Write("  const uint num_stages = {}u;\n\n", uid_data->num_tev_stages);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   if (use_framebuffer_fetch)
   {
@@ -623,7 +679,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "  float3 lit_normal = normalize(Normal.xyz);\n"
               "  float3 lit_pos = WorldPos.xyz;\n");
     WriteVertexLighting(out, api_type, "lit_pos", "lit_normal", "colors_0", "colors_1",
-                        "lit_colors_0", "lit_colors_1");
+                        "lit_colors_0", "lit_colors_1", lighting);
     color_input_prefix = "lit_";
     out.Write("  // The number of colors available to TEV is determined by numColorChans.\n"
               "  // Normally this is performed in the vertex shader after lighting,\n"
@@ -1020,27 +1076,32 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
     out.Write("  #define discard_fragment discard\n");
   }
 
-  out.Write("  if (bpmem_alphaTest != 0u) {{\n"
-            "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
-            BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
-  out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
-            BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
-  out.Write("\n"
-            "    // These if statements are written weirdly to work around intel and Qualcomm "
-            "bugs with handling booleans.\n"
-            "    switch ({}) {{\n",
-            BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
-  out.Write("    case 0u: // AND\n"
-            "      if (comp0 && comp1) break; else discard_fragment; break;\n"
-            "    case 1u: // OR\n"
-            "      if (comp0 || comp1) break; else discard_fragment; break;\n"
-            "    case 2u: // XOR\n"
-            "      if (comp0 != comp1) break; else discard_fragment; break;\n"
-            "    case 3u: // XNOR\n"
-            "      if (comp0 == comp1) break; else discard_fragment; break;\n"
-            "    }}\n"
-            "  }}\n"
-            "\n");
+  // The alpha test uniform is zero when the test always passes, so the specialized shader can
+  // leave it out.
+  if (alpha_test)
+  {
+    out.Write("  if (bpmem_alphaTest != 0u) {{\n"
+              "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
+              BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
+    out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
+              BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
+    out.Write("\n"
+              "    // These if statements are written weirdly to work around intel and Qualcomm "
+              "bugs with handling booleans.\n"
+              "    switch ({}) {{\n",
+              BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
+    out.Write("    case 0u: // AND\n"
+              "      if (comp0 && comp1) break; else discard_fragment; break;\n"
+              "    case 1u: // OR\n"
+              "      if (comp0 || comp1) break; else discard_fragment; break;\n"
+              "    case 2u: // XOR\n"
+              "      if (comp0 != comp1) break; else discard_fragment; break;\n"
+              "    case 3u: // XNOR\n"
+              "      if (comp0 == comp1) break; else discard_fragment; break;\n"
+              "    }}\n"
+              "  }}\n"
+              "\n");
+  }
 
   out.Write("  // Hardware testing indicates that an alpha of 1 can pass an alpha test,\n"
             "  // but doesn't do anything in blending\n"
@@ -8,6 +8,7 @@
 #include "VideoCommon/ShaderGenCommon.h"
 
 enum class APIType;
+struct pixel_shader_uid_data;
 
 namespace UberShader
 {
@@ -20,6 +21,12 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Coarse state the shader can be specialized on, see ShaderHostConfig::specialized_ubershaders.
+  u32 specialized : 1;
+  u32 num_tev_stages : 4;
+  u32 alpha_test : 1;
+  u32 lighting : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -27,6 +34,8 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+// Returns the ubershader that can draw the same state as the specialized shader.
+PixelShaderUid GetPixelShaderUid(const pixel_shader_uid_data& specialized_uid);
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data);
@@ -34,6 +43,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 void EnumeratePixelShaderUids(const std::function<void(const PixelShaderUid&)>& callback);
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid);
+void ClearPixelShaderUidSpecialization(PixelShaderUid* uid);
 }  // namespace UberShader
 
 template <>
@@ -43,9 +53,15 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(
+    auto out = fmt::format_to(
         ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+    if (uid.specialized)
+    {
+      out = fmt::format_to(out, ", specialized for {} TEV stages{}{}", uid.num_tev_stages + 1,
+                           uid.alpha_test ? ", alpha test" : "", uid.lighting ? ", lighting" : "");
+    }
+    return out;
   }
 };
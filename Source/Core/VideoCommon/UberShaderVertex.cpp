@@ -3,6 +3,8 @@
 
 #include "VideoCommon/UberShaderVertex.h"
 
+#include <algorithm>
+
 #include "Common/EnumUtils.h"
 #include "VideoCommon/ConstantManager.h"
 #include "VideoCommon/DriverDetails.h"
@@ -10,6 +12,7 @@
 #include "VideoCommon/UberShaderCommon.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace UberShader
@@ -21,9 +24,35 @@ VertexShaderUid GetVertexShaderUid()
   vertex_ubershader_uid_data* const uid_data = out.GetUidData();
   uid_data->num_texgens = xfmem.numTexGen.numTexGens;
 
+  if (g_ActiveConfig.bSpecializeUberShaders)
+  {
+    uid_data->specialized = 1;
+    uid_data->lighting = std::ranges::any_of(xfmem.color, &LitChannel::enablelighting) ||
+                         std::ranges::any_of(xfmem.alpha, &LitChannel::enablelighting);
+  }
+
   return out;
 }
 
+VertexShaderUid GetVertexShaderUid(const vertex_shader_uid_data& specialized_uid)
+{
+  VertexShaderUid out;
+
+  vertex_ubershader_uid_data* const uid_data = out.GetUidData();
+  uid_data->num_texgens = specialized_uid.numTexGens;
+  uid_data->specialized = 1;
+  uid_data->lighting = specialized_uid.lighting.enablelighting != 0;
+
+  return out;
+}
+
+void ClearVertexShaderUidSpecialization(VertexShaderUid* uid)
+{
+  vertex_ubershader_uid_data* const uid_data = uid->GetUidData();
+  uid_data->specialized = 0;
+  uid_data->lighting = 0;
+}
+
 static void GenVertexShaderTexGens(APIType api_type, const ShaderHostConfig& host_config,
                                    u32 num_texgen, ShaderCode& out);
 static void LoadVertexAttribute(ShaderCode& code, const ShaderHostConfig& host_config, u32 indent,
@@ -43,17 +72,17 @@ ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config
   ShaderCode out;
 
   out.Write("// {}\n\n", *uid_data);
-  out.Write("{}", s_lighting_struct);
+  out.Append(s_lighting_struct);
 
   // uniforms
   out.Write("UBO_BINDING(std140, 2) uniform VSBlock {{\n");
-  out.Write("{}", s_shader_uniforms);
+  out.Append(s_shader_uniforms);
   out.Write("}};\n");
 
   if (vertex_loader)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
-    out.Write("{}", s_geometry_shader_uniforms);
+    out.Append(s_geometry_shader_uniforms);
     out.Write("}};\n");
   }
 
@@ -339,7 +368,8 @@ float3 load_input_float3_rawtex(uint vtx_offset, uint attr_offset) {{
             "}}\n");
 
   WriteVertexLighting(out, api_type, "pos.xyz", "_normal", "vertex_color_0", "vertex_color_1",
-                      "o.colors_0", "o.colors_1");
+                      "o.colors_0", "o.colors_1",
+                      !uid_data->specialized || uid_data->lighting);
 
   // Texture Coordinates
   if (num_texgen > 0)
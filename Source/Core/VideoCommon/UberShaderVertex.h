@@ -6,6 +6,8 @@
 #include <functional>
 #include "VideoCommon/PixelShaderGen.h"
 
+struct vertex_shader_uid_data;
+
 namespace UberShader
 {
 #pragma pack(1)
@@ -13,6 +15,10 @@ struct vertex_ubershader_uid_data
 {
   u32 num_texgens : 4;
 
+  // Coarse state the shader can be specialized on, see ShaderHostConfig::specialized_ubershaders.
+  u32 specialized : 1;
+  u32 lighting : 1;
+
   u32 NumValues() const { return sizeof(vertex_ubershader_uid_data); }
 };
 #pragma pack()
@@ -20,10 +26,13 @@ struct vertex_ubershader_uid_data
 using VertexShaderUid = ShaderUid<vertex_ubershader_uid_data>;
 
 VertexShaderUid GetVertexShaderUid();
+// Returns the ubershader that can draw the same state as the specialized shader.
+VertexShaderUid GetVertexShaderUid(const vertex_shader_uid_data& specialized_uid);
 
 ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config,
                            const vertex_ubershader_uid_data* uid_data);
 void EnumerateVertexShaderUids(const std::function<void(const VertexShaderUid&)>& callback);
+void ClearVertexShaderUidSpecialization(VertexShaderUid* uid);
 }  // namespace UberShader
 
 template <>
@@ -33,6 +42,9 @@ struct fmt::formatter<UberShader::vertex_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::vertex_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(ctx.out(), "Vertex UberShader for {} texgens", uid.num_texgens);
+    return fmt::format_to(ctx.out(), "Vertex UberShader for {} texgens{}", uid.num_texgens,
+                          !uid.specialized ? "" :
+                          uid.lighting     ? ", specialized with lighting" :
+                                             ", specialized without lighting");
   }
 };
@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -24,7 +25,10 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CommandStream.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/GeometryCache.h"
+#include "VideoCommon/GPUStageTimer.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
@@ -47,10 +51,13 @@ alignas(sizeof(std::array<float, 4>)) std::array<float, 4> binormal_cache;
 static NativeVertexFormatMap s_native_vertex_map;
 static NativeVertexFormat* s_current_vtx_fmt;
 u32 g_current_components;
+static ZFreezeVertices s_zfreeze_vertices;
+static VertexLoaderBase* s_last_checked_loader;
 
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
+static VideoCommon::GeometryCache s_geometry_cache;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
@@ -61,6 +68,7 @@ bool g_bases_dirty;  // Main only
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 bool g_needs_cp_xf_consistency_check;
+bool g_in_display_list;
 
 void Init()
 {
@@ -75,6 +83,8 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+  s_last_checked_loader = nullptr;
+  s_geometry_cache.Clear();
 }
 
 void UpdateVertexArrayPointers()
@@ -217,17 +227,14 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
 
   VertexLoaderBase* loader;
 
-  // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
-  // thread
-  bool check_for_native_format = !IsPreprocess;
-
+  // The native vertex format is only looked up when vertices are submitted, as loaders are also
+  // created on threads that may not use the backend (preprocessing, pipelined decoding).
   VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
   if (iter != s_vertex_loader_map.end())
   {
     loader = iter->second.get();
-    check_for_native_format &= !loader->m_native_vertex_format;
   }
   else
   {
@@ -237,11 +244,6 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
   }
-  if (check_for_native_format)
-  {
-    // search for a cached native vertex format
-    loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
-  }
   vertex_loaders[vtx_attr_group] = loader;
   attr_dirty[vtx_attr_group] = false;
   return loader;
@@ -249,20 +251,20 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
 
 }  // namespace detail
 
-static void CheckCPConfiguration(int vtx_attr_group)
+static void CheckCPConfiguration(const TVtxDesc& vtx_desc, const VAT& vtx_attr, int vtx_attr_group)
 {
   // Validate that the XF input configuration matches the CP configuration
-  u32 num_cp_colors = std::count_if(
-      g_main_cp_state.vtx_desc.low.Color.begin(), g_main_cp_state.vtx_desc.low.Color.end(),
-      [](auto format) { return format != VertexComponentFormat::NotPresent; });
-  u32 num_cp_tex_coords = std::count_if(
-      g_main_cp_state.vtx_desc.high.TexCoord.begin(), g_main_cp_state.vtx_desc.high.TexCoord.end(),
-      [](auto format) { return format != VertexComponentFormat::NotPresent; });
+  u32 num_cp_colors =
+      std::count_if(vtx_desc.low.Color.begin(), vtx_desc.low.Color.end(),
+                    [](auto format) { return format != VertexComponentFormat::NotPresent; });
+  u32 num_cp_tex_coords =
+      std::count_if(vtx_desc.high.TexCoord.begin(), vtx_desc.high.TexCoord.end(),
+                    [](auto format) { return format != VertexComponentFormat::NotPresent; });
 
   u32 num_cp_normals;
-  if (g_main_cp_state.vtx_desc.low.Normal == VertexComponentFormat::NotPresent)
+  if (vtx_desc.low.Normal == VertexComponentFormat::NotPresent)
     num_cp_normals = 0;
-  else if (g_main_cp_state.vtx_attr[vtx_attr_group].g0.NormalElements == NormalComponentCount::NTB)
+  else if (vtx_attr.g0.NormalElements == NormalComponentCount::NTB)
     num_cp_normals = 3;
   else
     num_cp_normals = 1;
@@ -290,11 +292,9 @@ static void CheckCPConfiguration(int vtx_attr_group)
                   "VCD: {:08x} {:08x}\nVAT {}: {:08x} {:08x} {:08x}\nXF vertex spec: {:08x}",
                   num_cp_colors, xfmem.invtxspec.numcolors, num_cp_normals,
                   num_xf_normals.has_value() ? fmt::to_string(num_xf_normals.value()) : "invalid",
-                  num_cp_tex_coords, xfmem.invtxspec.numtextures, g_main_cp_state.vtx_desc.low.Hex,
-                  g_main_cp_state.vtx_desc.high.Hex, vtx_attr_group,
-                  g_main_cp_state.vtx_attr[vtx_attr_group].g0.Hex,
-                  g_main_cp_state.vtx_attr[vtx_attr_group].g1.Hex,
-                  g_main_cp_state.vtx_attr[vtx_attr_group].g2.Hex, xfmem.invtxspec.hex);
+                  num_cp_tex_coords, xfmem.invtxspec.numtextures, vtx_desc.low.Hex,
+                  vtx_desc.high.Hex, vtx_attr_group, vtx_attr.g0.Hex, vtx_attr.g1.Hex,
+                  vtx_attr.g2.Hex, xfmem.invtxspec.hex);
 
     // Analytics reporting so we can discover which games have this problem, that way when we
     // eventually simulate the behavior we have test cases for it.
@@ -327,52 +327,53 @@ static void CheckCPConfiguration(int vtx_attr_group)
         GameQuirk::MismatchedGPUMatrixIndicesBetweenCPAndXF);
   }
 
-  if (g_main_cp_state.vtx_attr[vtx_attr_group].g0.PosFormat >= ComponentFormat::InvalidFloat5)
+  if (vtx_attr.g0.PosFormat >= ComponentFormat::InvalidFloat5)
   {
     WARN_LOG_FMT(VIDEO, "Invalid position format {} for VAT {} - {:08x} {:08x} {:08x}",
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g0.PosFormat, vtx_attr_group,
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g0.Hex,
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g1.Hex,
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g2.Hex);
+                 vtx_attr.g0.PosFormat, vtx_attr_group, vtx_attr.g0.Hex, vtx_attr.g1.Hex,
+                 vtx_attr.g2.Hex);
     DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::InvalidPositionComponentFormat);
   }
-  if (g_main_cp_state.vtx_attr[vtx_attr_group].g0.NormalFormat >= ComponentFormat::InvalidFloat5)
+  if (vtx_attr.g0.NormalFormat >= ComponentFormat::InvalidFloat5)
   {
     WARN_LOG_FMT(VIDEO, "Invalid normal format {} for VAT {} - {:08x} {:08x} {:08x}",
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g0.NormalFormat, vtx_attr_group,
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g0.Hex,
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g1.Hex,
-                 g_main_cp_state.vtx_attr[vtx_attr_group].g2.Hex);
+                 vtx_attr.g0.NormalFormat, vtx_attr_group, vtx_attr.g0.Hex, vtx_attr.g1.Hex,
+                 vtx_attr.g2.Hex);
     DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::InvalidNormalComponentFormat);
   }
   for (size_t i = 0; i < 8; i++)
   {
-    if (g_main_cp_state.vtx_attr[vtx_attr_group].GetTexFormat(i) >= ComponentFormat::InvalidFloat5)
+    if (vtx_attr.GetTexFormat(i) >= ComponentFormat::InvalidFloat5)
     {
       WARN_LOG_FMT(VIDEO,
                    "Invalid texture coordinate {} format {} for VAT {} - {:08x} {:08x} {:08x}", i,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].GetTexFormat(i), vtx_attr_group,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].g0.Hex,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].g1.Hex,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].g2.Hex);
+                   vtx_attr.GetTexFormat(i), vtx_attr_group, vtx_attr.g0.Hex, vtx_attr.g1.Hex,
+                   vtx_attr.g2.Hex);
       DolphinAnalytics::Instance().ReportGameQuirk(
           GameQuirk::InvalidTextureCoordinateComponentFormat);
     }
   }
   for (size_t i = 0; i < 2; i++)
   {
-    if (g_main_cp_state.vtx_attr[vtx_attr_group].GetColorFormat(i) > ColorFormat::RGBA8888)
+    if (vtx_attr.GetColorFormat(i) > ColorFormat::RGBA8888)
     {
       WARN_LOG_FMT(VIDEO, "Invalid color {} format {} for VAT {} - {:08x} {:08x} {:08x}", i,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].GetColorFormat(i), vtx_attr_group,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].g0.Hex,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].g1.Hex,
-                   g_main_cp_state.vtx_attr[vtx_attr_group].g2.Hex);
+                   vtx_attr.GetColorFormat(i), vtx_attr_group, vtx_attr.g0.Hex, vtx_attr.g1.Hex,
+                   vtx_attr.g2.Hex);
       DolphinAnalytics::Instance().ReportGameQuirk(GameQuirk::InvalidColorComponentFormat);
     }
   }
 }
 
+static int LoadVertices(VertexLoaderBase* loader, int vtx_attr_group, const u8* src, u8* dst,
+                        int count, bool use_geometry_cache)
+{
+  if (use_geometry_cache && VideoCommon::GeometryCache::ShouldCache(count))
+    return s_geometry_cache.RunVertices(loader, vtx_attr_group, src, dst, count);
+
+  return loader->RunVertices(src, dst, count);
+}
+
 static bool CanSplit(OpcodeDecoder::Primitive primitive)
 {
   // Splitting is currently only implemented for the easy cases (individual lines/points/triangles)
@@ -389,6 +390,69 @@ static bool CanSplit(OpcodeDecoder::Primitive primitive)
   }
 }
 
+// Max is 16383, but 16380 is divisible by both 4 and 3
+constexpr int MAX_VERTICES_PER_RUN = 16380;
+
+static void SetVertexFormat(VertexLoaderBase* loader)
+{
+  if (!loader->m_native_vertex_format) [[unlikely]]
+    loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
+
+  // If the native vertex format changed, force a flush.
+  if (loader->m_native_vertex_format != s_current_vtx_fmt ||
+      loader->m_native_components != g_current_components) [[unlikely]]
+  {
+    g_vertex_manager->Flush();
+
+    s_current_vtx_fmt = loader->m_native_vertex_format;
+    g_current_components = loader->m_native_components;
+    auto& system = Core::System::GetInstance();
+    auto& vertex_shader_manager = system.GetVertexShaderManager();
+    vertex_shader_manager.SetVertexFormat(loader->m_native_components,
+                                          loader->m_native_vertex_format->GetVertexDeclaration());
+  }
+}
+
+// CPUCull's performance increase comes from encoding fewer GPU commands, not sending less data
+// Therefore it's only useful to check if culling could remove a flush
+static bool CanCPUCull(OpcodeDecoder::Primitive primitive)
+{
+  return g_ActiveConfig.bCPUCull && primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
+         !g_vertex_manager->HasSendableVertices();
+}
+
+// if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
+// They still need to go through vertex loading, because we need to calculate a zfreeze
+// reference slope.
+static bool IsCullAll(OpcodeDecoder::Primitive primitive)
+{
+  return bpmem.genMode.cull_mode == CullMode::All &&
+         primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES;
+}
+
+// Adds vertices that were loaded to dst, as returned by PrepareForAdditionalData, to the batch.
+static void AddLoadedVertices(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                              DataReader dst, int num_loaded, bool cullall, bool* can_cpu_cull)
+{
+  const int stride = loader->m_native_vtx_decl.stride;
+  if (*can_cpu_cull && !cullall)
+  {
+    const bool all_culled =
+        g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), num_loaded);
+    if (!all_culled)
+    {
+      DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
+      memmove(new_dst.GetPointer(), dst.GetPointer(), num_loaded * stride);
+      *can_cpu_cull = false;
+    }
+  }
+
+  g_vertex_manager->AddIndices(primitive, num_loaded);
+  g_vertex_manager->FlushData(num_loaded, stride);
+
+  ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
+}
+
 template <bool IsPreprocess>
 int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
 {
@@ -405,66 +469,36 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     // Doing early return for the opposite case would be cleaner
     // but triggers a false unreachable code warning in MSVC debug builds.
 
+    VideoCommon::ScopedGPUStageTimer load_timer(VideoCommon::GPUStage::VertexLoading);
+
     if (g_needs_cp_xf_consistency_check) [[unlikely]]
     {
-      CheckCPConfiguration(vtx_attr_group);
+      CheckCPConfiguration(g_main_cp_state.vtx_desc, g_main_cp_state.vtx_attr[vtx_attr_group],
+                           vtx_attr_group);
       g_needs_cp_xf_consistency_check = false;
     }
 
-    // If the native vertex format changed, force a flush.
-    if (loader->m_native_vertex_format != s_current_vtx_fmt ||
-        loader->m_native_components != g_current_components) [[unlikely]]
-    {
-      g_vertex_manager->Flush();
-
-      s_current_vtx_fmt = loader->m_native_vertex_format;
-      g_current_components = loader->m_native_components;
-      auto& system = Core::System::GetInstance();
-      auto& vertex_shader_manager = system.GetVertexShaderManager();
-      vertex_shader_manager.SetVertexFormat(loader->m_native_components,
-                                            loader->m_native_vertex_format->GetVertexDeclaration());
-    }
-
-    // CPUCull's performance increase comes from encoding fewer GPU commands, not sending less data
-    // Therefore it's only useful to check if culling could remove a flush
-    bool can_cpu_cull = g_ActiveConfig.bCPUCull &&
-                        primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
-                        !g_vertex_manager->HasSendableVertices();
+    SetVertexFormat(loader);
 
-    // if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
-    // They still need to go through vertex loading, because we need to calculate a zfreeze
-    // reference slope.
-    const bool cullall = (bpmem.genMode.cull_mode == CullMode::All &&
-                          primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
+    bool can_cpu_cull = CanCPUCull(primitive);
+    const bool cullall = IsCullAll(primitive);
+    const bool use_geometry_cache = g_in_display_list && g_ActiveConfig.bGeometryCache;
 
     const int stride = loader->m_native_vtx_decl.stride;
     do
     {
-      const int max_vertices = 16380;  // Max is 16383, but 16380 is divisible by both 4 and 3
-      const int run = CanSplit(primitive) && count > max_vertices ? max_vertices : count;
+      const int run =
+          CanSplit(primitive) && count > MAX_VERTICES_PER_RUN ? MAX_VERTICES_PER_RUN : count;
       count -= run;
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
-      src += loader->m_vertex_size * max_vertices;
-
-      if (can_cpu_cull && !cullall)
-      {
-        const bool all_culled =
-            g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), num_loaded);
-        if (!all_culled)
-        {
-          DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
-          memmove(new_dst.GetPointer(), dst.GetPointer(), num_loaded * stride);
-          can_cpu_cull = false;
-        }
-      }
-
-      g_vertex_manager->AddIndices(primitive, num_loaded);
-      g_vertex_manager->FlushData(num_loaded, stride);
-
-      ADDSTAT(g_stats.this_frame.num_prims, num_loaded);
+      const int num_loaded =
+          LoadVertices(loader, vtx_attr_group, src, dst.GetPointer(), run, use_geometry_cache);
+      src += loader->m_vertex_size * MAX_VERTICES_PER_RUN;
+      s_zfreeze_vertices = {position_cache, position_matrix_index_cache};
+
+      AddLoadedVertices(loader, primitive, dst, num_loaded, cullall, &can_cpu_cull);
     } while (count);
 
     INCSTAT(g_stats.this_frame.num_primitive_joins);
@@ -472,6 +506,74 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
   return size;
 }
 
+int LoadVerticesForSubmission(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
+                              const u8* src, VideoCommon::CommandStream& stream,
+                              bool use_geometry_cache)
+{
+  if (count == 0) [[unlikely]]
+    return 0;
+  ASSERT(count > 0);
+
+  VideoCommon::ScopedGPUStageTimer load_timer(VideoCommon::GPUStage::VertexLoading);
+
+  VertexLoaderBase* loader = RefreshLoader(vtx_attr_group);
+  const int size = count * loader->m_vertex_size;
+  const int stride = loader->m_native_vtx_decl.stride;
+
+  // Split the same way as RunVertices, so that every draw fits in a vertex manager batch.
+  do
+  {
+    const int run =
+        CanSplit(primitive) && count > MAX_VERTICES_PER_RUN ? MAX_VERTICES_PER_RUN : count;
+    count -= run;
+
+    VideoCommon::LoadedDraw& draw = stream.AddDraw(run * stride);
+    draw.num_loaded = LoadVertices(loader, vtx_attr_group, src, stream.GetVertexData(draw), run,
+                                   use_geometry_cache);
+    src += loader->m_vertex_size * run;
+
+    draw.loader = loader;
+    draw.vtx_desc.low.Hex = g_main_cp_state.vtx_desc.low.Hex;
+    draw.vtx_desc.high.Hex = g_main_cp_state.vtx_desc.high.Hex;
+    draw.vtx_attr.g0.Hex = g_main_cp_state.vtx_attr[vtx_attr_group].g0.Hex;
+    draw.vtx_attr.g1.Hex = g_main_cp_state.vtx_attr[vtx_attr_group].g1.Hex;
+    draw.vtx_attr.g2.Hex = g_main_cp_state.vtx_attr[vtx_attr_group].g2.Hex;
+    draw.zfreeze_vertices = {position_cache, position_matrix_index_cache};
+    draw.count = run;
+    draw.vtx_attr_group = static_cast<u8>(vtx_attr_group);
+    draw.primitive = primitive;
+  } while (count);
+
+  return size;
+}
+
+void SubmitLoadedVertices(const VideoCommon::LoadedDraw& draw, const u8* vertices)
+{
+  // CP state changes are applied on the decode thread, so a new loader is what tells that the
+  // vertex format might have changed.
+  VertexLoaderBase* loader = draw.loader;
+  if (g_needs_cp_xf_consistency_check || loader != s_last_checked_loader) [[unlikely]]
+  {
+    CheckCPConfiguration(draw.vtx_desc, draw.vtx_attr, draw.vtx_attr_group);
+    g_needs_cp_xf_consistency_check = false;
+    s_last_checked_loader = loader;
+  }
+
+  SetVertexFormat(loader);
+
+  bool can_cpu_cull = CanCPUCull(draw.primitive);
+  const bool cullall = IsCullAll(draw.primitive);
+  const int stride = loader->m_native_vtx_decl.stride;
+  DataReader dst = g_vertex_manager->PrepareForAdditionalData(draw.primitive, draw.count, stride,
+                                                              cullall || can_cpu_cull);
+  std::memcpy(dst.GetPointer(), vertices, draw.num_loaded * stride);
+  s_zfreeze_vertices = draw.zfreeze_vertices;
+
+  AddLoadedVertices(loader, draw.primitive, dst, draw.num_loaded, cullall, &can_cpu_cull);
+
+  INCSTAT(g_stats.this_frame.num_primitive_joins);
+}
+
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
                                 const u8* src);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
@@ -482,4 +584,9 @@ NativeVertexFormat* GetCurrentVertexFormat()
   return s_current_vtx_fmt;
 }
 
+const ZFreezeVertices& GetZFreezeVertices()
+{
+  return s_zfreeze_vertices;
+}
+
 }  // namespace VertexLoaderManager
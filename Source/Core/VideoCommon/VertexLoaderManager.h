@@ -19,6 +19,11 @@ namespace OpcodeDecoder
 {
 enum class Primitive : u8;
 }
+namespace VideoCommon
+{
+class CommandStream;
+struct LoadedDraw;
+}  // namespace VideoCommon
 
 namespace VertexLoaderManager
 {
@@ -44,6 +49,14 @@ NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 template <bool IsPreprocess = false>
 int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
 
+// Pipelined GPU thread: RunVertices is split into LoadVerticesForSubmission, which runs the vertex
+// loader on the decode thread and records the result in stream, and SubmitLoadedVertices, which
+// adds it to the vertex manager on the GPU thread.
+int LoadVerticesForSubmission(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
+                              const u8* src, VideoCommon::CommandStream& stream,
+                              bool use_geometry_cache);
+void SubmitLoadedVertices(const VideoCommon::LoadedDraw& draw, const u8* vertices);
+
 namespace detail
 {
 // This will look for an existing loader in the global hashmap or create a new one if there is none.
@@ -54,6 +67,16 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group);
 
 NativeVertexFormat* GetCurrentVertexFormat();
 
+// Copy of the position cache below as of the last primitive that was submitted to the vertex
+// manager, for the zfreeze slope. With the pipelined GPU thread, the vertex loaders may already
+// have overwritten the position cache with later primitives.
+struct ZFreezeVertices
+{
+  std::array<std::array<float, 4>, 3> positions;
+  std::array<u32, 3> matrix_indices;
+};
+const ZFreezeVertices& GetZFreezeVertices();
+
 // Resolved pointers to array bases. Used by vertex loaders.
 extern Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 void UpdateVertexArrayPointers();
@@ -80,6 +103,8 @@ extern bool g_bases_dirty;  // Main only
 extern std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 extern std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 extern bool g_needs_cp_xf_consistency_check;
+// Main only. Primitives in display lists are eligible for the geometry cache.
+extern bool g_in_display_list;
 
 template <bool IsPreprocess = false>
 VertexLoaderBase* RefreshLoader(int vtx_attr_group)
@@ -6,6 +6,8 @@
 #include <array>
 #include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Common/BitSet.h"
 #include "Common/CPUDetect.h"
@@ -43,6 +45,70 @@ static OpArg MPIC(const void* ptr)
   return MDisp(base_reg, PtrOffset(ptr, memory_base_ptr));
 }
 
+using ShuffleRow = std::array<__m128i, 3>;
+static const Common::EnumMap<ShuffleRow, ComponentFormat::InvalidFloat7> shuffle_lut = {
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFF00L),   // 1x u8
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFF01L, 0xFFFFFF00L),   // 2x u8
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFF02L, 0xFFFFFF01L, 0xFFFFFF00L)},  // 3x u8
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00FFFFFFL),   // 1x s8
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x01FFFFFFL, 0x00FFFFFFL),   // 2x s8
+               _mm_set_epi32(0xFFFFFFFFL, 0x02FFFFFFL, 0x01FFFFFFL, 0x00FFFFFFL)},  // 3x s8
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFF0001L),   // 1x u16
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFF0203L, 0xFFFF0001L),   // 2x u16
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFF0405L, 0xFFFF0203L, 0xFFFF0001L)},  // 3x u16
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x0001FFFFL),   // 1x s16
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x0203FFFFL, 0x0001FFFFL),   // 2x s16
+               _mm_set_epi32(0xFFFFFFFFL, 0x0405FFFFL, 0x0203FFFFL, 0x0001FFFFL)},  // 3x s16
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x float
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x float
+               _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x float
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x invalid
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x invalid
+               _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x invalid
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x invalid
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x invalid
+               _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x invalid
+    ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x invalid
+               _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x invalid
+               _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x invalid
+};
+static const __m128 scale_factors[32] = {
+    _mm_set_ps1(1. / (1u << 0)),  _mm_set_ps1(1. / (1u << 1)),  _mm_set_ps1(1. / (1u << 2)),
+    _mm_set_ps1(1. / (1u << 3)),  _mm_set_ps1(1. / (1u << 4)),  _mm_set_ps1(1. / (1u << 5)),
+    _mm_set_ps1(1. / (1u << 6)),  _mm_set_ps1(1. / (1u << 7)),  _mm_set_ps1(1. / (1u << 8)),
+    _mm_set_ps1(1. / (1u << 9)),  _mm_set_ps1(1. / (1u << 10)), _mm_set_ps1(1. / (1u << 11)),
+    _mm_set_ps1(1. / (1u << 12)), _mm_set_ps1(1. / (1u << 13)), _mm_set_ps1(1. / (1u << 14)),
+    _mm_set_ps1(1. / (1u << 15)), _mm_set_ps1(1. / (1u << 16)), _mm_set_ps1(1. / (1u << 17)),
+    _mm_set_ps1(1. / (1u << 18)), _mm_set_ps1(1. / (1u << 19)), _mm_set_ps1(1. / (1u << 20)),
+    _mm_set_ps1(1. / (1u << 21)), _mm_set_ps1(1. / (1u << 22)), _mm_set_ps1(1. / (1u << 23)),
+    _mm_set_ps1(1. / (1u << 24)), _mm_set_ps1(1. / (1u << 25)), _mm_set_ps1(1. / (1u << 26)),
+    _mm_set_ps1(1. / (1u << 27)), _mm_set_ps1(1. / (1u << 28)), _mm_set_ps1(1. / (1u << 29)),
+    _mm_set_ps1(1. / (1u << 30)), _mm_set_ps1(1. / (1u << 31)),
+};
+
+// The AVX2 loop converts two vertices at once, one in each 128-bit lane, so it needs the same
+// constants in both lanes.
+using LanePair128 = std::array<__m128i, 2>;
+using LanePairPS = std::array<__m128, 2>;
+static const auto shuffle_lut_x2 = [] {
+  Common::EnumMap<std::array<LanePair128, 3>, ComponentFormat::InvalidFloat7> lut;
+  for (size_t format = 0; format < lut.size(); format++)
+  {
+    for (size_t i = 0; i < 3; i++)
+    {
+      const __m128i row = shuffle_lut[static_cast<ComponentFormat>(format)][i];
+      lut[static_cast<ComponentFormat>(format)][i] = {row, row};
+    }
+  }
+  return lut;
+}();
+static const auto scale_factors_x2 = [] {
+  std::array<LanePairPS, 32> factors;
+  for (size_t i = 0; i < factors.size(); i++)
+    factors[i] = {scale_factors[i], scale_factors[i]};
+  return factors;
+}();
+
 VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att)
     : VertexLoaderBase(vtx_desc, vtx_att)
 {
@@ -82,47 +148,6 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
                                  bool dequantize, u8 scaling_exponent,
                                  AttributeFormat* native_format)
 {
-  using ShuffleRow = std::array<__m128i, 3>;
-  static const Common::EnumMap<ShuffleRow, ComponentFormat::InvalidFloat7> shuffle_lut = {
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFF00L),   // 1x u8
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFF01L, 0xFFFFFF00L),   // 2x u8
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFF02L, 0xFFFFFF01L, 0xFFFFFF00L)},  // 3x u8
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00FFFFFFL),   // 1x s8
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x01FFFFFFL, 0x00FFFFFFL),   // 2x s8
-                 _mm_set_epi32(0xFFFFFFFFL, 0x02FFFFFFL, 0x01FFFFFFL, 0x00FFFFFFL)},  // 3x s8
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFF0001L),   // 1x u16
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFF0203L, 0xFFFF0001L),   // 2x u16
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFF0405L, 0xFFFF0203L, 0xFFFF0001L)},  // 3x u16
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x0001FFFFL),   // 1x s16
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x0203FFFFL, 0x0001FFFFL),   // 2x s16
-                 _mm_set_epi32(0xFFFFFFFFL, 0x0405FFFFL, 0x0203FFFFL, 0x0001FFFFL)},  // 3x s16
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x float
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x float
-                 _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x float
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x invalid
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x invalid
-                 _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x invalid
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x invalid
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x invalid
-                 _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x invalid
-      ShuffleRow{_mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0xFFFFFFFFL, 0x00010203L),   // 1x invalid
-                 _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x invalid
-                 _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x invalid
-  };
-  static const __m128 scale_factors[32] = {
-      _mm_set_ps1(1. / (1u << 0)),  _mm_set_ps1(1. / (1u << 1)),  _mm_set_ps1(1. / (1u << 2)),
-      _mm_set_ps1(1. / (1u << 3)),  _mm_set_ps1(1. / (1u << 4)),  _mm_set_ps1(1. / (1u << 5)),
-      _mm_set_ps1(1. / (1u << 6)),  _mm_set_ps1(1. / (1u << 7)),  _mm_set_ps1(1. / (1u << 8)),
-      _mm_set_ps1(1. / (1u << 9)),  _mm_set_ps1(1. / (1u << 10)), _mm_set_ps1(1. / (1u << 11)),
-      _mm_set_ps1(1. / (1u << 12)), _mm_set_ps1(1. / (1u << 13)), _mm_set_ps1(1. / (1u << 14)),
-      _mm_set_ps1(1. / (1u << 15)), _mm_set_ps1(1. / (1u << 16)), _mm_set_ps1(1. / (1u << 17)),
-      _mm_set_ps1(1. / (1u << 18)), _mm_set_ps1(1. / (1u << 19)), _mm_set_ps1(1. / (1u << 20)),
-      _mm_set_ps1(1. / (1u << 21)), _mm_set_ps1(1. / (1u << 22)), _mm_set_ps1(1. / (1u << 23)),
-      _mm_set_ps1(1. / (1u << 24)), _mm_set_ps1(1. / (1u << 25)), _mm_set_ps1(1. / (1u << 26)),
-      _mm_set_ps1(1. / (1u << 27)), _mm_set_ps1(1. / (1u << 28)), _mm_set_ps1(1. / (1u << 29)),
-      _mm_set_ps1(1. / (1u << 30)), _mm_set_ps1(1. / (1u << 31)),
-  };
-
   X64Reg coords = XMM0;
 
   const auto write_zfreeze = [&] {  // zfreeze
@@ -172,6 +197,14 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
   native_format->type = ComponentFormat::Float;
   native_format->integer = false;
 
+  m_paired_attributes.push_back({.data = data,
+                                 .dst_ofs = m_dst_ofs,
+                                 .format = format,
+                                 .count_in = count_in,
+                                 .count_out = count_out,
+                                 .dequantize = dequantize,
+                                 .scaling_exponent = scaling_exponent});
+
   m_dst_ofs += sizeof(float) * count_out;
 
   if (attribute == VertexComponentFormat::Direct)
@@ -300,6 +333,9 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
 
 void VertexLoaderX64::ReadColor(OpArg data, VertexComponentFormat attribute, ColorFormat format)
 {
+  m_paired_attributes.push_back(
+      {.data = data, .dst_ofs = m_dst_ofs, .is_color = true, .color_format = format});
+
   int load_bytes = 0;
   switch (format)
   {
@@ -417,10 +453,153 @@ void VertexLoaderX64::ReadColor(OpArg data, VertexComponentFormat attribute, Col
     m_src_ofs += load_bytes;
 }
 
+bool VertexLoaderX64::CanConvertVertexPairs() const
+{
+  if (!cpu_info.bAVX2)
+    return false;
+
+  // Matrix indices and indexed attributes are rare in vertex data that is worth vectorizing, and
+  // would need gathers, so they always use the one-vertex loop.
+  if (m_VtxDesc.low.PosMatIdx || IsIndexed(m_VtxDesc.low.Position) ||
+      IsIndexed(m_VtxDesc.low.Normal))
+  {
+    return false;
+  }
+  for (u32 i = 0; i < m_VtxDesc.low.Color.Size(); i++)
+  {
+    if (IsIndexed(m_VtxDesc.low.Color[i]))
+      return false;
+  }
+  for (u32 i = 0; i < m_VtxDesc.high.TexCoord.Size(); i++)
+  {
+    if (m_VtxDesc.low.TexMatIdx[i] || IsIndexed(m_VtxDesc.high.TexCoord[i]))
+      return false;
+  }
+  return true;
+}
+
+void VertexLoaderX64::GenerateVertexPairLoop(const u8* loop_start)
+{
+  // Converts vertices i and i + 1 per iteration, with vertex i in the lower and vertex i + 1 in
+  // the upper 128-bit lane of the ymm registers. The zfreeze caches are only written for the last
+  // three vertices, so those are left to the one-vertex loop, which this jumps back to.
+  const u32 src_stride = m_src_ofs;
+  const u32 dst_stride = m_dst_ofs;
+  // ReadColor records the colors again, so don't iterate over the member.
+  const std::vector<PairedAttribute> attributes = std::move(m_paired_attributes);
+  const X64Reg temp = YMM15;
+
+  const u8* pair_loop = GetCodePtr();
+  CMP(32, R(remaining_reg), Imm8(4));
+  FixupBranch done = J_CC(CC_B, Jump::Near);
+
+  // Each attribute gets its own register, so that all stores can happen in order afterwards.
+  int num_regs = 0;
+  for (const PairedAttribute& attr : attributes)
+  {
+    if (attr.is_color)
+      continue;
+
+    const X64Reg coords = static_cast<X64Reg>(YMM0 + num_regs);
+    const X64Reg coords_low = static_cast<X64Reg>(XMM0 + num_regs);
+    num_regs++;
+    ASSERT(coords != temp);
+
+    OpArg next_data = attr.data;
+    next_data.AddMemOffset(src_stride);
+
+    // Only shuffles and shifts within a lane are used below, which are much cheaper than moving
+    // data between lanes. Loads don't read further than the one-vertex loop does.
+    const int load_bytes = GetElementSize(attr.format) * attr.count_in;
+    if (load_bytes > 8)
+    {
+      VMOVDQU(coords_low, attr.data);
+      VINSERTI128(coords, coords, next_data, 1);
+    }
+    else
+    {
+      if (load_bytes > 4)
+      {
+        VMOVQ_xmm(coords_low, attr.data);
+        VPBROADCASTQ(temp, next_data);
+      }
+      else
+      {
+        VMOVD_xmm(coords_low, attr.data);
+        VPBROADCASTD(temp, next_data);
+      }
+      VPBLENDD(coords, coords, R(temp), 0xF0);
+    }
+
+    VPSHUFB(coords, coords, MPIC(&shuffle_lut_x2[attr.format][attr.count_in - 1]));
+
+    // Sign-extend.
+    if (attr.format == ComponentFormat::Byte)
+      VPSRAD(coords, coords, 24);
+    if (attr.format == ComponentFormat::Short)
+      VPSRAD(coords, coords, 16);
+
+    if (attr.format < ComponentFormat::Float)
+    {
+      VCVTDQ2PS(coords, R(coords));
+
+      if (attr.dequantize && attr.scaling_exponent)
+        VMULPS(coords, coords, MPIC(&scale_factors_x2[attr.scaling_exponent]));
+    }
+  }
+
+  // Write vertex i, then vertex i + 1, both in the same order as the one-vertex loop. Sequential
+  // stores are much faster than alternating between the two vertices, and as in the one-vertex
+  // loop, whole lanes are written and the excess is overwritten by the following attributes. The
+  // excess of vertex i + 1 ends up in vertex i + 2, which always exists.
+  for (u32 lane = 0; lane < 2; lane++)
+  {
+    const u32 lane_ofs = lane * dst_stride;
+    int reg_index = 0;
+    for (const PairedAttribute& attr : attributes)
+    {
+      if (attr.is_color)
+      {
+        // Colors are converted in general purpose registers; just do that once per vertex.
+        OpArg data = attr.data;
+        data.AddMemOffset(lane * src_stride);
+        m_dst_ofs = attr.dst_ofs + lane_ofs;
+        ReadColor(data, VertexComponentFormat::Direct, attr.color_format);
+        continue;
+      }
+
+      const OpArg dest = MDisp(dst_reg, attr.dst_ofs + lane_ofs);
+      if (lane == 0)
+        VMOVUPS(dest, static_cast<X64Reg>(XMM0 + reg_index));
+      else
+        VEXTRACTI128(dest, static_cast<X64Reg>(YMM0 + reg_index), 1);
+      reg_index++;
+    }
+  }
+
+  ADD(64, R(dst_reg), Imm32(2 * dst_stride));
+  ADD(64, R(src_reg), Imm32(2 * src_stride));
+  SUB(32, R(remaining_reg), Imm8(2));
+  JMP(pair_loop);
+
+  // Avoid the SSE/AVX transition penalty in the one-vertex loop.
+  SetJumpTarget(done);
+  VZEROUPPER();
+  JMP(loop_start);
+
+  m_src_ofs = src_stride;
+  m_dst_ofs = dst_stride;
+}
+
 void VertexLoaderX64::GenerateVertexLoader()
 {
+  const bool convert_pairs = CanConvertVertexPairs();
+
   BitSet32 regs = {src_reg,  dst_reg,       scratch1,    scratch2,
                    scratch3, remaining_reg, skipped_reg, base_reg};
+  // The AVX2 loop keeps every attribute in its own register.
+  if (convert_pairs)
+    regs |= ABI_ALL_FPRS;
   regs &= ABI_ALL_CALLEE_SAVED;
   regs[RBP] = true;  // Give us a stack frame
   ABI_PushRegistersAndAdjustStack(regs, 0);
@@ -440,6 +619,10 @@ void VertexLoaderX64::GenerateVertexLoader()
 
   // TODO: load constants into registers outside the main loop
 
+  FixupBranch to_pair_loop;
+  if (convert_pairs)
+    to_pair_loop = J(Jump::Near);
+
   const u8* loop_start = GetCodePtr();
 
   if (m_VtxDesc.low.PosMatIdx)
@@ -598,6 +781,13 @@ void VertexLoaderX64::GenerateVertexLoader()
     RET();
   }
 
+  if (convert_pairs)
+  {
+    SetJumpTarget(to_pair_loop);
+    GenerateVertexPairLoop(loop_start);
+  }
+  m_paired_attributes.clear();
+
   ASSERT_MSG(VIDEO, m_vertex_size == m_src_ofs,
              "Vertex size from vertex loader ({}) does not match expected vertex size ({})!\nVtx "
              "desc: {:08x} {:08x}\nVtx attr: {:08x} {:08x} {:08x}",
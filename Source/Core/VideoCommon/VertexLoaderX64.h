@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/x64Emitter.h"
 #include "VideoCommon/VertexLoaderBase.h"
@@ -21,6 +23,21 @@ protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
 
 private:
+  // An attribute conversion of the one-vertex loop, recorded so that the AVX2 loop can repeat it
+  // for two vertices at once.
+  struct PairedAttribute
+  {
+    Gen::OpArg data;
+    u32 dst_ofs = 0;
+    bool is_color = false;
+    ColorFormat color_format{};
+    ComponentFormat format{};
+    int count_in = 0;
+    int count_out = 0;
+    bool dequantize = false;
+    u8 scaling_exponent = 0;
+  };
+
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
   Gen::FixupBranch m_skip_vertex;
@@ -29,5 +46,9 @@ private:
                   int count_in, int count_out, bool dequantize, u8 scaling_exponent,
                   AttributeFormat* native_format);
   void ReadColor(Gen::OpArg data, VertexComponentFormat attribute, ColorFormat format);
+  bool CanConvertVertexPairs() const;
+  void GenerateVertexPairLoop(const u8* loop_start);
   void GenerateVertexLoader();
+
+  std::vector<PairedAttribute> m_paired_attributes;
 };
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "Common/ChunkFile.h"
@@ -14,6 +15,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
+#include "Common/TimelineTrace.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/SystemTimers.h"
@@ -24,6 +26,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUStageTimer.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -126,6 +129,7 @@ bool VertexManagerBase::Initialize()
   m_index_generator.Init();
   m_custom_shader_cache = std::make_unique<CustomShaderCache>();
   m_cpu_cull.Init();
+  m_cpu_cull.SetNumWorkerThreads(g_ActiveConfig.GetWorkerThreads());
   return true;
 }
 
@@ -369,6 +373,32 @@ void VertexManagerBase::InvalidateConstants()
   vertex_shader_manager.dirty = true;
   geometry_shader_manager.dirty = true;
   pixel_shader_manager.dirty = true;
+
+  for (std::vector<u8>& uploaded : m_uploaded_uniforms)
+    uploaded.clear();
+}
+
+bool VertexManagerBase::IsUniformBlockChanged(UniformBlock block, const void* data, u32 size)
+{
+  // Many registers flag the constants as dirty when they're written, even if the game writes the
+  // same value again. Comparing is a lot cheaper than streaming another copy of the block to the
+  // GPU and rebinding it.
+  std::vector<u8>& uploaded = m_uploaded_uniforms[static_cast<size_t>(block)];
+  if (uploaded.size() == size && std::memcmp(uploaded.data(), data, size) == 0)
+  {
+    INCSTAT(g_stats.this_frame.num_uniform_uploads_skipped);
+    ADDSTAT(g_stats.this_frame.bytes_uniform_skipped, size);
+    return false;
+  }
+
+  SetUploadedUniformBlock(block, data, size);
+  return true;
+}
+
+void VertexManagerBase::SetUploadedUniformBlock(UniformBlock block, const void* data, u32 size)
+{
+  const u8* bytes = static_cast<const u8*>(data);
+  m_uploaded_uniforms[static_cast<size_t>(block)].assign(bytes, bytes + size);
 }
 
 void VertexManagerBase::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
@@ -439,6 +469,9 @@ void VertexManagerBase::Flush()
 
   m_is_flushed = true;
 
+  TIMELINE_TRACE_SCOPE("VertexManager::Flush");
+  VideoCommon::ScopedGPUStageTimer submit_timer(VideoCommon::GPUStage::BackendSubmit);
+
   if (m_draw_counter == 0)
   {
     // This is more or less the start of the Frame
@@ -668,6 +701,8 @@ void VertexManagerBase::Flush()
 
     // The EFB cache is now potentially stale.
     g_framebuffer_manager->FlagPeekCacheAsOutOfDate();
+    if (g_ActiveConfig.bEFBAccessPredictive)
+      g_framebuffer_manager->PrefetchPredictedPeeks(m_draw_counter);
   }
 
   if (xfmem.numTexGen.numTexGens != bpmem.genMode.numtexgens)
@@ -717,17 +752,18 @@ void VertexManagerBase::CalculateZSlope(NativeVertexFormat* format)
   // is enabled in the following flush.
   auto& system = Core::System::GetInstance();
   auto& vertex_shader_manager = system.GetVertexShaderManager();
+  VertexLoaderManager::ZFreezeVertices vertices = VertexLoaderManager::GetZFreezeVertices();
   for (unsigned int i = 0; i < 3; ++i)
   {
     // If this vertex format has per-vertex position matrix IDs, look it up.
     if (vert_decl.posmtx.enable)
-      mtxIdx = VertexLoaderManager::position_matrix_index_cache[2 - i];
+      mtxIdx = vertices.matrix_indices[2 - i];
 
     if (vert_decl.position.components == 2)
-      VertexLoaderManager::position_cache[2 - i][2] = 0;
+      vertices.positions[2 - i][2] = 0;
 
-    vertex_shader_manager.TransformToClipSpace(&VertexLoaderManager::position_cache[2 - i][0],
-                                               &out[i * 4], mtxIdx);
+    vertex_shader_manager.TransformToClipSpace(&vertices.positions[2 - i][0], &out[i * 4],
+                                               mtxIdx);
 
     // Transform to Screenspace
     float inv_w = 1.0f / out[3 + i * 4];
@@ -893,8 +929,7 @@ void VertexManagerBase::UpdatePipelineObject()
   case ShaderCompilationMode::SynchronousUberShaders:
   {
     // Exclusive ubershader mode, always use ubershaders.
-    m_current_pipeline_object =
-        g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+    m_current_pipeline_object = GetUberPipeline();
   }
   break;
 
@@ -913,8 +948,7 @@ void VertexManagerBase::UpdatePipelineObject()
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
       // Specialized shaders not ready, use the ubershaders.
-      m_current_pipeline_object =
-          g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_current_pipeline_object = GetUberPipeline();
     }
     else
     {
@@ -927,10 +961,30 @@ void VertexManagerBase::UpdatePipelineObject()
   }
 }
 
+const AbstractPipeline* VertexManagerBase::GetUberPipeline()
+{
+  const VideoCommon::GXUberPipelineUid& uid = m_current_uber_pipeline_config;
+  if (!uid.vs_uid.GetUidData()->specialized && !uid.ps_uid.GetUidData()->specialized)
+    return g_shader_cache->GetUberPipelineForUid(uid);
+
+  // Specialized ubershaders are compiled in the background. Until they are ready, the generic
+  // ubershaders draw the same state, and we try again on the next draw.
+  auto res = g_shader_cache->GetUberPipelineForUidAsync(uid, m_current_pipeline_config);
+  if (res)
+    return *res;
+
+  m_pipeline_config_changed = true;
+  VideoCommon::GXUberPipelineUid generic_uid = uid;
+  UberShader::ClearVertexShaderUidSpecialization(&generic_uid.vs_uid);
+  UberShader::ClearPixelShaderUidSpecialization(&generic_uid.ps_uid);
+  return g_shader_cache->GetUberPipelineForUid(generic_uid);
+}
+
 void VertexManagerBase::OnConfigChange()
 {
   // Reload index generator function tables in case VS expand config changed
   m_index_generator.Init();
+  m_cpu_cull.SetNumWorkerThreads(g_ActiveConfig.GetWorkerThreads());
 }
 
 void VertexManagerBase::OnDraw()
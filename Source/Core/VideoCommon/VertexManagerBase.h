@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -161,6 +162,7 @@ public:
 
   // CPU access tracking - call after a draw call is made.
   void OnDraw();
+  u32 GetDrawCounter() const { return m_draw_counter; }
 
   // Call after CPU access is requested.
   void OnCPUEFBAccess();
@@ -172,8 +174,24 @@ public:
   void OnEndFrame();
 
 protected:
+  // GX uniform blocks whose uploads are skipped when their contents didn't change.
+  enum class UniformBlock : u32
+  {
+    Vertex,
+    Geometry,
+    Pixel,
+    Count
+  };
+
   // When utility uniforms are used, the GX uniforms need to be re-written afterwards.
-  static void InvalidateConstants();
+  void InvalidateConstants();
+
+  // Call for a dirty uniform block before uploading it. Returns false if the contents are the same
+  // as the last upload, in which case the block that is still bound can be used. Otherwise, the
+  // contents are remembered as uploaded.
+  bool IsUniformBlockChanged(UniformBlock block, const void* data, u32 size);
+  // Call when a uniform block is uploaded unconditionally, e.g. after a new buffer was started.
+  void SetUploadedUniformBlock(UniformBlock block, const void* data, u32 size);
 
   // Prepares the buffer for the next batch of vertices.
   virtual void ResetBuffer(u32 vertex_stride);
@@ -230,6 +248,7 @@ private:
                       const AbstractPipeline* current_pipeline);
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
+  const AbstractPipeline* GetUberPipeline();
 
   const AbstractPipeline*
   GetCustomPipeline(const CustomPixelShaderContents& custom_pixel_shader_contents,
@@ -251,6 +270,9 @@ private:
   std::unique_ptr<CustomShaderCache> m_custom_shader_cache;
   u64 m_ticks_elapsed = 0;
 
+  // Copies of the GX uniform blocks as they were last uploaded.
+  std::array<std::vector<u8>, static_cast<size_t>(UniformBlock::Count)> m_uploaded_uniforms;
+
   Common::EventHook m_frame_end_event;
   Common::EventHook m_after_present_event;
 };
@@ -356,12 +356,12 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
 
   ShaderCode input_extract;
 
-  out.Write("{}", s_lighting_struct);
+  out.Append(s_lighting_struct);
 
   // uniforms
   out.Write("UBO_BINDING(std140, 2) uniform VSBlock {{\n");
 
-  out.Write("{}", s_shader_uniforms);
+  out.Append(s_shader_uniforms);
   out.Write("}};\n");
 
   if (!custom_contents.uniforms.empty())
@@ -374,7 +374,7 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   if (uid_data->vs_expand != VSExpand::None)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
-    out.Write("{}", s_geometry_shader_uniforms);
+    out.Append(s_geometry_shader_uniforms);
     out.Write("}};\n");
 
     if (api_type == APIType::D3D)
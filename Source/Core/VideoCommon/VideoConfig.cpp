@@ -99,6 +99,7 @@ void VideoConfig::Refresh()
       Config::Get(Config::GFX_WIDESCREEN_HEURISTIC_WIDESCREEN_RATIO);
   bCrop = Config::Get(Config::GFX_CROP);
   iSafeTextureCache_ColorSamples = Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
+  bTextureCacheWriteTracking = Config::Get(Config::GFX_TEXTURE_CACHE_WRITE_TRACKING);
   bShowFPS = Config::Get(Config::GFX_SHOW_FPS);
   bShowFTimes = Config::Get(Config::GFX_SHOW_FTIMES);
   bShowVPS = Config::Get(Config::GFX_SHOW_VPS);
@@ -108,6 +109,7 @@ void VideoConfig::Refresh()
   bShowSpeedColors = Config::Get(Config::GFX_SHOW_SPEED_COLORS);
   iPerfSampleUSec = Config::Get(Config::GFX_PERF_SAMP_WINDOW) * 1000;
   bLogRenderTimeToFile = Config::Get(Config::GFX_LOG_RENDER_TIME_TO_FILE);
+  bLogPerformanceMetricsToFile = Config::Get(Config::GFX_LOG_PERFORMANCE_METRICS_TO_FILE);
   bOverlayStats = Config::Get(Config::GFX_OVERLAY_STATS);
   bOverlayProjStats = Config::Get(Config::GFX_OVERLAY_PROJ_STATS);
   bOverlayScissorStats = Config::Get(Config::GFX_OVERLAY_SCISSOR_STATS);
@@ -116,6 +118,8 @@ void VideoConfig::Refresh()
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  iHiresTexturesMemoryBudget = Config::Get(Config::GFX_HIRES_TEXTURES_MEMORY_BUDGET);
+  iHiresTexturesVRAMBudget = Config::Get(Config::GFX_HIRES_TEXTURES_VRAM_BUDGET);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bEnableGPUTextureDecoding = Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
@@ -136,9 +140,11 @@ void VideoConfig::Refresh()
   bShaderCache = Config::Get(Config::GFX_SHADER_CACHE);
   bWaitForShadersBeforeStarting = Config::Get(Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING);
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
+  bSpecializeUberShaders = Config::Get(Config::GFX_SPECIALIZE_UBERSHADERS);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  iWorkerThreads = Config::Get(Config::GFX_WORKER_THREADS);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -170,6 +176,7 @@ void VideoConfig::Refresh()
 
   bEFBAccessEnable = Config::Get(Config::GFX_HACK_EFB_ACCESS_ENABLE);
   bEFBAccessDeferInvalidation = Config::Get(Config::GFX_HACK_EFB_DEFER_INVALIDATION);
+  bEFBAccessPredictive = Config::Get(Config::GFX_HACK_EFB_ACCESS_PREDICTIVE);
   bBBoxEnable = Config::Get(Config::GFX_HACK_BBOX_ENABLE);
   bSkipEFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   bSkipXFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM);
@@ -184,6 +191,7 @@ void VideoConfig::Refresh()
   iEFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
   iMissingColorValue = Config::Get(Config::GFX_HACK_MISSING_COLOR_VALUE);
   bFastTextureSampling = Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING);
+  bGeometryCache = Config::Get(Config::GFX_HACK_GEOMETRY_CACHE);
 #ifdef __APPLE__
   bNoMipmapping = Config::Get(Config::GFX_HACK_NO_MIPMAPPING);
 #endif
@@ -247,6 +255,14 @@ static u32 GetNumAutoShaderPreCompilerThreads()
   return static_cast<u32>(std::max(cpu_info.num_cores - 2, 1));
 }
 
+static u32 GetNumAutoWorkerThreads()
+{
+  // Automatic number. The CPU and GPU threads are already busy, as is the decode thread of the
+  // pipelined GPU thread. Leave one more core for the rest of the system.
+  const int busy_cores = Config::Get(Config::MAIN_PIPELINED_GPU_THREAD) ? 4 : 3;
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - busy_cores, 0, 3));
+}
+
 u32 VideoConfig::GetShaderCompilerThreads() const
 {
   if (!g_backend_info.bSupportsBackgroundCompiling)
@@ -275,6 +291,14 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetWorkerThreads() const
+{
+  if (iWorkerThreads >= 0)
+    return static_cast<u32>(iWorkerThreads);
+  else
+    return GetNumAutoWorkerThreads();
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
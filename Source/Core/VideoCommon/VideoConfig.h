@@ -257,6 +257,7 @@ struct VideoConfig final
   bool bTexFmtOverlayEnable = false;
   bool bTexFmtOverlayCenter = false;
   bool bLogRenderTimeToFile = false;
+  bool bLogPerformanceMetricsToFile = false;
 
   // Render
   bool bWireFrame = false;
@@ -268,6 +269,8 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  int iHiresTexturesMemoryBudget = 0;  // MiB, 0 = automatic
+  int iHiresTexturesVRAMBudget = 0;    // MiB, 0 = unlimited
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
@@ -279,6 +282,7 @@ struct VideoConfig final
   // Hacks
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
+  bool bEFBAccessPredictive = false;
   bool bPerfQueriesEnable = false;
   bool bBBoxEnable = false;
   bool bCPUCull = false;
@@ -292,6 +296,7 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
   int iSafeTextureCache_ColorSamples = 0;
+  bool bTextureCacheWriteTracking = false;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -302,6 +307,7 @@ struct VideoConfig final
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
+  bool bGeometryCache = false;
 #ifdef __APPLE__
   bool bNoMipmapping = false;  // Used by macOS fifoci to work around an M1 bug
 #endif
@@ -336,6 +342,9 @@ struct VideoConfig final
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
+  // Use ubershaders specialized on coarse state (TEV stages, alpha test, lighting) in the
+  // ubershader modes, falling back to the generic ones until they are compiled.
+  bool bSpecializeUberShaders = false;
 
   // Number of shader compiler threads.
   // 0 disables background compilation.
@@ -343,6 +352,11 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of worker threads for CPU culling and texture decoding.
+  // 0 does all of the work on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iWorkerThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -391,6 +405,7 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetWorkerThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
@@ -466,4 +466,6 @@ extern XFMemory xfmem;
 
 void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data);
 void LoadIndexedXF(CPArray array, u32 index, u16 address, u8 size);
+// Applies an indexed load whose data was already read from memory.
+void LoadIndexedXF(u16 address, u8 size, const u8* data);
 void PreprocessIndexedXF(CPArray array, u32 index, u16 address, u8 size);
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/XFStructs.h"
 
+#include <algorithm>
 #include <bit>
 
 #include "Common/CommonTypes.h"
@@ -17,6 +18,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/XFMemory.h"
@@ -28,6 +30,18 @@ static void XFMemWritten(XFStateManager& xf_state_manager, u32 transferSize, u32
   xf_state_manager.InvalidateXFRange(baseAddress, baseAddress + transferSize);
 }
 
+// Some registers flush the pipeline on every write. Games often write the same viewport or texture
+// matrix setup before each draw, which doesn't need to split the batch.
+static bool IsRedundantXFRegWrite(u32 address, u32 value)
+{
+  if (((u32*)&xfmem)[address] != value)
+    return false;
+
+  if (g_vertex_manager->HasSendableVertices())
+    INCSTAT(g_stats.this_frame.num_draw_calls_merged);
+  return true;
+}
+
 static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager, u32 address,
                          u32 value)
 {
@@ -120,6 +134,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (IsRedundantXFRegWrite(address, value))
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -133,6 +149,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (IsRedundantXFRegWrite(address, value))
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -151,6 +169,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (IsRedundantXFRegWrite(address, value))
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -163,6 +183,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (IsRedundantXFRegWrite(address, value))
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -232,12 +254,32 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+    // Only the words which actually change need to flush the pipeline and invalidate constants.
+    // Matrices are commonly reloaded with the values they already have.
+    const u32* current_data = reinterpret_cast<const u32*>(&xfmem) + xf_mem_base;
+    u32 first_changed = xf_mem_transfer_size;
+    u32 last_changed = 0;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (current_data[i] != Common::swap32(data + i * sizeof(u32)))
+      {
+        first_changed = std::min(first_changed, i);
+        last_changed = i;
+      }
+    }
+
+    if (first_changed < xf_mem_transfer_size)
+    {
+      XFMemWritten(xf_state_manager, last_changed - first_changed + 1,
+                   xf_mem_base + first_changed);
+      for (u32 i = first_changed; i <= last_changed; i++)
+        ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data + i * sizeof(u32));
+    }
+    else if (xf_mem_transfer_size != 0 && g_vertex_manager->HasSendableVertices())
+    {
+      INCSTAT(g_stats.this_frame.num_draw_calls_merged);
     }
+    data += xf_mem_transfer_size * sizeof(u32);
   }
 
   // write to XF regs
@@ -261,27 +303,32 @@ void LoadIndexedXF(CPArray array, u32 index, u16 address, u8 size)
   // load stuff from array to address in xf mem
 
   const u32 buf_size = size * sizeof(u32);
-  u32* currData = reinterpret_cast<u32*>(&xfmem) + address;
-  u32* newData;
+  const u8* newData;
   auto& system = Core::System::GetInstance();
   auto& fifo = system.GetFifo();
   if (fifo.UseDeterministicGPUThread())
   {
-    newData = static_cast<u32*>(fifo.PopFifoAuxBuffer(buf_size));
+    newData = static_cast<u8*>(fifo.PopFifoAuxBuffer(buf_size));
   }
   else
   {
     auto& memory = system.GetMemory();
-    newData = reinterpret_cast<u32*>(memory.GetPointerForRange(
+    newData = memory.GetPointerForRange(
         g_main_cp_state.array_bases[array] + g_main_cp_state.array_strides[array] * index,
-        buf_size));
+        buf_size);
   }
 
-  auto& xf_state_manager = system.GetXFStateManager();
+  LoadIndexedXF(address, size, newData);
+}
+
+void LoadIndexedXF(u16 address, u8 size, const u8* data)
+{
+  u32* currData = reinterpret_cast<u32*>(&xfmem) + address;
+  auto& xf_state_manager = Core::System::GetInstance().GetXFStateManager();
   bool changed = false;
   for (u32 i = 0; i < size; ++i)
   {
-    if (currData[i] != Common::swap32(newData[i]))
+    if (currData[i] != Common::swap32(&data[i * sizeof(u32)]))
     {
       changed = true;
       XFMemWritten(xf_state_manager, size, address);
@@ -291,7 +338,7 @@ void LoadIndexedXF(CPArray array, u32 index, u16 address, u8 size)
   if (changed)
   {
     for (u32 i = 0; i < size; ++i)
-      currData[i] = Common::swap32(newData[i]);
+      currData[i] = Common::swap32(&data[i * sizeof(u32)]);
   }
 }
 
@@ -0,0 +1,131 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatHashMultiMap.h"
+
+namespace
+{
+template <typename Map>
+std::vector<int> GetValues(Map& map, u32 key)
+{
+  std::vector<int> values;
+  auto range = map.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it)
+    values.push_back(it->second);
+  std::ranges::sort(values);
+  return values;
+}
+}  // namespace
+
+TEST(FlatHashMultiMap, Simple)
+{
+  Common::FlatHashMultiMap<u32, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(0));
+  EXPECT_EQ(map.begin(), map.end());
+
+  map.emplace(0x80001000, 1);
+  map.emplace(0x80001000, 2);
+  map.emplace(0x80002000, 3);
+  EXPECT_EQ(3u, map.size());
+  EXPECT_EQ((std::vector<int>{1, 2}), GetValues(map, 0x80001000));
+  EXPECT_EQ((std::vector<int>{3}), GetValues(map, 0x80002000));
+  EXPECT_TRUE(GetValues(map, 0x80003000).empty());
+
+  auto range = map.equal_range(0x80001000);
+  range.first = map.erase(range.first);
+  EXPECT_NE(range.first, range.second);
+  range.first = map.erase(range.first);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_FALSE(map.contains(0x80001000));
+  EXPECT_EQ(1u, map.size());
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(FlatHashMultiMap, MatchesMultimap)
+{
+  // Aligned keys with many duplicates, like texture addresses, and enough erasing to rehash both
+  // to grow the table and to clear tombstones.
+  Common::FlatHashMultiMap<u32, int> map;
+  std::multimap<u32, int> reference;
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<u32> key_dist(0, 2000);
+
+  for (int i = 0; i < 100000; i++)
+  {
+    const u32 key = key_dist(rng) * 32;
+    if (rng() % 3 != 0)
+    {
+      map.emplace(key, i);
+      reference.emplace(key, i);
+    }
+    else if (auto it = map.find(key); it != map.end())
+    {
+      const auto ref_range = reference.equal_range(key);
+      reference.erase(std::find_if(ref_range.first, ref_range.second,
+                                   [&](const auto& value) { return value.second == it->second; }));
+      map.erase(it);
+    }
+  }
+
+  ASSERT_EQ(reference.size(), map.size());
+  for (u32 key = 0; key <= 2000 * 32; key += 32)
+  {
+    std::vector<int> expected;
+    const auto ref_range = reference.equal_range(key);
+    for (auto it = ref_range.first; it != ref_range.second; ++it)
+      expected.push_back(it->second);
+    std::ranges::sort(expected);
+    EXPECT_EQ(expected, GetValues(map, key));
+  }
+
+  size_t count = 0;
+  for (const auto& [key, value] : std::as_const(map))
+  {
+    EXPECT_EQ(0u, key % 32);
+    count++;
+  }
+  EXPECT_EQ(reference.size(), count);
+}
+
+TEST(FlatHashMultiMap, EraseWhileIterating)
+{
+  Common::FlatHashMultiMap<u32, std::unique_ptr<int>> map;
+  for (int i = 0; i < 1000; i++)
+    map.emplace(static_cast<u32>(i % 100), std::make_unique<int>(i));
+
+  // Erasing doesn't move the other elements.
+  std::unique_ptr<int>* kept = nullptr;
+  for (auto& [key, value] : map)
+  {
+    if (*value == 1)
+      kept = &value;
+  }
+  ASSERT_NE(nullptr, kept);
+
+  for (auto it = map.begin(); it != map.end();)
+  {
+    if (*it->second % 2 == 0)
+      it = map.erase(it);
+    else
+      ++it;
+  }
+
+  EXPECT_EQ(500u, map.size());
+  for (const auto& [key, value] : map)
+    EXPECT_EQ(1, *value % 2);
+  EXPECT_EQ(1, **kept);
+}
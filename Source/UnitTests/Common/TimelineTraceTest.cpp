@@ -0,0 +1,150 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <picojson.h>
+
+#include "Common/FileUtil.h"
+#include "Common/JsonUtil.h"
+#include "Common/Thread.h"
+#include "Common/TimelineTrace.h"
+
+namespace
+{
+struct ParsedTrace
+{
+  // Thread name -> names of the events of the thread.
+  std::map<std::string, std::vector<std::string>> events;
+};
+
+ParsedTrace ParseTrace(const std::string& path)
+{
+  picojson::value root;
+  std::string error;
+  EXPECT_TRUE(JsonFromFile(path, &root, &error)) << error;
+
+  std::map<double, std::string> thread_names;
+  std::vector<std::pair<double, std::string>> events;
+  for (const picojson::value& event : root.get("traceEvents").get<picojson::array>())
+  {
+    const std::string& phase = event.get("ph").get<std::string>();
+    if (phase == "M" && event.get("name").get<std::string>() == "thread_name")
+    {
+      thread_names[event.get("tid").get<double>()] =
+          event.get("args").get("name").get<std::string>();
+    }
+    else if (phase == "X")
+    {
+      EXPECT_GE(event.get("dur").get<double>(), 0.0);
+      events.emplace_back(event.get("tid").get<double>(), event.get("name").get<std::string>());
+    }
+  }
+
+  ParsedTrace trace;
+  for (const auto& [tid, name] : events)
+    trace.events[thread_names[tid]].push_back(name);
+  return trace;
+}
+}  // namespace
+
+class TimelineTraceTest : public testing::Test
+{
+protected:
+  TimelineTraceTest()
+      : m_parent_directory(File::CreateTempDir()), m_path(m_parent_directory + "/trace.json")
+  {
+  }
+
+  ~TimelineTraceTest() override
+  {
+    Common::TimelineTrace::Stop();
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_path;
+};
+
+TEST_F(TimelineTraceTest, RecordsEventsPerThread)
+{
+  Common::TimelineTrace::Start();
+
+  std::thread first_thread([] {
+    Common::SetCurrentThreadName("Worker \"1\"");
+    TIMELINE_TRACE_SCOPE("Worker event");
+  });
+  first_thread.join();
+
+  // The name is set after the first event, so the thread has to be renamed in the trace.
+  std::thread second_thread([] {
+    {
+      TIMELINE_TRACE_SCOPE("Second event 1");
+    }
+    Common::SetCurrentThreadName("Second");
+    {
+      TIMELINE_TRACE_SCOPE("Second event 2");
+    }
+
+    Common::TimelineTrace::Stop();
+    {
+      TIMELINE_TRACE_SCOPE("Not recorded");
+    }
+  });
+  second_thread.join();
+  ASSERT_TRUE(Common::TimelineTrace::WriteChromeTrace(m_path));
+
+  const ParsedTrace trace = ParseTrace(m_path);
+  ASSERT_EQ(trace.events.size(), 2u);
+  EXPECT_EQ(trace.events.at("Second"),
+            (std::vector<std::string>{"Second event 1", "Second event 2"}));
+  EXPECT_EQ(trace.events.at("Worker \"1\""), std::vector<std::string>{"Worker event"});
+}
+
+TEST_F(TimelineTraceTest, StartDiscardsPreviousTrace)
+{
+  Common::TimelineTrace::Start();
+  {
+    TIMELINE_TRACE_SCOPE("First trace");
+  }
+  Common::TimelineTrace::Stop();
+
+  Common::TimelineTrace::Start();
+  {
+    TIMELINE_TRACE_SCOPE("Second trace");
+  }
+  Common::TimelineTrace::Stop();
+  ASSERT_TRUE(Common::TimelineTrace::WriteChromeTrace(m_path));
+
+  const ParsedTrace trace = ParseTrace(m_path);
+  ASSERT_EQ(trace.events.size(), 1u);
+  EXPECT_EQ(trace.events.begin()->second, std::vector<std::string>{"Second trace"});
+}
+
+TEST_F(TimelineTraceTest, KeepsNewestEventsWhenFull)
+{
+  Common::TimelineTrace::Start();
+  Common::TimelineTrace::AddEvent("Old", 0, 0);
+  for (u32 i = 0; i < Common::TimelineTrace::EVENTS_PER_THREAD; i++)
+    Common::TimelineTrace::AddEvent("New", 0, 0);
+  Common::TimelineTrace::Stop();
+  ASSERT_TRUE(Common::TimelineTrace::WriteChromeTrace(m_path));
+
+  const ParsedTrace trace = ParseTrace(m_path);
+  ASSERT_EQ(trace.events.size(), 1u);
+  const std::vector<std::string>& events = trace.events.begin()->second;
+  EXPECT_EQ(events.size(), Common::TimelineTrace::EVENTS_PER_THREAD - 1);
+  EXPECT_EQ(std::count(events.begin(), events.end(), "Old"), 0);
+}
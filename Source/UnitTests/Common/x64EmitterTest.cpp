@@ -105,6 +105,7 @@ protected:
     cpu_info.bSSE4_2 = true;
     cpu_info.bLZCNT = true;
     cpu_info.bAVX = true;
+    cpu_info.bAVX2 = true;
     cpu_info.bBMI1 = true;
     cpu_info.bBMI2 = true;
     cpu_info.bBMI2FastParallelBitOps = true;
@@ -1277,6 +1278,7 @@ AVX_RRM_TEST(VPAND, "dqword")
 AVX_RRM_TEST(VPANDN, "dqword")
 AVX_RRM_TEST(VPOR, "dqword")
 AVX_RRM_TEST(VPXOR, "dqword")
+AVX_RRM_TEST(VPSHUFB, "dqword")
 
 #define FMA3_TEST(Name, P, packed)                                                                 \
   AVX_RRM_TEST(Name##132##P##S, packed ? "dqword" : "dword")                                       \
@@ -1321,6 +1323,41 @@ AVX_RRMI_TEST(VSHUFPS, "dqword")
 AVX_RRMI_TEST(VSHUFPD, "dqword")
 AVX_RRMI_TEST(VBLENDPS, "dqword")
 AVX_RRMI_TEST(VBLENDPD, "dqword")
+AVX_RRMI_TEST(VPBLENDD, "dqword")
+
+TEST_F(x64EmitterTest, VINSERTI128)
+{
+  for (const auto& r : ymmnames)
+  {
+    emitter->VINSERTI128(r.reg, YMM0, R(XMM0), 1);
+    emitter->VINSERTI128(YMM0, r.reg, MatR(R12), 1);
+    ExpectDisassembly("vinserti128 " + r.name +
+                      ", ymm0, xmm0, 0x01 "
+                      "vinserti128 ymm0, " +
+                      r.name + ", dqword ptr ds:[r12], 0x01");
+  }
+}
+
+TEST_F(x64EmitterTest, VEXTRACTI128)
+{
+  for (const auto& r : ymmnames)
+  {
+    emitter->VEXTRACTI128(R(XMM0), r.reg, 1);
+    emitter->VEXTRACTI128(MatR(R12), r.reg, 1);
+    ExpectDisassembly("vextracti128 xmm0, " + r.name + ", 0x01 vextracti128 dqword ptr ds:[r12], " +
+                      r.name + ", 0x01");
+  }
+}
+
+TEST_F(x64EmitterTest, VPSRAD)
+{
+  for (const auto& r : ymmnames)
+  {
+    emitter->VPSRAD(r.reg, YMM0, 16);
+    emitter->VPSRAD(YMM0, r.reg, 16);
+    ExpectDisassembly("vpsrad " + r.name + ", ymm0, 0x10 vpsrad ymm0, " + r.name + ", 0x10");
+  }
+}
 
 // for VEX instructions that take the form op reg, reg, r/m, reg OR reg, reg, reg, r/m
 #define VEX_RRMR_RRRM_TEST(Name, sizename)                                                         \
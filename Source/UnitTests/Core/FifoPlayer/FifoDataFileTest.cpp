@@ -0,0 +1,164 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <latch>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+
+namespace
+{
+constexpr u32 NUM_FRAMES = 4;
+
+std::vector<u8> MakeData(u32 size, u8 seed)
+{
+  std::vector<u8> data(size);
+  for (u32 i = 0; i < size; ++i)
+    data[i] = static_cast<u8>(seed + i * 7);
+  return data;
+}
+
+FifoFrameInfo MakeFrame(u32 frame)
+{
+  FifoFrameInfo info;
+  info.fifoData = MakeData(1000 + frame * 100, static_cast<u8>(frame));
+  info.fifoStart = 0x1000 * frame;
+  info.fifoEnd = info.fifoStart + static_cast<u32>(info.fifoData.size());
+
+  // The texture is the same in every frame, so that it's only stored once.
+  info.memoryUpdates.push_back({.fifoPosition = 10,
+                                .address = 0x00100000,
+                                .data = MakeData(4096, 0x55),
+                                .type = MemoryUpdate::Type::TextureMap});
+  info.memoryUpdates.push_back({.fifoPosition = 500,
+                                .address = 0x00200000 + frame * 0x100,
+                                .data = MakeData(64 + frame, static_cast<u8>(0x80 + frame)),
+                                .type = MemoryUpdate::Type::VertexStream});
+  return info;
+}
+
+void ExpectFramesEqual(const FifoFrameInfo& actual, const FifoFrameInfo& expected)
+{
+  EXPECT_EQ(actual.fifoData, expected.fifoData);
+  EXPECT_EQ(actual.fifoStart, expected.fifoStart);
+  EXPECT_EQ(actual.fifoEnd, expected.fifoEnd);
+  ASSERT_EQ(actual.memoryUpdates.size(), expected.memoryUpdates.size());
+  for (size_t i = 0; i < expected.memoryUpdates.size(); ++i)
+  {
+    EXPECT_EQ(actual.memoryUpdates[i].fifoPosition, expected.memoryUpdates[i].fifoPosition);
+    EXPECT_EQ(actual.memoryUpdates[i].address, expected.memoryUpdates[i].address);
+    EXPECT_EQ(actual.memoryUpdates[i].data, expected.memoryUpdates[i].data);
+    EXPECT_EQ(actual.memoryUpdates[i].type, expected.memoryUpdates[i].type);
+  }
+}
+}  // namespace
+
+class FifoDataFileTest : public testing::Test
+{
+protected:
+  FifoDataFileTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/test.dff") {}
+
+  ~FifoDataFileTest() override { File::DeleteDirRecursively(m_directory); }
+
+  void SaveTestFile()
+  {
+    // The file contains all of texture memory, which is too large for the stack.
+    const auto file = std::make_unique<FifoDataFile>();
+    file->SetIsWii(true);
+    for (u32 i = 0; i < FifoDataFile::BP_MEM_SIZE; ++i)
+      file->GetBPMem()[i] = i * 3;
+    for (u32 i = 0; i < FifoDataFile::CP_MEM_SIZE; ++i)
+      file->GetCPMem()[i] = i * 5;
+    for (u32 i = 0; i < FifoDataFile::XF_MEM_SIZE; ++i)
+      file->GetXFMem()[i] = i * 7;
+    for (u32 i = 0; i < FifoDataFile::XF_REGS_SIZE; ++i)
+      file->GetXFRegs()[i] = i * 11;
+    const std::vector<u8> tex_mem = MakeData(FifoDataFile::TEX_MEM_SIZE, 0x13);
+    std::ranges::copy(tex_mem, file->GetTexMem());
+    for (u32 i = 0; i < NUM_FRAMES; ++i)
+      file->AddFrame(MakeFrame(i));
+    ASSERT_TRUE(file->Save(m_path));
+  }
+
+  std::string m_directory;
+  std::string m_path;
+};
+
+TEST_F(FifoDataFileTest, SaveAndLoadRoundTrip)
+{
+  SaveTestFile();
+
+  const std::unique_ptr<FifoDataFile> file = FifoDataFile::Load(m_path, false);
+  ASSERT_NE(file, nullptr);
+  EXPECT_TRUE(file->GetIsWii());
+  for (u32 i = 0; i < FifoDataFile::BP_MEM_SIZE; ++i)
+    EXPECT_EQ(file->GetBPMem()[i], i * 3);
+  for (u32 i = 0; i < FifoDataFile::CP_MEM_SIZE; ++i)
+    EXPECT_EQ(file->GetCPMem()[i], i * 5);
+  for (u32 i = 0; i < FifoDataFile::XF_MEM_SIZE; ++i)
+    EXPECT_EQ(file->GetXFMem()[i], i * 7);
+  for (u32 i = 0; i < FifoDataFile::XF_REGS_SIZE; ++i)
+    EXPECT_EQ(file->GetXFRegs()[i], i * 11);
+  EXPECT_TRUE(std::ranges::equal(std::span(file->GetTexMem(), FifoDataFile::TEX_MEM_SIZE),
+                                 MakeData(FifoDataFile::TEX_MEM_SIZE, 0x13)));
+
+  ASSERT_EQ(file->GetFrameCount(), NUM_FRAMES);
+  // Read the frames out of order, so that some come from disk and some from the frame cache.
+  for (const u32 i : {2u, 0u, 3u, 1u, 2u})
+  {
+    SCOPED_TRACE(i);
+    ExpectFramesEqual(*file->GetFrame(i), MakeFrame(i));
+  }
+}
+
+TEST_F(FifoDataFileTest, SavingALoadedFileKeepsItsFrames)
+{
+  SaveTestFile();
+  const std::unique_ptr<FifoDataFile> file = FifoDataFile::Load(m_path, false);
+  ASSERT_NE(file, nullptr);
+
+  const std::string copy_path = m_directory + "/copy.dff";
+  ASSERT_TRUE(file->Save(copy_path));
+  const std::unique_ptr<FifoDataFile> copy = FifoDataFile::Load(copy_path, false);
+  ASSERT_NE(copy, nullptr);
+  ASSERT_EQ(copy->GetFrameCount(), NUM_FRAMES);
+  for (u32 i = 0; i < NUM_FRAMES; ++i)
+  {
+    SCOPED_TRACE(i);
+    ExpectFramesEqual(*copy->GetFrame(i), MakeFrame(i));
+  }
+}
+
+TEST_F(FifoDataFileTest, ConcurrentReadsShareTheCachedFrame)
+{
+  SaveTestFile();
+  const std::unique_ptr<FifoDataFile> file = FifoDataFile::Load(m_path, false);
+  ASSERT_NE(file, nullptr);
+
+  std::vector<std::shared_ptr<const FifoFrameInfo>> frames(8);
+  std::latch start(frames.size());
+  std::vector<std::thread> threads;
+  for (auto& frame : frames)
+  {
+    threads.emplace_back([&file, &frame, &start] {
+      start.arrive_and_wait();
+      frame = file->GetFrame(1);
+    });
+  }
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // Only one of the threads reads the frame from disk. The others get the cached frame.
+  for (const auto& frame : frames)
+    EXPECT_EQ(frame, frames[0]);
+  ExpectFramesEqual(*frames[0], MakeFrame(1));
+}
@@ -0,0 +1,193 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "Common/MsgHandler.h"
+#include "Core/HW/WriteTracker.h"
+
+namespace
+{
+constexpr u32 RAM_SIZE = 0x100000;
+constexpr u32 EXRAM_SIZE = 0x100000;
+constexpr u32 EXRAM_ADDRESS = 0x10000000;
+// Larger than the host page size, so ranges this far apart are on different pages.
+constexpr u32 PAGE_DISTANCE = 0x10000;
+
+Memory::WriteTracker* s_alert_tracker = nullptr;
+int s_alert_count = 0;
+
+// Like the handler of UnitTestsMain, but alerts are expected while s_alert_tracker is set.
+bool ExpectAlertHandler(const char* caption, const char* text, bool yes_no, Common::MsgType style)
+{
+  if (!s_alert_tracker)
+  {
+    fmt::print(stderr, "{}\n", text);
+    ADD_FAILURE();
+    return true;
+  }
+
+  // This would never return if the alert was shown while the tracker's lock is held.
+  s_alert_tracker->WasWritten(0, 0x10, 0);
+  s_alert_count++;
+  return true;
+}
+}  // namespace
+
+class WriteTrackerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    if (!Memory::WriteTracker::IsSupported())
+      GTEST_SKIP() << "Write tracking isn't supported on this platform";
+
+    m_ram = static_cast<u8*>(Common::AllocateMemoryPages(RAM_SIZE));
+    m_exram = static_cast<u8*>(Common::AllocateMemoryPages(EXRAM_SIZE));
+    ASSERT_NE(m_ram, nullptr);
+    ASSERT_NE(m_exram, nullptr);
+
+    m_tracker.Init(RAM_SIZE, EXRAM_SIZE);
+    m_tracker.SetViews({{m_ram, 0, RAM_SIZE}, {m_exram, EXRAM_ADDRESS, EXRAM_SIZE}});
+    m_tracker.SetEnabled(true);
+  }
+
+  void TearDown() override
+  {
+    // Unprotects the memory before it's freed.
+    m_tracker.Shutdown();
+    if (m_ram)
+      Common::FreeMemoryPages(m_ram, RAM_SIZE);
+    if (m_exram)
+      Common::FreeMemoryPages(m_exram, EXRAM_SIZE);
+  }
+
+  Memory::WriteTracker m_tracker;
+  u8* m_ram = nullptr;
+  u8* m_exram = nullptr;
+};
+
+TEST_F(WriteTrackerTest, UnwrittenRangeIsNotWritten)
+{
+  const std::optional<u64> sequence = m_tracker.Watch(0, 2 * PAGE_DISTANCE);
+  ASSERT_TRUE(sequence);
+  EXPECT_FALSE(m_tracker.WasWritten(0, 2 * PAGE_DISTANCE, *sequence));
+  EXPECT_FALSE(m_tracker.WasWritten(PAGE_DISTANCE, 0x10, *sequence));
+}
+
+TEST_F(WriteTrackerTest, UnwatchedRangeIsWritten)
+{
+  const std::optional<u64> sequence = m_tracker.Watch(0, PAGE_DISTANCE);
+  ASSERT_TRUE(sequence);
+  EXPECT_TRUE(m_tracker.WasWritten(0, 2 * PAGE_DISTANCE, *sequence));
+}
+
+TEST_F(WriteTrackerTest, MarkWrittenOnlyAffectsItsPages)
+{
+  const std::optional<u64> first = m_tracker.Watch(0, PAGE_DISTANCE);
+  const std::optional<u64> second = m_tracker.Watch(2 * PAGE_DISTANCE, PAGE_DISTANCE);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  m_tracker.MarkWritten(0x100, 0x10);
+  EXPECT_TRUE(m_tracker.WasWritten(0, PAGE_DISTANCE, *first));
+  EXPECT_FALSE(m_tracker.WasWritten(2 * PAGE_DISTANCE, PAGE_DISTANCE, *second));
+
+  // The memory isn't protected after the write.
+  m_ram[0x100] = 1;
+}
+
+TEST_F(WriteTrackerTest, WatchingAgainStartsANewSequence)
+{
+  const std::optional<u64> old_sequence = m_tracker.Watch(0, PAGE_DISTANCE);
+  ASSERT_TRUE(old_sequence);
+  m_tracker.MarkWritten(0, 0x10);
+
+  const std::optional<u64> new_sequence = m_tracker.Watch(0, PAGE_DISTANCE);
+  ASSERT_TRUE(new_sequence);
+  EXPECT_GT(*new_sequence, *old_sequence);
+  EXPECT_FALSE(m_tracker.WasWritten(0, PAGE_DISTANCE, *new_sequence));
+  EXPECT_TRUE(m_tracker.WasWritten(0, PAGE_DISTANCE, *old_sequence));
+}
+
+TEST_F(WriteTrackerTest, DecodesExRAMAddresses)
+{
+  const std::optional<u64> sequence = m_tracker.Watch(EXRAM_ADDRESS + PAGE_DISTANCE, 0x100);
+  ASSERT_TRUE(sequence);
+  EXPECT_FALSE(m_tracker.WasWritten(EXRAM_ADDRESS + PAGE_DISTANCE, 0x100, *sequence));
+
+  // The same page at the same offset in MEM1 isn't affected.
+  m_tracker.MarkWritten(PAGE_DISTANCE, 0x10);
+  EXPECT_FALSE(m_tracker.WasWritten(EXRAM_ADDRESS + PAGE_DISTANCE, 0x100, *sequence));
+
+  // Cached and uncached mirrors map to the same memory.
+  m_tracker.MarkWritten(0x90000000 + PAGE_DISTANCE, 0x10);
+  EXPECT_TRUE(m_tracker.WasWritten(EXRAM_ADDRESS + PAGE_DISTANCE, 0x100, *sequence));
+}
+
+TEST_F(WriteTrackerTest, RangesOutsideMemoryAreNotTracked)
+{
+  EXPECT_FALSE(m_tracker.Watch(RAM_SIZE - 0x10, 0x20));
+  EXPECT_FALSE(m_tracker.Watch(EXRAM_ADDRESS + EXRAM_SIZE, 0x10));
+  EXPECT_FALSE(m_tracker.Watch(0, 0));
+  EXPECT_TRUE(m_tracker.WasWritten(RAM_SIZE - 0x10, 0x20, 0));
+}
+
+TEST_F(WriteTrackerTest, FaultUnprotectsAndRecordsThePage)
+{
+  const std::optional<u64> sequence = m_tracker.Watch(0, 2 * PAGE_DISTANCE);
+  ASSERT_TRUE(sequence);
+
+  EXPECT_TRUE(m_tracker.HandleFault(reinterpret_cast<uintptr_t>(m_ram + PAGE_DISTANCE + 4)));
+  EXPECT_FALSE(m_tracker.WasWritten(0, 0x10, *sequence));
+  EXPECT_TRUE(m_tracker.WasWritten(PAGE_DISTANCE, 0x10, *sequence));
+  m_ram[PAGE_DISTANCE + 4] = 1;
+
+  // Faults outside of the views aren't handled.
+  u8 other;
+  EXPECT_FALSE(m_tracker.HandleFault(reinterpret_cast<uintptr_t>(&other)));
+}
+
+TEST_F(WriteTrackerTest, ResetUnprotectsEverything)
+{
+  const std::optional<u64> sequence = m_tracker.Watch(0, PAGE_DISTANCE);
+  const std::optional<u64> exram_sequence = m_tracker.Watch(EXRAM_ADDRESS, PAGE_DISTANCE);
+  ASSERT_TRUE(sequence);
+  ASSERT_TRUE(exram_sequence);
+
+  m_tracker.Reset();
+  EXPECT_TRUE(m_tracker.WasWritten(0, PAGE_DISTANCE, *sequence));
+  EXPECT_TRUE(m_tracker.WasWritten(EXRAM_ADDRESS, PAGE_DISTANCE, *exram_sequence));
+  m_ram[0] = 1;
+  m_exram[0] = 1;
+
+  // Tracking works again after a reset.
+  const std::optional<u64> new_sequence = m_tracker.Watch(0, PAGE_DISTANCE);
+  ASSERT_TRUE(new_sequence);
+  EXPECT_FALSE(m_tracker.WasWritten(0, PAGE_DISTANCE, *new_sequence));
+}
+
+TEST_F(WriteTrackerTest, ProtectionFailuresAreReportedAfterReleasingTheLock)
+{
+  // A second view of MEM1 whose memory has been freed can't be protected.
+  u8* const freed = static_cast<u8*>(Common::AllocateMemoryPages(RAM_SIZE));
+  ASSERT_NE(freed, nullptr);
+  Common::FreeMemoryPages(freed, RAM_SIZE);
+  m_tracker.SetViews({{m_ram, 0, RAM_SIZE}, {freed, 0, RAM_SIZE}});
+
+  Common::RegisterMsgAlertHandler(ExpectAlertHandler);
+  s_alert_tracker = &m_tracker;
+  s_alert_count = 0;
+  EXPECT_FALSE(m_tracker.Watch(0, PAGE_DISTANCE));
+  s_alert_tracker = nullptr;
+
+  // Protecting and unprotecting again both failed, but only one alert is shown.
+  EXPECT_EQ(s_alert_count, 1);
+  EXPECT_TRUE(m_tracker.WasWritten(0, PAGE_DISTANCE, 0));
+  m_ram[0] = 1;
+}
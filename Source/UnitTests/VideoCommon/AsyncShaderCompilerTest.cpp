@@ -0,0 +1,152 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "VideoCommon/AsyncShaderCompiler.h"
+
+using VideoCommon::AsyncShaderCompiler;
+
+namespace
+{
+// Records the order the items are compiled and retrieved in.
+struct Log
+{
+  std::mutex lock;
+  std::vector<int> compiled;
+  std::vector<int> retrieved;
+};
+
+class TestWorkItem final : public AsyncShaderCompiler::WorkItem
+{
+public:
+  TestWorkItem(Log* log, int id) : m_log(log), m_id(id) {}
+
+  bool Compile() override
+  {
+    std::lock_guard guard(m_log->lock);
+    m_log->compiled.push_back(m_id);
+    return true;
+  }
+
+  void Retrieve() override { m_log->retrieved.push_back(m_id); }
+
+private:
+  Log* m_log;
+  int m_id;
+};
+
+// Keeps the only worker busy until it is released, so the order of the items queued in the
+// meantime is deterministic.
+class BlockingWorkItem final : public AsyncShaderCompiler::WorkItem
+{
+public:
+  BlockingWorkItem(Common::Event* started, Common::Event* release)
+      : m_started(started), m_release(release)
+  {
+  }
+
+  bool Compile() override
+  {
+    m_started->Set();
+    m_release->Wait();
+    return true;
+  }
+
+  void Retrieve() override {}
+
+private:
+  Common::Event* m_started;
+  Common::Event* m_release;
+};
+}  // namespace
+
+class AsyncShaderCompilerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    ASSERT_TRUE(m_compiler.StartWorkerThreads(1));
+    m_compiler.QueueWorkItem(
+        AsyncShaderCompiler::CreateWorkItem<BlockingWorkItem>(&m_started, &m_release), 0);
+    m_started.Wait();
+  }
+
+  void TearDown() override { m_compiler.StopWorkerThreads(); }
+
+  void Queue(int id, u32 priority)
+  {
+    m_compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&m_log, id),
+                             priority);
+  }
+
+  void ReleaseAndWait()
+  {
+    m_release.Set();
+    while (m_compiler.HasPendingWork())
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    m_compiler.RetrieveWorkItems();
+  }
+
+  AsyncShaderCompiler m_compiler;
+  Common::Event m_started;
+  Common::Event m_release;
+  Log m_log;
+};
+
+TEST_F(AsyncShaderCompilerTest, CompilesInPriorityOrder)
+{
+  Queue(3, 30);
+  Queue(1, 10);
+  Queue(2, 20);
+  EXPECT_EQ(m_compiler.GetStatistics().pending_items, 3u);
+
+  ReleaseAndWait();
+  EXPECT_EQ(m_log.compiled, (std::vector<int>{1, 2, 3}));
+  EXPECT_EQ(m_log.retrieved, (std::vector<int>{1, 2, 3}));
+
+  const AsyncShaderCompiler::Statistics stats = m_compiler.GetStatistics();
+  EXPECT_EQ(stats.pending_items, 0u);
+  EXPECT_EQ(stats.completed_items, 4u);
+  EXPECT_LE(stats.latency_p50_ms, stats.latency_p99_ms);
+}
+
+TEST_F(AsyncShaderCompilerTest, ExpiredItemsMoveBehind)
+{
+  const auto now = AsyncShaderCompiler::Clock::now();
+  m_compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&m_log, 1), 10,
+                           now - std::chrono::seconds(1), 50);
+  m_compiler.QueueWorkItem(AsyncShaderCompiler::CreateWorkItem<TestWorkItem>(&m_log, 2), 20,
+                           now + std::chrono::hours(1), 50);
+  Queue(3, 30);
+
+  ReleaseAndWait();
+  EXPECT_EQ(m_log.compiled, (std::vector<int>{2, 3, 1}));
+  EXPECT_EQ(m_compiler.GetStatistics().expired_items, 1u);
+}
+
+TEST_F(AsyncShaderCompilerTest, CancelDropsPendingAndCompilingWork)
+{
+  Queue(1, 10);
+  Queue(2, 20);
+  m_compiler.CancelPendingWork();
+  Queue(3, 30);
+
+  ReleaseAndWait();
+  EXPECT_EQ(m_log.compiled, (std::vector<int>{3}));
+  EXPECT_EQ(m_log.retrieved, (std::vector<int>{3}));
+
+  const AsyncShaderCompiler::Statistics stats = m_compiler.GetStatistics();
+  EXPECT_EQ(stats.cancelled_items, 2u);
+  // The blocking item was compiling when the work was cancelled.
+  EXPECT_EQ(stats.wasted_items, 1u);
+  EXPECT_EQ(stats.completed_items, 1u);
+}
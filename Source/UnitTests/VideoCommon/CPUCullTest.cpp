@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Core/System.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/XFMemory.h"
+#include "VideoCommon/XFStateManager.h"
+
+using Primitive = OpcodeDecoder::Primitive;
+
+class CPUCullTest : public testing::TestWithParam<std::tuple<CoordComponentCount, bool>>
+{
+protected:
+  void SetUp() override
+  {
+    const auto [pos_elements, per_vertex_posmtx] = GetParam();
+
+    TVtxDesc vtx_desc;
+    VAT vtx_attr;
+    vtx_desc.low.PosMatIdx = per_vertex_posmtx;
+    vtx_desc.low.Position = VertexComponentFormat::Direct;
+    vtx_attr.g0.PosElements = pos_elements;
+    vtx_attr.g0.PosFormat = ComponentFormat::Float;
+    m_loader = VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr);
+    m_stride = m_loader->m_native_vtx_decl.stride;
+    m_position_offset = m_loader->m_native_vtx_decl.position.offset;
+    m_num_components = pos_elements == CoordComponentCount::XYZ ? 3 : 2;
+
+    // Orthographic identity projection. Position matrix 0 is identity and used by all off screen
+    // vertices, the others are arbitrary.
+    xfmem.projection.type = ProjectionType::Orthographic;
+    xfmem.projection.rawProjection = {1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f};
+    Core::System::GetInstance().GetXFStateManager().SetProjectionChanged();
+    std::uniform_real_distribution<float> matrix_dist(-1.0f, 1.0f);
+    for (float& value : xfmem.posMatrices)
+      value = matrix_dist(m_rng);
+    std::fill_n(xfmem.posMatrices, 12, 0.0f);
+    xfmem.posMatrices[0] = xfmem.posMatrices[5] = xfmem.posMatrices[10] = 1.0f;
+    g_main_cp_state.matrix_index_a.PosNormalMtxIdx = 0;
+    xfmem.viewport.ht = -1.0f;
+  }
+
+  // Fills the vertex data with positions that are far off screen, so every triangle is culled
+  // unless some vertices are moved on screen.
+  void FillOffScreen(u32 count)
+  {
+    // The transform functions may read 4 bytes past the position of the last vertex.
+    m_vertices.assign(count * m_stride + 16, 0);
+    std::uniform_real_distribution<float> dist(100.0f, 200.0f);
+    for (u32 i = 0; i < count; ++i)
+    {
+      for (u32 j = 0; j < m_num_components; ++j)
+        SetComponent(i, j, dist(m_rng));
+    }
+  }
+
+  // Moves some consecutive vertices on screen. With per-vertex position matrices, they use
+  // arbitrary matrices instead, which may or may not keep them on screen.
+  void MoveOnScreen(u32 first, u32 count)
+  {
+    std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+    // Matrix indices are in rows of 4 floats, and the last matrix starts at row 61.
+    std::uniform_int_distribution<u32> matrix_dist(3, 61);
+    for (u32 i = first; i < first + count; ++i)
+    {
+      if (std::get<1>(GetParam()))
+      {
+        const u32 matrix_index = matrix_dist(m_rng);
+        std::memcpy(&m_vertices[i * m_stride], &matrix_index, sizeof(u32));
+      }
+      for (u32 j = 0; j < m_num_components; ++j)
+        SetComponent(i, j, dist(m_rng));
+    }
+  }
+
+  void SetComponent(u32 vertex, u32 component, float value)
+  {
+    std::memcpy(&m_vertices[vertex * m_stride + m_position_offset + component * sizeof(float)],
+                &value, sizeof(float));
+  }
+
+  bool AreAllVerticesCulled(CPUCull& cull, Primitive primitive, u32 count)
+  {
+    return cull.AreAllVerticesCulled(m_loader.get(), primitive, m_vertices.data(), count);
+  }
+
+  // Straightforward version of CPUCull, see videosoftware Clipper.cpp
+  bool ReferenceAreAllVerticesCulled(Primitive primitive, CullMode cull_mode, u32 count) const
+  {
+    std::vector<CPUCull::TransformedVertex> transformed(count);
+    for (u32 i = 0; i < count; ++i)
+    {
+      u32 matrix_index = 0;
+      if (std::get<1>(GetParam()))
+        std::memcpy(&matrix_index, &m_vertices[i * m_stride], sizeof(u32));
+      const float* m = &xfmem.posMatrices[(matrix_index & 0x3f) * 4];
+
+      std::array<float, 3> pos{};
+      std::memcpy(pos.data(), &m_vertices[i * m_stride + m_position_offset],
+                  m_num_components * sizeof(float));
+      // The projection is identity
+      transformed[i].x = m[0] * pos[0] + m[1] * pos[1] + m[2] * pos[2] + m[3];
+      transformed[i].y = m[4] * pos[0] + m[5] * pos[1] + m[6] * pos[2] + m[7];
+      transformed[i].z = m[8] * pos[0] + m[9] * pos[1] + m[10] * pos[2] + m[11];
+      transformed[i].w = 1.0f;
+    }
+
+    const auto is_culled = [&](u32 ia, u32 ib, u32 ic) {
+      const CPUCull::TransformedVertex& a = transformed[ia];
+      const CPUCull::TransformedVertex& b = transformed[ib];
+      const CPUCull::TransformedVertex& c = transformed[ic];
+      const float normal_z_dir = (c.w * a.x - a.w * c.x) * b.y +  //
+                                 (c.x * a.y - a.x * c.y) * b.w +  //
+                                 (c.y * a.w - a.y * c.w) * b.x;
+      if (cull_mode == CullMode::None && normal_z_dir == 0)
+        return true;
+      if (cull_mode == CullMode::Front && normal_z_dir <= 0)
+        return true;
+      if (cull_mode == CullMode::Back && normal_z_dir >= 0)
+        return true;
+      return (a.x < -a.w && b.x < -b.w && c.x < -c.w) || (a.y < -a.w && b.y < -b.w && c.y < -c.w) ||
+             (a.x > a.w && b.x > b.w && c.x > c.w) || (a.y > a.w && b.y > b.w && c.y > c.w);
+    };
+
+    switch (primitive)
+    {
+    case Primitive::GX_DRAW_QUADS:
+      for (u32 i = 3; i < count + 1; i += 4)
+      {
+        if (!is_culled(i - 3, i - 2, i - 1) || (i < count && !is_culled(i - 3, i - 1, i)))
+          return false;
+      }
+      return true;
+    case Primitive::GX_DRAW_TRIANGLES:
+      for (u32 i = 2; i < count; i += 3)
+      {
+        if (!is_culled(i - 2, i - 1, i))
+          return false;
+      }
+      return true;
+    case Primitive::GX_DRAW_TRIANGLE_STRIP:
+      for (u32 i = 2; i < count; ++i)
+      {
+        const bool odd = i % 2 != 0;
+        if (!is_culled(i - 2, odd ? i : i - 1, odd ? i - 1 : i))
+          return false;
+      }
+      return true;
+    default:
+      for (u32 i = 2; i < count; ++i)
+      {
+        if (!is_culled(0, i - 1, i))
+          return false;
+      }
+      return true;
+    }
+  }
+
+  std::unique_ptr<VertexLoaderBase> m_loader;
+  u32 m_stride = 0;
+  u32 m_position_offset = 0;
+  u32 m_num_components = 0;
+  std::vector<u8> m_vertices;
+  std::mt19937 m_rng{1234};
+};
+INSTANTIATE_TEST_SUITE_P(
+    AllCombinations, CPUCullTest,
+    ::testing::Combine(::testing::Values(CoordComponentCount::XY, CoordComponentCount::XYZ),
+                       ::testing::Values(false, true)));
+
+TEST_P(CPUCullTest, MatchesReference)
+{
+  constexpr std::array primitives = {Primitive::GX_DRAW_QUADS, Primitive::GX_DRAW_TRIANGLES,
+                                     Primitive::GX_DRAW_TRIANGLE_STRIP,
+                                     Primitive::GX_DRAW_TRIANGLE_FAN};
+  CPUCull single_threaded;
+  single_threaded.Init(false);
+  CPUCull threaded;
+  threaded.Init(false);
+  threaded.SetNumWorkerThreads(3);
+  CPUCull avx512;
+  avx512.Init();
+
+  // Small draws are culled in one go, large ones in chunks that can end in the middle of them.
+  for (const Primitive primitive : primitives)
+  {
+    for (const CullMode cull_mode : {CullMode::None, CullMode::Back, CullMode::Front})
+    {
+      bpmem.genMode.cull_mode = cull_mode;
+      for (const u32 count : {3u, 4u, 7u, 100u, 3071u, 3072u, 3075u, 4609u, 20000u})
+      {
+        FillOffScreen(count);
+        EXPECT_TRUE(AreAllVerticesCulled(single_threaded, primitive, count));
+        EXPECT_TRUE(AreAllVerticesCulled(threaded, primitive, count));
+
+        // Only a few vertices are visible, at the start, around chunk boundaries or at the end.
+        for (const u32 first : {0u, 1534u, 1536u, 3070u, count - 4})
+        {
+          if (count < 4 || first > count - 4)
+            continue;
+
+          FillOffScreen(count);
+          MoveOnScreen(first, 4);
+          const bool expected = ReferenceAreAllVerticesCulled(primitive, cull_mode, count);
+          EXPECT_EQ(expected, AreAllVerticesCulled(single_threaded, primitive, count))
+              << count << ' ' << first;
+          EXPECT_EQ(expected, AreAllVerticesCulled(threaded, primitive, count))
+              << count << ' ' << first;
+          if (cpu_info.bAVX512F)
+          {
+            EXPECT_EQ(expected, AreAllVerticesCulled(avx512, primitive, count))
+                << count << ' ' << first;
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/GeometryCache.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexLoaderBase.h"
+
+namespace
+{
+constexpr int NUM_VERTICES = 100;
+}  // namespace
+
+class GeometryCacheTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // Three float coordinates and one RGBA8 color per vertex
+    g_main_cp_state.vtx_desc.low.Hex = 0;
+    g_main_cp_state.vtx_desc.high.Hex = 0;
+    g_main_cp_state.vtx_desc.low.Position = VertexComponentFormat::Direct;
+    g_main_cp_state.vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+    VAT& vtx_attr = g_main_cp_state.vtx_attr[0];
+    vtx_attr.g0.Hex = 0;
+    vtx_attr.g1.Hex = 0;
+    vtx_attr.g2.Hex = 0;
+    vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+    vtx_attr.g0.PosFormat = ComponentFormat::Float;
+    vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+    vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+    m_loader = VertexLoaderBase::CreateVertexLoader(g_main_cp_state.vtx_desc, vtx_attr);
+
+    // Random colors and small coordinates, so that every vertex is valid.
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> byte(0, 255);
+    m_src.resize(m_loader->m_vertex_size * NUM_VERTICES);
+    for (u32 i = 0; i < m_src.size(); ++i)
+      m_src[i] = i % 16 < 12 && i % 4 == 0 ? 0x3f : static_cast<u8>(byte(rng));
+  }
+
+  // Returns whether the cache was hit.
+  bool Run(std::vector<u8>* dst, int count = NUM_VERTICES)
+  {
+    dst->assign(m_loader->m_native_vtx_decl.stride * count, 0);
+    const auto& stats = g_stats.this_frame;
+    const int hits = stats.num_geometry_cache_hits;
+    const int misses = stats.num_geometry_cache_misses;
+    EXPECT_EQ(m_cache.RunVertices(m_loader.get(), 0, m_src.data(), dst->data(), count), count);
+    EXPECT_EQ(stats.num_geometry_cache_hits + stats.num_geometry_cache_misses, hits + misses + 1);
+    return stats.num_geometry_cache_hits != hits;
+  }
+
+  std::vector<u8> Load()
+  {
+    std::vector<u8> dst(m_loader->m_native_vtx_decl.stride * NUM_VERTICES);
+    m_loader->RunVertices(m_src.data(), dst.data(), NUM_VERTICES);
+    return dst;
+  }
+
+  VideoCommon::GeometryCache m_cache;
+  std::unique_ptr<VertexLoaderBase> m_loader;
+  std::vector<u8> m_src;
+};
+
+TEST_F(GeometryCacheTest, HitReturnsLoadedVertices)
+{
+  std::vector<u8> first;
+  std::vector<u8> second;
+  EXPECT_FALSE(Run(&first));
+  EXPECT_TRUE(Run(&second));
+  EXPECT_EQ(first, Load());
+  EXPECT_EQ(second, first);
+}
+
+TEST_F(GeometryCacheTest, ChangedVertexDataMisses)
+{
+  std::vector<u8> dst;
+  EXPECT_FALSE(Run(&dst));
+
+  m_src[m_src.size() - 1] ^= 1;
+  EXPECT_FALSE(Run(&dst));
+  EXPECT_EQ(dst, Load());
+  EXPECT_TRUE(Run(&dst));
+}
+
+TEST_F(GeometryCacheTest, ChangedVertexFormatMisses)
+{
+  std::vector<u8> dst;
+  EXPECT_FALSE(Run(&dst));
+
+  // The texture coordinate formats don't change the output of this loader, but they are part of
+  // the VAT that the cache is keyed on.
+  g_main_cp_state.vtx_attr[0].g1.Tex1CoordFormat = ComponentFormat::Float;
+  EXPECT_FALSE(Run(&dst));
+  EXPECT_TRUE(Run(&dst));
+}
+
+TEST_F(GeometryCacheTest, DifferentCountMisses)
+{
+  std::vector<u8> dst;
+  EXPECT_FALSE(Run(&dst));
+  EXPECT_FALSE(Run(&dst, NUM_VERTICES / 2));
+  EXPECT_TRUE(Run(&dst, NUM_VERTICES / 2));
+}
+
+TEST_F(GeometryCacheTest, ClearInvalidatesEntries)
+{
+  std::vector<u8> dst;
+  EXPECT_FALSE(Run(&dst));
+  m_cache.Clear();
+  EXPECT_FALSE(Run(&dst));
+  EXPECT_TRUE(Run(&dst));
+}
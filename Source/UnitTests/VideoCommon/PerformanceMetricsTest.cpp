@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/PerformanceTracker.h"
+
+namespace
+{
+DT Milliseconds(double ms)
+{
+  return std::chrono::duration_cast<DT>(DT_ms(ms));
+}
+}  // namespace
+
+TEST(PerformanceTracker, PercentilesOfNoSamplesAreZero)
+{
+  const auto percentiles = PerformanceTracker::CalculateDtPercentiles({});
+  EXPECT_EQ(percentiles.p50, DT::zero());
+  EXPECT_EQ(percentiles.p95, DT::zero());
+  EXPECT_EQ(percentiles.p99, DT::zero());
+}
+
+TEST(PerformanceTracker, PercentilesOfOneSampleAreTheSample)
+{
+  const auto percentiles = PerformanceTracker::CalculateDtPercentiles({Milliseconds(16)});
+  EXPECT_EQ(percentiles.p50, Milliseconds(16));
+  EXPECT_EQ(percentiles.p95, Milliseconds(16));
+  EXPECT_EQ(percentiles.p99, Milliseconds(16));
+}
+
+TEST(PerformanceTracker, PercentilesUseRoundedDownRank)
+{
+  std::vector<DT> dts;
+  for (int i = 1; i <= 100; ++i)
+    dts.push_back(Milliseconds(i));
+  std::shuffle(dts.begin(), dts.end(), std::mt19937(0));
+
+  // The ranks of 100 samples are 49.5, 94.05 and 98.01, which round down to the 50th, 95th and
+  // 99th smallest sample.
+  const auto percentiles = PerformanceTracker::CalculateDtPercentiles(dts);
+  EXPECT_EQ(percentiles.p50, Milliseconds(50));
+  EXPECT_EQ(percentiles.p95, Milliseconds(95));
+  EXPECT_EQ(percentiles.p99, Milliseconds(99));
+}
+
+TEST(PerformanceMetrics, PresentLatencyBucketsIncludeTheirUpperBound)
+{
+  EXPECT_EQ(PerformanceMetrics::GetPresentLatencyBucket(DT::zero()), 0u);
+  for (std::size_t i = 0; i < PerformanceMetrics::PRESENT_LATENCY_BUCKETS_MS.size(); ++i)
+  {
+    const double bound = PerformanceMetrics::PRESENT_LATENCY_BUCKETS_MS[i];
+    EXPECT_EQ(PerformanceMetrics::GetPresentLatencyBucket(Milliseconds(bound)), i) << bound;
+    EXPECT_EQ(PerformanceMetrics::GetPresentLatencyBucket(Milliseconds(bound + 0.5)), i + 1)
+        << bound;
+  }
+}
+
+TEST(PerformanceMetrics, LongPresentLatenciesGoInTheLastBucket)
+{
+  constexpr std::size_t last_bucket = PerformanceMetrics::NUM_PRESENT_LATENCY_BUCKETS - 1;
+  EXPECT_EQ(PerformanceMetrics::GetPresentLatencyBucket(Milliseconds(100.5)), last_bucket);
+  EXPECT_EQ(PerformanceMetrics::GetPresentLatencyBucket(std::chrono::seconds(10)), last_bucket);
+}
@@ -0,0 +1,143 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/GXPipelineTypes.h"
+#include "VideoCommon/PipelineUIDCache.h"
+
+namespace
+{
+VideoCommon::SerializedGXPipelineUid MakeUid(u32 id)
+{
+  VideoCommon::SerializedGXPipelineUid uid;
+  std::memset(static_cast<void*>(&uid), 0, sizeof(uid));
+  uid.rasterization_state_bits = id;
+  return uid;
+}
+
+VideoCommon::SerializedGXPipelineUsage MakeUsage(u32 id, u32 earliest_first_use,
+                                                 u32 num_sessions_used)
+{
+  VideoCommon::SerializedGXPipelineUsage usage;
+  usage.uid = MakeUid(id);
+  usage.earliest_first_use = earliest_first_use;
+  usage.num_sessions_used = num_sessions_used;
+  return usage;
+}
+
+std::vector<u32> GetIds(const std::vector<VideoCommon::SerializedGXPipelineUid>& uids)
+{
+  std::vector<u32> ids;
+  for (const auto& uid : uids)
+    ids.push_back(uid.rasterization_state_bits);
+  return ids;
+}
+}  // namespace
+
+class PipelineUIDCacheTest : public testing::Test
+{
+protected:
+  PipelineUIDCacheTest()
+      : m_directory(File::CreateTempDir()), m_cache_path(m_directory + "/GALE01.uidcache")
+  {
+  }
+
+  ~PipelineUIDCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_directory;
+  const std::string m_cache_path;
+};
+
+TEST_F(PipelineUIDCacheTest, RoundTrip)
+{
+  const std::vector uids{MakeUid(1), MakeUid(2), MakeUid(3)};
+  ASSERT_TRUE(VideoCommon::WritePipelineUIDCacheFile(m_cache_path, uids));
+
+  const auto result = VideoCommon::ReadPipelineUIDCacheFile(m_cache_path);
+  ASSERT_FALSE(result.error.has_value());
+  EXPECT_EQ(GetIds(result.uids), (std::vector<u32>{1, 2, 3}));
+
+  const std::string usage_path = VideoCommon::GetPipelineUsageFilePath(m_cache_path);
+  EXPECT_EQ(usage_path, m_directory + "/GALE01.uidusage");
+
+  const std::vector usages{MakeUsage(2, 5, 1)};
+  ASSERT_TRUE(VideoCommon::WritePipelineUsageFile(usage_path, usages));
+  const auto usage_result = VideoCommon::ReadPipelineUsageFile(usage_path);
+  ASSERT_FALSE(usage_result.error.has_value());
+  ASSERT_EQ(usage_result.usages.size(), 1u);
+  EXPECT_EQ(usage_result.usages[0].uid.rasterization_state_bits, 2u);
+  EXPECT_EQ(usage_result.usages[0].earliest_first_use, 5u);
+
+  // The files can't be mixed up.
+  EXPECT_EQ(VideoCommon::ReadPipelineUsageFile(m_cache_path).error,
+            VideoCommon::PipelineUIDCacheError::WrongMagic);
+}
+
+TEST_F(PipelineUIDCacheTest, RejectsInvalidFiles)
+{
+  EXPECT_EQ(VideoCommon::ReadPipelineUIDCacheFile(m_directory + "/missing.uidcache").error,
+            VideoCommon::PipelineUIDCacheError::OpenFailed);
+
+  // A cache of another version.
+  {
+    File::IOFile file(m_cache_path, "wb");
+    const u32 header[] = {VideoCommon::PIPELINE_UID_CACHE_MAGIC,
+                          VideoCommon::GX_PIPELINE_UID_VERSION - 1};
+    ASSERT_TRUE(file.WriteArray(header, 2));
+    const auto uid = MakeUid(1);
+    ASSERT_TRUE(file.WriteBytes(&uid, sizeof(uid)));
+  }
+  auto result = VideoCommon::ReadPipelineUIDCacheFile(m_cache_path);
+  EXPECT_EQ(result.error, VideoCommon::PipelineUIDCacheError::WrongVersion);
+  EXPECT_TRUE(result.uids.empty());
+
+  // A cache that was cut off in the middle of a UID.
+  const std::vector uids{MakeUid(1), MakeUid(2)};
+  ASSERT_TRUE(VideoCommon::WritePipelineUIDCacheFile(m_cache_path, uids));
+  ASSERT_TRUE(File::IOFile(m_cache_path, "r+b")
+                  .Resize(VideoCommon::PIPELINE_UID_CACHE_HEADER_SIZE +
+                          sizeof(VideoCommon::SerializedGXPipelineUid) + 1));
+  result = VideoCommon::ReadPipelineUIDCacheFile(m_cache_path);
+  EXPECT_EQ(result.error, VideoCommon::PipelineUIDCacheError::Truncated);
+  EXPECT_TRUE(result.uids.empty());
+}
+
+TEST(PipelineUIDCache, MergeUIDs)
+{
+  std::vector uids{MakeUid(3), MakeUid(1)};
+  const std::vector other{MakeUid(1), MakeUid(4), MakeUid(2), MakeUid(4), MakeUid(3)};
+  VideoCommon::MergePipelineUIDs(&uids, other);
+  EXPECT_EQ(GetIds(uids), (std::vector<u32>{3, 1, 4, 2}));
+}
+
+TEST(PipelineUIDCache, MergeUsage)
+{
+  std::vector usages{MakeUsage(1, 10, 2), MakeUsage(2, 0, 0)};
+  const std::vector other{MakeUsage(1, 4, 3), MakeUsage(2, 7, 1), MakeUsage(3, 1, 1)};
+  VideoCommon::MergePipelineUsage(&usages, other);
+
+  ASSERT_EQ(usages.size(), 3u);
+  EXPECT_EQ(usages[0].earliest_first_use, 4u);
+  EXPECT_EQ(usages[0].num_sessions_used, 5u);
+  EXPECT_EQ(usages[1].earliest_first_use, 7u);
+  EXPECT_EQ(usages[1].num_sessions_used, 1u);
+  EXPECT_EQ(usages[2].uid.rasterization_state_bits, 3u);
+}
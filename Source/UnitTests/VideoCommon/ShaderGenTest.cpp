@@ -0,0 +1,124 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <string>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/LightingShaderGen.h"
+#include "VideoCommon/PixelShaderGen.h"
+#include "VideoCommon/ShaderGenCommon.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+constexpr std::array API_TYPES = {APIType::OpenGL, APIType::D3D, APIType::Vulkan, APIType::Metal};
+
+std::array<ShaderHostConfig, 4> GetHostConfigs()
+{
+  std::array<ShaderHostConfig, 4> configs{};
+  configs[1].per_pixel_lighting = true;
+  configs[1].bounding_box = true;
+  configs[1].backend_bbox = true;
+  configs[2].msaa = true;
+  configs[2].ssaa = true;
+  configs[2].backend_ssaa = true;
+  configs[2].stereo = true;
+  configs[3].bits = 0x3a5f17c9;
+  return configs;
+}
+
+pixel_shader_uid_data GetPixelShaderUidData(u32 variant)
+{
+  pixel_shader_uid_data uid_data;
+  std::memset(static_cast<void*>(&uid_data), 0, sizeof(uid_data));
+  uid_data.num_values = sizeof(uid_data);
+  uid_data.genMode_numtevstages = variant;
+  uid_data.genMode_numtexgens = variant;
+  uid_data.numColorChans = variant % 3;
+  uid_data.bounding_box = variant % 2;
+  uid_data.per_pixel_depth = variant % 2;
+  return uid_data;
+}
+}  // namespace
+
+TEST(ShaderCode, WriteWithoutArgumentsMatchesFmt)
+{
+  const auto check = [](fmt::format_string<> format) {
+    ShaderCode code;
+    code.Write(format);
+    EXPECT_EQ(code.GetBuffer(), fmt::format(format));
+  };
+
+  check("");
+  check("no braces\n");
+  check("{{}}");
+  check("}}{{");
+  check("{{{{ nested }}}}");
+  check("float4 main() {{ return float4(0.0); }}\n");
+  check("a{{b}}c{{{{d}}}}e\n\tf}}");
+}
+
+TEST(ShaderCode, AppendMatchesFormattedWrite)
+{
+  ShaderCode appended;
+  appended.Write("// header {}\n", 1);
+  appended.Append(s_lighting_struct);
+  appended.Write("}};\n");
+
+  EXPECT_EQ(appended.GetBuffer(), fmt::format("// header {}\n{}}};\n", 1, s_lighting_struct));
+}
+
+TEST(PixelShaderGen, PrerenderedHeaderMatchesGeneratedHeader)
+{
+  // The second round copies the headers that were pre-rendered in the first one.
+  for (int round = 0; round < 2; ++round)
+  {
+    for (const bool supports_texture_query_levels : {false, true})
+    {
+      g_backend_info.bSupportsTextureQueryLevels = supports_texture_query_levels;
+      for (const APIType api_type : API_TYPES)
+      {
+        for (const ShaderHostConfig& host_config : GetHostConfigs())
+        {
+          for (const bool bounding_box : {false, true})
+          {
+            ShaderCode prerendered;
+            WritePixelShaderCommonHeader(prerendered, api_type, host_config, bounding_box);
+            ShaderCode generated;
+            GeneratePixelShaderCommonHeader(generated, api_type, host_config, bounding_box);
+            EXPECT_EQ(prerendered.GetBuffer(), generated.GetBuffer())
+                << round << ' ' << static_cast<int>(api_type) << ' ' << host_config.bits << ' '
+                << bounding_box;
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(PixelShaderGen, ShadersContainGeneratedHeader)
+{
+  g_backend_info.bSupportsTextureQueryLevels = true;
+  for (const APIType api_type : API_TYPES)
+  {
+    for (const ShaderHostConfig& host_config : GetHostConfigs())
+    {
+      for (u32 variant = 0; variant < 4; ++variant)
+      {
+        const pixel_shader_uid_data uid_data = GetPixelShaderUidData(variant);
+        const ShaderCode shader = GeneratePixelShaderCode(api_type, host_config, &uid_data, {});
+
+        ShaderCode header;
+        GeneratePixelShaderCommonHeader(header, api_type, host_config, uid_data.bounding_box);
+        EXPECT_NE(shader.GetBuffer().find(header.GetBuffer()), std::string::npos)
+            << static_cast<int>(api_type) << ' ' << host_config.bits << ' ' << variant;
+      }
+    }
+  }
+}
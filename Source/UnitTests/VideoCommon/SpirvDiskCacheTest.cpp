@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Spirv.h"
+
+namespace
+{
+constexpr SPIRV::DiskCacheKey KEY = {0x0123456789abcdef, 0xfedcba9876543210};
+constexpr SPIRV::DiskCacheKey OTHER_KEY = {0x0123456789abcdef, 0xfedcba9876543211};
+
+SPIRV::CodeVector MakeCode(u32 size)
+{
+  SPIRV::CodeVector code{0x07230203};
+  for (u32 i = 1; i < size; ++i)
+    code.push_back(i * 0x9e3779b9);
+  return code;
+}
+}  // namespace
+
+class SpirvDiskCacheTest : public testing::Test
+{
+protected:
+  SpirvDiskCacheTest() : m_directory(File::CreateTempDir() + "/")
+  {
+    m_path = SPIRV::GetDiskCacheEntryPath(m_directory, KEY);
+  }
+
+  ~SpirvDiskCacheTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string m_directory;
+  std::string m_path;
+};
+
+TEST_F(SpirvDiskCacheTest, RoundTrip)
+{
+  const SPIRV::CodeVector code = MakeCode(100);
+  ASSERT_TRUE(SPIRV::WriteDiskCacheEntry(m_path, KEY, code));
+  EXPECT_EQ(SPIRV::ReadDiskCacheEntry(m_path, KEY), code);
+
+  // Overwriting an entry replaces it.
+  const SPIRV::CodeVector new_code = MakeCode(50);
+  ASSERT_TRUE(SPIRV::WriteDiskCacheEntry(m_path, KEY, new_code));
+  EXPECT_EQ(SPIRV::ReadDiskCacheEntry(m_path, KEY), new_code);
+
+  // No temporary files are left behind.
+  EXPECT_EQ(File::ScanDirectoryTree(m_directory, false).size, 1u);
+}
+
+TEST_F(SpirvDiskCacheTest, MissingEntryIsNotFound)
+{
+  EXPECT_FALSE(SPIRV::ReadDiskCacheEntry(m_path, KEY));
+}
+
+TEST_F(SpirvDiskCacheTest, RejectsEntryOfAnotherKey)
+{
+  ASSERT_TRUE(SPIRV::WriteDiskCacheEntry(m_path, KEY, MakeCode(100)));
+  EXPECT_FALSE(SPIRV::ReadDiskCacheEntry(m_path, OTHER_KEY));
+}
+
+TEST_F(SpirvDiskCacheTest, RejectsTruncatedEntry)
+{
+  ASSERT_TRUE(SPIRV::WriteDiskCacheEntry(m_path, KEY, MakeCode(100)));
+  {
+    File::IOFile file(m_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - sizeof(SPIRV::CodeType)));
+  }
+  EXPECT_FALSE(SPIRV::ReadDiskCacheEntry(m_path, KEY));
+}
+
+TEST_F(SpirvDiskCacheTest, RejectsCorruptedEntry)
+{
+  ASSERT_TRUE(SPIRV::WriteDiskCacheEntry(m_path, KEY, MakeCode(100)));
+  {
+    File::IOFile file(m_path, "r+b");
+    const u8 byte = 0x5a;
+    ASSERT_TRUE(file.Seek(-20, File::SeekOrigin::End));
+    ASSERT_TRUE(file.WriteBytes(&byte, 1));
+  }
+  EXPECT_FALSE(SPIRV::ReadDiskCacheEntry(m_path, KEY));
+}
+
+TEST_F(SpirvDiskCacheTest, RejectsEntryWithoutHeader)
+{
+  // Entries written before the header was added only contain the code.
+  const SPIRV::CodeVector code = MakeCode(100);
+  {
+    File::IOFile file(m_path, "wb");
+    ASSERT_TRUE(file.WriteArray(code.data(), code.size()));
+  }
+  EXPECT_FALSE(SPIRV::ReadDiskCacheEntry(m_path, KEY));
+}
+
+TEST_F(SpirvDiskCacheTest, TrimDeletesLeastRecentlyUsedEntries)
+{
+  const SPIRV::CodeVector code = MakeCode(1000);
+  std::vector<std::string> paths;
+  const auto base_time = std::filesystem::file_time_type::clock::now() - std::chrono::hours(24);
+  for (u64 i = 0; i < 4; ++i)
+  {
+    const SPIRV::DiskCacheKey key = {i, i};
+    paths.push_back(SPIRV::GetDiskCacheEntryPath(m_directory, key));
+    ASSERT_TRUE(SPIRV::WriteDiskCacheEntry(paths.back(), key, code));
+    std::filesystem::last_write_time(StringToPath(paths.back()),
+                                     base_time + std::chrono::hours(i));
+  }
+
+  const u64 entry_size = File::GetSize(paths[0]);
+  SPIRV::TrimDiskCache(m_directory, entry_size * 4);
+  EXPECT_EQ(File::ScanDirectoryTree(m_directory, false).size, 4u);
+
+  // Reading the oldest entry makes it the most recently used one.
+  ASSERT_TRUE(SPIRV::ReadDiskCacheEntry(paths[0], {0, 0}));
+  SPIRV::TrimDiskCache(m_directory, entry_size * 2 + 1);
+  EXPECT_TRUE(File::Exists(paths[0]));
+  EXPECT_FALSE(File::Exists(paths[1]));
+  EXPECT_FALSE(File::Exists(paths[2]));
+  EXPECT_TRUE(File::Exists(paths[3]));
+}
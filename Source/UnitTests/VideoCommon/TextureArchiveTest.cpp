@@ -0,0 +1,176 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureArchive.h"
+
+namespace
+{
+struct LevelSize
+{
+  u32 width;
+  u32 height;
+  size_t size;
+};
+
+VideoCommon::CustomTextureData MakeTexture(AbstractTextureFormat format,
+                                           std::initializer_list<LevelSize> sizes, u8 seed)
+{
+  VideoCommon::CustomTextureData data;
+  auto& levels = data.m_slices.emplace_back().m_levels;
+  for (const LevelSize& size : sizes)
+  {
+    auto& level = levels.emplace_back();
+    level.format = format;
+    level.width = size.width;
+    level.height = size.height;
+    level.row_length = size.width;
+    level.data.reset(size.size);
+    for (size_t i = 0; i < size.size; ++i)
+      level.data.data()[i] = static_cast<u8>(seed + i * 7);
+    ++seed;
+  }
+  return data;
+}
+
+void ExpectSameTexture(const VideoCommon::CustomTextureData& expected,
+                       const VideoCommon::CustomTextureData& actual)
+{
+  ASSERT_EQ(actual.m_slices.size(), 1u);
+  const auto& expected_levels = expected.m_slices[0].m_levels;
+  const auto& actual_levels = actual.m_slices[0].m_levels;
+  ASSERT_EQ(expected_levels.size(), actual_levels.size());
+  for (size_t i = 0; i < expected_levels.size(); ++i)
+  {
+    EXPECT_EQ(expected_levels[i].format, actual_levels[i].format);
+    EXPECT_EQ(expected_levels[i].width, actual_levels[i].width);
+    EXPECT_EQ(expected_levels[i].height, actual_levels[i].height);
+    EXPECT_EQ(expected_levels[i].row_length, actual_levels[i].row_length);
+    ASSERT_EQ(expected_levels[i].data.size(), actual_levels[i].data.size());
+    EXPECT_TRUE(std::equal(expected_levels[i].data.data(),
+                           expected_levels[i].data.data() + expected_levels[i].data.size(),
+                           actual_levels[i].data.data()));
+  }
+}
+}  // namespace
+
+class TextureArchiveTest : public testing::Test
+{
+protected:
+  TextureArchiveTest()
+      : m_directory(File::CreateTempDir()), m_archive_path(m_directory + "/textures.dtp")
+  {
+  }
+
+  ~TextureArchiveTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_directory;
+  const std::string m_archive_path;
+};
+
+TEST_F(TextureArchiveTest, RoundTrip)
+{
+  const auto rgba = MakeTexture(AbstractTextureFormat::RGBA8,
+                                {{8, 4, 8 * 4 * 4}, {4, 2, 4 * 2 * 4}, {2, 1, 2 * 1 * 4}}, 1);
+  // DXT1 has 8 bytes per 4x4 block.
+  const auto dxt1 = MakeTexture(AbstractTextureFormat::DXT1, {{16, 16, 16 * 8}, {8, 8, 4 * 8}}, 4);
+
+  VideoCommon::TextureArchiveWriter writer;
+  ASSERT_TRUE(writer.Open(m_archive_path));
+  ASSERT_TRUE(writer.AddTexture("tex1_8x4_0123456789abcdef_1", false, rgba));
+  ASSERT_TRUE(writer.AddTexture("tex1_16x16_fedcba9876543210_14", true, dxt1));
+  // Names must be unique.
+  EXPECT_FALSE(writer.AddTexture("tex1_8x4_0123456789abcdef_1", false, dxt1));
+  // Many more textures, so that some of them collide in the hash table.
+  for (int i = 0; i < 100; ++i)
+  {
+    const auto filler = MakeTexture(AbstractTextureFormat::RGBA8, {{1, 1, 4}}, static_cast<u8>(i));
+    ASSERT_TRUE(writer.AddTexture("tex1_1x1_" + std::to_string(i), false, filler));
+  }
+  ASSERT_TRUE(writer.Finish());
+
+  VideoCommon::TextureArchive archive;
+  ASSERT_TRUE(archive.Open(m_archive_path));
+  EXPECT_EQ(archive.GetTextureCount(), 102u);
+
+  const auto found_rgba = archive.FindTexture("tex1_8x4_0123456789abcdef_1");
+  ASSERT_TRUE(found_rgba.has_value());
+  EXPECT_EQ(found_rgba->name, "tex1_8x4_0123456789abcdef_1");
+  EXPECT_FALSE(found_rgba->has_arbitrary_mipmaps);
+
+  const auto found_dxt1 = archive.FindTexture("tex1_16x16_fedcba9876543210_14");
+  ASSERT_TRUE(found_dxt1.has_value());
+  EXPECT_TRUE(found_dxt1->has_arbitrary_mipmaps);
+
+  EXPECT_FALSE(archive.FindTexture("tex1_8x4_0123456789abcdef_2").has_value());
+  EXPECT_FALSE(archive.FindTexture("").has_value());
+
+  VideoCommon::CustomTextureData loaded;
+  ASSERT_TRUE(archive.LoadTexture("tex1_8x4_0123456789abcdef_1", &loaded));
+  ExpectSameTexture(rgba, loaded);
+  ASSERT_TRUE(archive.LoadTexture("tex1_16x16_fedcba9876543210_14", &loaded));
+  ExpectSameTexture(dxt1, loaded);
+  for (int i = 0; i < 100; ++i)
+  {
+    const std::string name = "tex1_1x1_" + std::to_string(i);
+    ASSERT_TRUE(archive.LoadTexture(name, &loaded)) << name;
+    EXPECT_EQ(loaded.m_slices[0].m_levels[0].data.data()[0], static_cast<u8>(i)) << name;
+  }
+  EXPECT_FALSE(archive.LoadTexture("tex1_missing", &loaded));
+
+  int num_textures = 0;
+  archive.ForEachTexture([&](const VideoCommon::TextureArchive::Texture&) { ++num_textures; });
+  EXPECT_EQ(num_textures, 102);
+}
+
+TEST_F(TextureArchiveTest, EmptyArchive)
+{
+  VideoCommon::TextureArchiveWriter writer;
+  ASSERT_TRUE(writer.Open(m_archive_path));
+  ASSERT_TRUE(writer.Finish());
+
+  VideoCommon::TextureArchive archive;
+  ASSERT_TRUE(archive.Open(m_archive_path));
+  EXPECT_EQ(archive.GetTextureCount(), 0u);
+  EXPECT_FALSE(archive.FindTexture("tex1_8x4_0123456789abcdef_1").has_value());
+}
+
+TEST_F(TextureArchiveTest, RejectsInvalidFiles)
+{
+  VideoCommon::TextureArchive archive;
+  EXPECT_FALSE(archive.Open(m_directory + "/missing.dtp"));
+
+  const std::string garbage(256, 'x');
+  ASSERT_TRUE(File::IOFile(m_archive_path, "wb").WriteString(garbage));
+  EXPECT_FALSE(archive.Open(m_archive_path));
+
+  // An archive that lost its index.
+  const auto texture = MakeTexture(AbstractTextureFormat::RGBA8, {{64, 64, 64 * 64 * 4}}, 0);
+  VideoCommon::TextureArchiveWriter writer;
+  ASSERT_TRUE(writer.Open(m_archive_path));
+  ASSERT_TRUE(writer.AddTexture("tex1_64x64_0123456789abcdef_6", false, texture));
+  ASSERT_TRUE(writer.Finish());
+  ASSERT_TRUE(File::IOFile(m_archive_path, "r+b").Resize(64 * 64 * 4));
+  EXPECT_FALSE(archive.Open(m_archive_path));
+}
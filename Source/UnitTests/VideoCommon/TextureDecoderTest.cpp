@@ -0,0 +1,229 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/ParallelTextureDecoder.h"
+#include "VideoCommon/TextureDecoder.h"
+
+enum class DecoderLevel
+{
+  SSE2,
+  SSSE3,
+  AVX2,
+};
+
+namespace
+{
+// Restricts the instruction sets used by TexDecoder_Decode for the lifetime of the object.
+class ScopedDecoderLevel
+{
+public:
+  explicit ScopedDecoderLevel(DecoderLevel level)
+      : m_old_ssse3(cpu_info.bSSSE3), m_old_avx2(cpu_info.bAVX2)
+  {
+    cpu_info.bSSSE3 = level >= DecoderLevel::SSSE3;
+    cpu_info.bAVX2 = level >= DecoderLevel::AVX2;
+  }
+  ~ScopedDecoderLevel()
+  {
+    cpu_info.bSSSE3 = m_old_ssse3;
+    cpu_info.bAVX2 = m_old_avx2;
+  }
+
+  ScopedDecoderLevel(const ScopedDecoderLevel&) = delete;
+  ScopedDecoderLevel& operator=(const ScopedDecoderLevel&) = delete;
+
+private:
+  bool m_old_ssse3;
+  bool m_old_avx2;
+};
+
+bool IsLevelSupported(DecoderLevel level)
+{
+  switch (level)
+  {
+  case DecoderLevel::SSSE3:
+    return cpu_info.bSSSE3;
+  case DecoderLevel::AVX2:
+    return cpu_info.bAVX2;
+  default:
+    return true;
+  }
+}
+
+// Enough for the largest palette, which is the one of C14X2.
+constexpr size_t TLUT_SIZE = 0x4000 * sizeof(u16);
+
+struct Size
+{
+  int width;
+  int height;
+};
+
+// Width and height in blocks. One block, an odd number of blocks in a row to hit the code that
+// handles a single tile after pairs of tiles, and textures that aren't square.
+constexpr Size SIZES_IN_BLOCKS[] = {{1, 1}, {2, 1}, {3, 2}, {1, 4}, {5, 3}, {16, 8}};
+}  // namespace
+
+class TextureDecoderTest
+    : public testing::TestWithParam<std::tuple<TextureFormat, TLUTFormat, DecoderLevel>>
+{
+protected:
+  void SetUp() override
+  {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> byte(0, 255);
+    m_tlut.resize(TLUT_SIZE);
+    for (u8& value : m_tlut)
+      value = static_cast<u8>(byte(rng));
+  }
+
+  // Random data, but with runs of equal bytes and the top bits set and clear in whole tiles, so
+  // formats that branch on the data (CMPR, RGB5A3) see all cases.
+  static std::vector<u8> GenerateSource(size_t size, u32 seed)
+  {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> kind(0, 3);
+
+    std::vector<u8> src(size);
+    for (size_t tile = 0; tile < size; tile += 32)
+    {
+      const int tile_kind = kind(rng);
+      for (size_t i = tile; i < std::min(tile + 32, size); ++i)
+      {
+        u8 value = static_cast<u8>(byte(rng));
+        if (tile_kind == 1)
+          value |= 0x80;
+        else if (tile_kind == 2)
+          value &= 0x7f;
+        else if (tile_kind == 3 && i != tile)
+          value = src[i - 1];
+        src[i] = value;
+      }
+    }
+    return src;
+  }
+
+  std::vector<u8> m_tlut;
+};
+
+TEST_P(TextureDecoderTest, MatchesGenericDecoder)
+{
+  const auto [format, tlut_format, level] = GetParam();
+  if (!IsLevelSupported(level))
+    GTEST_SKIP() << "The CPU doesn't support this instruction set";
+
+  const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+  const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+  for (const Size& blocks : SIZES_IN_BLOCKS)
+  {
+    const int width = blocks.width * block_width;
+    const int height = blocks.height * block_height;
+    SCOPED_TRACE(fmt::format("{}x{}", width, height));
+
+    const std::vector<u8> src =
+        GenerateSource(TexDecoder_GetTextureSizeInBytes(width, height, format),
+                       static_cast<u32>(width * 31 + height));
+    const size_t num_texels = static_cast<size_t>(width) * height;
+
+    std::vector<u32> expected(num_texels, 0xdeadbeef);
+    TexDecoder_DecodeImpl_Generic(expected.data(), src.data(), width, height, format,
+                                  m_tlut.data(), tlut_format);
+
+    std::vector<u32> actual(num_texels, 0xdeadbeef);
+    {
+      ScopedDecoderLevel scoped_level(level);
+      TexDecoder_Decode(reinterpret_cast<u8*>(actual.data()), src.data(), width, height, format,
+                        m_tlut.data(), tlut_format);
+    }
+
+    for (size_t i = 0; i < num_texels; ++i)
+    {
+      ASSERT_EQ(expected[i], actual[i])
+          << fmt::format("at texel ({}, {})", i % width, i / width);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DirectFormats, TextureDecoderTest,
+    testing::Combine(testing::Values(TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4,
+                                     TextureFormat::IA8, TextureFormat::RGB565,
+                                     TextureFormat::RGB5A3, TextureFormat::RGBA8,
+                                     TextureFormat::CMPR),
+                     testing::Values(TLUTFormat::IA8),
+                     testing::Values(DecoderLevel::SSE2, DecoderLevel::SSSE3, DecoderLevel::AVX2)));
+
+INSTANTIATE_TEST_SUITE_P(
+    PalettedFormats, TextureDecoderTest,
+    testing::Combine(testing::Values(TextureFormat::C4, TextureFormat::C8, TextureFormat::C14X2),
+                     testing::Values(TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3),
+                     testing::Values(DecoderLevel::SSE2, DecoderLevel::AVX2)));
+
+TEST(ParallelTextureDecoderTest, MatchesSingleThreadedDecoder)
+{
+  // 512x512 texels with mipmaps, which is above the threshold, and an odd number of threads so the
+  // bands aren't evenly split between them.
+  constexpr int WIDTH = 512;
+  constexpr int HEIGHT = 512;
+  constexpr int NUM_LEVELS = 10;
+  static_assert(WIDTH * HEIGHT >= VideoCommon::ParallelTextureDecoder::MIN_PARALLEL_TEXELS);
+
+  VideoCommon::ParallelTextureDecoder decoder;
+  decoder.SetNumWorkerThreads(3);
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::vector<u8> tlut(TLUT_SIZE);
+  for (u8& value : tlut)
+    value = static_cast<u8>(byte(rng));
+
+  for (const TextureFormat format :
+       {TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+        TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+        TextureFormat::C8, TextureFormat::C14X2, TextureFormat::CMPR})
+  {
+    SCOPED_TRACE(fmt::format("{}", format));
+    const int block_width = TexDecoder_GetBlockWidthInTexels(format);
+    const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+
+    std::vector<std::vector<u8>> sources;
+    std::vector<std::vector<u32>> expected;
+    std::vector<std::vector<u32>> actual;
+    std::vector<VideoCommon::ParallelTextureDecoder::Level> levels;
+    for (int level = 0; level < NUM_LEVELS; ++level)
+    {
+      const int width = std::max(WIDTH >> level, 1);
+      const int height = std::max(HEIGHT >> level, 1);
+      const int expanded_width = (width + block_width - 1) / block_width * block_width;
+      const int expanded_height = (height + block_height - 1) / block_height * block_height;
+      const size_t num_texels = static_cast<size_t>(expanded_width) * expanded_height;
+
+      std::vector<u8>& src = sources.emplace_back(
+          TexDecoder_GetTextureSizeInBytes(expanded_width, expanded_height, format));
+      for (u8& value : src)
+        value = static_cast<u8>(byte(rng));
+
+      TexDecoder_Decode(reinterpret_cast<u8*>(expected.emplace_back(num_texels).data()),
+                        src.data(), expanded_width, expanded_height, format, tlut.data(),
+                        TLUTFormat::RGB5A3);
+      levels.push_back({reinterpret_cast<u8*>(actual.emplace_back(num_texels, 0xdeadbeef).data()),
+                        src.data(), expanded_width, expanded_height});
+    }
+
+    decoder.Decode(levels, format, tlut.data(), TLUTFormat::RGB5A3);
+
+    for (int level = 0; level < NUM_LEVELS; ++level)
+      EXPECT_EQ(expected[level], actual[level]) << "at level " << level;
+  }
+}
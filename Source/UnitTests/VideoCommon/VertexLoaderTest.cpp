@@ -2,14 +2,17 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <bit>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>  // NOLINT
 
+#include "Common/CPUDetect.h"
 #include "Common/Common.h"
 #include "Common/MathUtil.h"
 #include "VideoCommon/CPMemory.h"
@@ -369,6 +372,27 @@ TEST_F(VertexLoaderTest, LargeFloatVertexSpeed)
     RunVertices(100000);
 }
 
+TEST_F(VertexLoaderTest, DirectPositionNormalColorTexCoordSpeed)
+{
+  // The attributes VertexLoaderX64 converts two vertices at a time with AVX2.
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.NormalFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::N;
+  m_vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  CreateAndCheckSizes(3 * sizeof(float) + 3 * sizeof(s16) + 4 + 2 * sizeof(s16),
+                      3 * sizeof(float) + 3 * sizeof(float) + 4 + 2 * sizeof(float));
+
+  for (int i = 0; i < 1000; ++i)
+    RunVertices(100000);
+}
+
 TEST_F(VertexLoaderTest, DirectAllComponents)
 {
   m_vtx_desc.low.PosMatIdx = true;
@@ -1064,6 +1088,90 @@ TEST_P(VertexLoaderSkippedTexCoordsTest, SkippedTextures)
   }
 }
 
+class VertexLoaderX64PairTest
+    : public VertexLoaderTest,
+      public ::testing::WithParamInterface<std::tuple<ComponentFormat, ComponentFormat, ColorFormat>>
+{
+protected:
+  // The AVX2 path of VertexLoaderX64 is only generated if the CPU supports it, so build one
+  // loader without it to compare against.
+  std::unique_ptr<VertexLoaderBase> CreateX64Loader(bool avx2)
+  {
+    const bool old_avx2 = cpu_info.bAVX2;
+    cpu_info.bAVX2 = avx2;
+    std::unique_ptr<VertexLoaderBase> loader =
+        VertexLoaderBase::CreateVertexLoader(m_vtx_desc, m_vtx_attr);
+    cpu_info.bAVX2 = old_avx2;
+    return loader;
+  }
+};
+INSTANTIATE_TEST_SUITE_P(
+    DirectFormats, VertexLoaderX64PairTest,
+    ::testing::Combine(::testing::Values(ComponentFormat::UByte, ComponentFormat::Byte,
+                                         ComponentFormat::UShort, ComponentFormat::Short,
+                                         ComponentFormat::Float),
+                       ::testing::Values(ComponentFormat::Byte, ComponentFormat::Short,
+                                         ComponentFormat::Float),
+                       ::testing::Values(ColorFormat::RGB565, ColorFormat::RGB888,
+                                         ColorFormat::RGBA8888)));
+
+TEST_P(VertexLoaderX64PairTest, MatchesOneVertexLoop)
+{
+  if (!cpu_info.bAVX2)
+    GTEST_SKIP() << "The CPU doesn't support AVX2";
+
+  auto [pos_format, normal_format, color_format] = GetParam();
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosFormat = pos_format;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFrac = 6;
+  m_vtx_attr.g0.ByteDequant = true;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.NormalFormat = normal_format;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::N;
+  m_vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.Color0Comp = color_format;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0Frac = 8;
+
+  const std::unique_ptr<VertexLoaderBase> one_vertex_loader = CreateX64Loader(false);
+  const std::unique_ptr<VertexLoaderBase> pair_loader = CreateX64Loader(true);
+  const u32 stride = one_vertex_loader->m_native_vtx_decl.stride;
+  ASSERT_EQ(stride, pair_loader->m_native_vtx_decl.stride);
+
+  // Arbitrary input, including NaNs for float attributes, which must be copied bit-exactly.
+  constexpr int MAX_COUNT = 10000;
+  for (u32 i = 0; i < MAX_COUNT * one_vertex_loader->m_vertex_size; i++)
+    input_memory[i] = static_cast<u8>(i * 131 + (i >> 7));
+
+  std::vector<u8> expected(MAX_COUNT * stride + 16);
+  std::vector<u8> actual(MAX_COUNT * stride + 16);
+
+  // Odd and even counts, and counts that are too small for any pair of vertices.
+  for (const int count : {1, 2, 3, 4, 5, 6, 7, 8, 101, MAX_COUNT})
+  {
+    VertexLoaderManager::position_cache = {};
+    VertexLoaderManager::normal_cache = {};
+    EXPECT_EQ(count, one_vertex_loader->RunVertices(input_memory, expected.data(), count));
+    const auto expected_position_cache = VertexLoaderManager::position_cache;
+    const auto expected_normal_cache = VertexLoaderManager::normal_cache;
+
+    VertexLoaderManager::position_cache = {};
+    VertexLoaderManager::normal_cache = {};
+    EXPECT_EQ(count, pair_loader->RunVertices(input_memory, actual.data(), count));
+
+    EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), count * stride)) << count;
+    EXPECT_EQ(0, std::memcmp(&expected_position_cache, &VertexLoaderManager::position_cache,
+                             sizeof(expected_position_cache)))
+        << count;
+    EXPECT_EQ(0, std::memcmp(&expected_normal_cache, &VertexLoaderManager::normal_cache,
+                             sizeof(expected_normal_cache)))
+        << count;
+  }
+}
+
 // For gtest, which doesn't know about our fmt::formatters by default
 static void PrintTo(const VertexComponentFormat& t, std::ostream* os)
 {
@@ -1081,3 +1189,7 @@ static void PrintTo(const NormalComponentCount& t, std::ostream* os)
 {
   *os << fmt::to_string(t);
 }
+static void PrintTo(const ColorFormat& t, std::ostream* os)
+{
+  *os << fmt::to_string(t);
+}